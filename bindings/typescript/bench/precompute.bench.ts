@@ -0,0 +1,90 @@
+/**
+ * Compare filling the precompute buffer with the single threaded module
+ * and with the threaded module, each in its own node process since the
+ * module is loaded once per process.
+ *
+ * usage: npm run bench [-- <queue size>]
+ */
+import { fork } from "child_process";
+import test_data from "../../../data/test/test-data.json";
+import {
+  ElectionContext,
+  PrecomputeBufferContext,
+  setWasmVariant,
+  WasmVariant,
+} from "../src";
+
+type BenchResult = {
+  variant: WasmVariant;
+  threaded: boolean;
+  queueSize: number;
+  milliseconds: number;
+  valuesPerSecond: number;
+};
+
+const VARIANTS: WasmVariant[] = ["single", "threaded"];
+
+const run = async (variant: WasmVariant, queueSize: number) => {
+  setWasmVariant(variant);
+  const context = await ElectionContext.fromJson(
+    JSON.stringify((test_data as unknown as any).election.context)
+  );
+  const publicKey = context.publicKeyRef;
+
+  // build the fixed base tables before timing
+  await PrecomputeBufferContext.initialize(publicKey, 1);
+  await PrecomputeBufferContext.start();
+  await PrecomputeBufferContext.initialize(publicKey, queueSize);
+
+  const start = performance.now();
+  const task = await PrecomputeBufferContext.startAsync(publicKey);
+  const progress = await task.done;
+  const milliseconds = performance.now() - start;
+
+  const values = progress.selections + progress.encryptions;
+  const result: BenchResult = {
+    variant,
+    threaded: await PrecomputeBufferContext.isThreaded(),
+    queueSize,
+    milliseconds,
+    valuesPerSecond: (values * 1000) / milliseconds,
+  };
+  await PrecomputeBufferContext.clear();
+
+  // the workers of the threaded module keep the process alive
+  process.send?.(result, () => process.exit(0));
+};
+
+const runInChild = (variant: WasmVariant, queueSize: number) =>
+  new Promise<BenchResult>((resolve, reject) => {
+    const child = fork(__filename, [variant, `${queueSize}`], {
+      execArgv: ["--require", "ts-node/register"],
+    });
+    child.on("message", (message) => resolve(message as BenchResult));
+    child.on("error", reject);
+    child.on("exit", (code) => {
+      if (code !== 0) {
+        reject(new Error(`the ${variant} benchmark exited with ${code}`));
+      }
+    });
+  });
+
+const main = async () => {
+  const [variant, size] = process.argv.slice(2);
+  if (VARIANTS.includes(variant as WasmVariant)) {
+    await run(variant as WasmVariant, Number(size));
+    return;
+  }
+
+  const queueSize = Number(variant ?? 100);
+  const results: BenchResult[] = [];
+  for (const each of VARIANTS) {
+    results.push(await runInChild(each, queueSize));
+  }
+  console.table(results);
+};
+
+main().catch((error) => {
+  console.error(error);
+  process.exit(1);
+});
@@ -1,5 +1,8 @@
 import { getInstance } from "./wasm";
 
+export { setWasmVariant } from "./wasm";
+export type { WasmVariant } from "./wasm";
+
 export * from "./ballot";
 export * from "./election";
 export * from "./encrypt";
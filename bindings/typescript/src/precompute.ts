@@ -1,5 +1,94 @@
 import { ElementModP } from "./group";
-import { getInstance } from "./wasm";
+import { getInstance, PrecomputeStatus } from "./wasm";
+
+/**
+ * The fill level of the precompute buffer.
+ */
+export type PrecomputeProgress = {
+  selections: number;
+  selectionsTarget: number;
+  encryptions: number;
+  encryptionsTarget: number;
+  /** the fraction of both queues that is filled, from 0 to 1 */
+  fraction: number;
+};
+
+export type PrecomputeOptions = {
+  /** the number of workers producing values, by default the hardware threads */
+  concurrency?: number;
+  /** how often progress is reported, in milliseconds */
+  interval?: number;
+  /** the number of values produced between yields without workers */
+  sliceSize?: number;
+  onProgress?: (progress: PrecomputeProgress) => void;
+};
+
+/**
+ * Dispatched by a precompute task each time its progress is reported.
+ */
+export class PrecomputeProgressEvent extends Event {
+  readonly progress: PrecomputeProgress;
+
+  constructor(progress: PrecomputeProgress) {
+    super("progress");
+    this.progress = progress;
+  }
+}
+
+const toProgress = (status: PrecomputeStatus): PrecomputeProgress => {
+  const filled =
+    Math.min(status.selections.size, status.selections.target) +
+    Math.min(status.encryptions.size, status.encryptions.target);
+  const target = status.selections.target + status.encryptions.target;
+  return {
+    selections: status.selections.size,
+    selectionsTarget: status.selections.target,
+    encryptions: status.encryptions.size,
+    encryptionsTarget: status.encryptions.target,
+    fraction: target === 0 ? 1 : filled / target,
+  };
+};
+
+const isFull = (progress: PrecomputeProgress): boolean =>
+  progress.selections >= progress.selectionsTarget &&
+  progress.encryptions >= progress.encryptionsTarget;
+
+const yieldToHost = (delay: number = 0): Promise<void> =>
+  new Promise((resolve) => setTimeout(resolve, delay));
+
+/**
+ * A precompute running in the background, which dispatches "progress" events
+ * until the buffer is full or the task is stopped.
+ */
+export class PrecomputeTask extends EventTarget {
+  /** resolves with the final progress once the task finishes */
+  readonly done: Promise<PrecomputeProgress>;
+
+  private _stopped = false;
+
+  constructor(run: (task: PrecomputeTask) => Promise<PrecomputeProgress>) {
+    super();
+    // start after the caller has had a chance to add its listeners
+    this.done = yieldToHost().then(() => run(this));
+  }
+
+  get stopped(): boolean {
+    return this._stopped;
+  }
+
+  /**
+   * Stop producing values, keeping the values that are in the buffer.
+   */
+  async stop(): Promise<PrecomputeProgress> {
+    this._stopped = true;
+    return this.done;
+  }
+
+  report(progress: PrecomputeProgress, options: PrecomputeOptions): void {
+    options.onProgress?.(progress);
+    this.dispatchEvent(new PrecomputeProgressEvent(progress));
+  }
+}
 
 export class PrecomputeBufferContext {
   static async clear(): Promise<void> {
@@ -17,6 +106,62 @@ export class PrecomputeBufferContext {
   static async start(): Promise<void> {
     (await getInstance()).PrecomputeBufferContext.start();
   }
+
+  /**
+   * Fill the buffer for the public key without blocking the caller.
+   *
+   * The threaded build produces values in web workers that share the fixed base
+   * tables and the progress is polled. The single threaded build produces the
+   * values in slices on the calling thread and yields between the slices.
+   */
+  static async startAsync(
+    publicKey: ElementModP,
+    options: PrecomputeOptions = {}
+  ): Promise<PrecomputeTask> {
+    const module = await getInstance();
+    const context = module.PrecomputeBufferContext;
+    const interval = options.interval ?? 100;
+
+    if (context.isThreaded()) {
+      const concurrency =
+        options.concurrency ?? Math.max(1, context.getHardwareConcurrency());
+      context.startAsync(publicKey._handle, concurrency);
+      return new PrecomputeTask(async (task) => {
+        // the producers finish early when the shared memory budget is spent
+        let status = context.getStatus();
+        while (
+          !task.stopped &&
+          !isFull(toProgress(status)) &&
+          status.producers > 0
+        ) {
+          await yieldToHost(interval);
+          status = context.getStatus();
+          task.report(toProgress(status), options);
+        }
+        context.stop();
+        return toProgress(context.getStatus());
+      });
+    }
+
+    // without workers the module has a single thread to produce on, so select
+    // the buffer of the public key before filling it in slices
+    context.add(publicKey._handle, 0);
+    const sliceSize = options.sliceSize ?? 8;
+    return new PrecomputeTask(async (task) => {
+      let lastReport = Date.now();
+      let finished = false;
+      while (!task.stopped && !finished) {
+        finished = context.populate(sliceSize);
+        if (finished || Date.now() - lastReport >= interval) {
+          task.report(toProgress(context.getStatus()), options);
+          lastReport = Date.now();
+        }
+        await yieldToHost();
+      }
+      return toProgress(context.getStatus());
+    });
+  }
+
   static async stop(): Promise<void> {
     var result = (await getInstance()).PrecomputeBufferContext.stop();
   }
@@ -32,4 +177,11 @@ export class PrecomputeBufferContext {
     ).PrecomputeBufferContext.getCurrentQueueSize();
     return result;
   }
+  static async getProgress(): Promise<PrecomputeProgress> {
+    const status = (await getInstance()).PrecomputeBufferContext.getStatus();
+    return toProgress(status);
+  }
+  static async isThreaded(): Promise<boolean> {
+    return (await getInstance()).PrecomputeBufferContext.isThreaded();
+  }
 }
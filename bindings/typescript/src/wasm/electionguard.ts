@@ -154,15 +154,34 @@ export type ManifestFunctionsStatic = {
   ): InternalManifestHandle;
 };
 
+export type PrecomputeQueueStatus = {
+  size: number;
+  target: number;
+};
+
+export type PrecomputeStatus = {
+  selections: PrecomputeQueueStatus;
+  encryptions: PrecomputeQueueStatus;
+  encryptionsPerSelection: number;
+  producers: number;
+};
+
 export type PrecomputeBuffersStatic = {
   clear(): void;
 
   initialize(publicKey: ElementModPHandle, maxQueueSize: number): void;
+  add(publicKey: ElementModPHandle, maxQueueSize: number): void;
   start(): void;
+  startAsync(publicKey: ElementModPHandle, concurrency: number): void;
+  populate(count: number): boolean;
   stop(): void;
 
   getMaxQueueSize(): number;
   getCurrentQueueSize(): number;
+  getStatus(): PrecomputeStatus;
+
+  isThreaded(): boolean;
+  getHardwareConcurrency(): number;
 };
 
 export interface ElectionguardModule extends EmscriptenModule {
@@ -5,9 +5,48 @@ let _module: ElectionguardModule;
 let _pending: Promise<void> | undefined = undefined;
 let _status: "loaded" | "loading" | "unknown" = "unknown";
 
+/**
+ * The build of the module to load. The threaded build runs the precompute
+ * in web workers, and "auto" uses it whenever the host supports it.
+ */
+export type WasmVariant = "auto" | "threaded" | "single";
+
+let _variant: WasmVariant = "auto";
+
+/**
+ * Choose the build of the module, before the module is first loaded.
+ */
+const setWasmVariant = (variant: WasmVariant): void => {
+  if (_status !== "unknown") {
+    throw new Error("The wasm variant must be set before the module is loaded");
+  }
+  _variant = variant;
+};
+
+// the threads share the module memory, which browsers only provide
+// to cross origin isolated pages
+const supportsThreads = (): boolean =>
+  typeof SharedArrayBuffer !== "undefined" &&
+  (typeof crossOriginIsolated === "undefined" || crossOriginIsolated);
+
+const getFactory = (): EmscriptenModuleFactory<ElectionguardModule> => {
+  if (_variant === "single" || (_variant === "auto" && !supportsThreads())) {
+    return createModule;
+  }
+  try {
+    // the threaded build is optional, so it is only resolved when it is used
+    return require("./electionguard.wasm.mt");
+  } catch (error) {
+    if (_variant === "threaded") {
+      throw error;
+    }
+    return createModule;
+  }
+};
+
 const load = async () => {
   console.log("Loading Electionguard WASM module");
-  _module = await createModule();
+  _module = await getFactory()();
 };
 
 const getInstance = async (): Promise<ElectionguardModule> => {
@@ -29,4 +68,4 @@ const getInstance = async (): Promise<ElectionguardModule> => {
   }
 };
 
-export { getInstance };
+export { getInstance, setWasmVariant };
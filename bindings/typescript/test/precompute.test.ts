@@ -2,7 +2,12 @@ require("./setup");
 import { assert } from "chai";
 import test_data from "../../../data/test/test-data.json";
 import { ElectionContext } from "../src/election";
-import { ElementModP, PrecomputeBufferContext } from "../src";
+import {
+  ElementModP,
+  PrecomputeBufferContext,
+  PrecomputeProgress,
+  PrecomputeProgressEvent,
+} from "../src";
 
 const ciphertextElectionContext = (test_data as unknown as any).election
   .context;
@@ -31,4 +36,49 @@ describe("PrecomputeBufferContext Tests", () => {
 
     assert.isTrue((await PrecomputeBufferContext.getCurrentQueueSize()) > 0);
   });
+
+  it("should precompute asynchronously", async function () {
+    this.timeout(60000);
+    const context = JSON.stringify(ciphertextElectionContext);
+    const result = await ElectionContext.fromJson(context);
+    await PrecomputeBufferContext.initialize(result.publicKeyRef, 10);
+
+    const reported: PrecomputeProgress[] = [];
+    const task = await PrecomputeBufferContext.startAsync(
+      result.publicKeyRef,
+      { interval: 10 }
+    );
+    task.addEventListener("progress", (event) =>
+      reported.push((event as PrecomputeProgressEvent).progress)
+    );
+    const progress = await task.done;
+
+    assert.equal(progress.selections, 10);
+    assert.equal(progress.fraction, 1);
+    assert.isTrue(reported.length > 0);
+    assert.equal(await PrecomputeBufferContext.getCurrentQueueSize(), 10);
+    await PrecomputeBufferContext.clear();
+  });
+
+  it("should precompute asynchronously without a buffer", async function () {
+    this.timeout(60000);
+    const context = JSON.stringify(ciphertextElectionContext);
+    const result = await ElectionContext.fromJson(context);
+    await PrecomputeBufferContext.clear();
+
+    const task = await PrecomputeBufferContext.startAsync(
+      result.publicKeyRef,
+      { interval: 10 }
+    );
+    task.addEventListener("progress", (event) => {
+      if ((event as PrecomputeProgressEvent).progress.selections > 0) {
+        task.stop();
+      }
+    });
+    const progress = await task.done;
+
+    assert.isTrue(progress.selections > 0);
+    assert.isTrue((await PrecomputeBufferContext.getCurrentQueueSize()) > 0);
+    await PrecomputeBufferContext.clear();
+  });
 });
@@ -11,6 +11,8 @@ option(TEST_USE_SAMPLE "the sample to use, full, hamilton-general, minimal, smal
 option(CODE_COVERAGE "Use code coverage" OFF)
 option(OPTION_GENERATE_DOCS "Generate documentation" OFF)
 option(USE_DYNAMIC_ANALYSIS "Enable Dynamic tools" OFF)
+option(USE_TRACING "Compile in trace spans for profiling" OFF)
+option(USE_WASM_THREADS "Build the WebAssembly module with pthreads and SIMD128" OFF)
 
 # Set a DEBUG definition
 if(CMAKE_BUILD_TYPE MATCHES Debug)
@@ -39,6 +41,17 @@ if(USE_32BIT_MATH)
     add_compile_definitions(USE_32BIT_MATH)
 endif()
 
+if(USE_TRACING)
+    message("++ Compiling in trace spans")
+    add_compile_definitions(EG_TRACING)
+endif()
+
+# every object linked into a threaded module must be compiled with shared memory
+if(EMSCRIPTEN AND USE_WASM_THREADS)
+    message("++ Compiling WASM with pthreads and SIMD128")
+    add_compile_options(-pthread -msimd128)
+endif()
+
 if(USE_TEST_PRIMES)
     message("++ Using Test Primes. Do not use in production.")
     add_compile_definitions(USE_TEST_PRIMES)
@@ -3,9 +3,11 @@
 
 #include "electionguard/export.h"
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <deque>
 #include <functional>
 #include <future>
 #include <memory>
@@ -96,6 +98,32 @@ namespace electionguard
         return results;
     }
 
+    /// <summary>
+    /// Run `task(index)` for every index in [0, count) with at most `concurrency`
+    /// tasks in flight, returning the results in index order.
+    /// A concurrency of zero uses the number of hardware threads.
+    /// </summary>
+    template <typename T, typename F>
+    EG_INTERNAL_API vector<T> map_async(size_t count, size_t concurrency, F task)
+    {
+        if (concurrency == 0) {
+            concurrency = std::max(1U, std::thread::hardware_concurrency());
+        }
+
+        vector<T> results;
+        results.reserve(count);
+        std::deque<future<T>> pending;
+        size_t next = 0;
+        for (size_t i = 0; i < count; i++) {
+            while (next < count && pending.size() < concurrency) {
+                pending.push_back(std::async(std::launch::async, task, next++));
+            }
+            results.push_back(pending.front().get());
+            pending.pop_front();
+        }
+        return results;
+    }
+
     /// <summary>
     /// A simple asynchronous thread safe queue using locks.
     /// </summary>
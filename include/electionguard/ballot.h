@@ -477,6 +477,26 @@ EG_API eg_electionguard_status_t eg_ciphertext_ballot_to_msgpack(eg_ciphertext_b
 EG_API eg_electionguard_status_t eg_ciphertext_ballot_to_msgpack_with_nonces(
   eg_ciphertext_ballot_t *handle, uint8_t **out_data, uint64_t *out_size);
 
+/**
+ * Import the ballot representation from the versioned binary wire format.
+ * The input buffer is read in place and is not retained by the ballot.
+ */
+EG_API eg_electionguard_status_t eg_ciphertext_ballot_from_binary(
+  uint8_t *in_data, uint64_t in_length, eg_ciphertext_ballot_t **out_handle);
+
+/**
+ * Export the ballot representation using the versioned binary wire format
+ */
+EG_API eg_electionguard_status_t eg_ciphertext_ballot_to_binary(eg_ciphertext_ballot_t *handle,
+                                                                uint8_t **out_data,
+                                                                uint64_t *out_size);
+
+/**
+ * Export the ballot representation using the versioned binary wire format with nonce values
+ */
+EG_API eg_electionguard_status_t eg_ciphertext_ballot_to_binary_with_nonces(
+  eg_ciphertext_ballot_t *handle, uint8_t **out_data, uint64_t *out_size);
+
 #endif
 
 #ifndef SubmittedBallot
@@ -558,6 +578,20 @@ EG_API eg_electionguard_status_t eg_submitted_ballot_to_msgpack(eg_submitted_bal
                                                                 uint8_t **out_data,
                                                                 uint64_t *out_size);
 
+/**
+ * Import the ballot representation from the versioned binary wire format.
+ * The input buffer is read in place and is not retained by the ballot.
+ */
+EG_API eg_electionguard_status_t eg_submitted_ballot_from_binary(
+  uint8_t *in_data, uint64_t in_length, eg_submitted_ballot_t **out_handle);
+
+/**
+ * Export the ballot representation using the versioned binary wire format
+ */
+EG_API eg_electionguard_status_t eg_submitted_ballot_to_binary(eg_submitted_ballot_t *handle,
+                                                               uint8_t **out_data,
+                                                               uint64_t *out_size);
+
 #endif
 
 #ifdef __cplusplus
@@ -818,10 +818,15 @@ namespace electionguard
         /// Creates a <see cref="CiphertextBallot">CiphertextBallot</see> object from a <see href="https://www.rfc-editor.org/rfc/rfc8259.html#section-8.1">[RFC-8259]</see> UTF-8 encoded JSON string
         /// </summary>
         /// <param name="data">A UTF-8 Encoded JSON data string</param>
+        /// <param name="validateResidues">
+        /// Check that every pad, data and commitment of the ballot is a valid residue,
+        /// throwing when one is not. The elements are validated together in one batch.
+        /// </param>
         /// <returns>
         /// A unique pointer to a <see cref="CiphertextBallot">CiphertextBallot</see> Object
         /// </returns>
-        static std::unique_ptr<CiphertextBallot> fromJson(std::string data);
+        static std::unique_ptr<CiphertextBallot> fromJson(std::string data,
+                                                          bool validateResidues = false);
 
         /// <summary>
         /// Import the ballot representation from BSON
@@ -829,9 +834,27 @@ namespace electionguard
         static std::unique_ptr<CiphertextBallot> fromBson(std::vector<uint8_t> data);
 
         /// <summary>
-        /// Import the ballot representation from MsgPack
+        /// Import the ballot representation from MsgPack, optionally validating
+        /// every group element of the ballot as in `fromJson`
+        /// </summary>
+        static std::unique_ptr<CiphertextBallot> fromMsgPack(std::vector<uint8_t> data,
+                                                             bool validateResidues = false);
+
+        /// <summary>
+        /// Export the ballot representation using the versioned binary wire format
+        /// </summary>
+        std::vector<uint8_t> toBinary(bool withNonces = false) const;
+
+        /// <summary>
+        /// Import the ballot representation from the versioned binary wire format
+        /// </summary>
+        static std::unique_ptr<CiphertextBallot> fromBinary(const std::vector<uint8_t> &data);
+
+        /// <summary>
+        /// Import the ballot representation from the versioned binary wire format
+        /// reading directly from a caller owned buffer without copying it
         /// </summary>
-        static std::unique_ptr<CiphertextBallot> fromMsgPack(std::vector<uint8_t> data);
+        static std::unique_ptr<CiphertextBallot> fromBinary(const uint8_t *data, size_t size);
 
       protected:
         static std::unique_ptr<ElementModQ>
@@ -936,6 +959,22 @@ namespace electionguard
         /// Import the ballot representation from MsgPack
         /// </summary>
         static std::unique_ptr<SubmittedBallot> fromMsgPack(std::vector<uint8_t> data);
+
+        /// <summary>
+        /// Export the ballot representation using the versioned binary wire format
+        /// </summary>
+        std::vector<uint8_t> toBinary() const;
+
+        /// <summary>
+        /// Import the ballot representation from the versioned binary wire format
+        /// </summary>
+        static std::unique_ptr<SubmittedBallot> fromBinary(const std::vector<uint8_t> &data);
+
+        /// <summary>
+        /// Import the ballot representation from the versioned binary wire format
+        /// reading directly from a caller owned buffer without copying it
+        /// </summary>
+        static std::unique_ptr<SubmittedBallot> fromBinary(const uint8_t *data, size_t size);
     };
 
 } // namespace electionguard
@@ -78,6 +78,12 @@ EG_API eg_electionguard_status_t eg_compact_ciphertext_ballot_from_msgpack(
 EG_API eg_electionguard_status_t eg_compact_ciphertext_ballot_to_msgpack(
   eg_compact_ciphertext_ballot_t *handle, uint8_t **out_data, uint64_t *out_size);
 
+EG_API eg_electionguard_status_t eg_compact_ciphertext_ballot_from_binary(
+  uint8_t *in_data, uint64_t in_length, eg_compact_ciphertext_ballot_t **out_handle);
+
+EG_API eg_electionguard_status_t eg_compact_ciphertext_ballot_to_binary(
+  eg_compact_ciphertext_ballot_t *handle, uint8_t **out_data, uint64_t *out_size);
+
 #endif
 
 #ifndef Memory Functions
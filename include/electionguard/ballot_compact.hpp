@@ -226,6 +226,24 @@ namespace electionguard
         /// </summary>
         static std::unique_ptr<CompactCiphertextBallot> fromMsgPack(std::vector<uint8_t> data);
 
+        /// <summary>
+        /// Export the ballot representation using the versioned binary wire format
+        /// </summary>
+        std::vector<uint8_t> toBinary() const;
+
+        /// <summary>
+        /// Import the ballot representation from the versioned binary wire format
+        /// </summary>
+        static std::unique_ptr<CompactCiphertextBallot>
+        fromBinary(const std::vector<uint8_t> &data);
+
+        /// <summary>
+        /// Import the ballot representation from the versioned binary wire format
+        /// reading directly from a caller owned buffer without copying it
+        /// </summary>
+        static std::unique_ptr<CompactCiphertextBallot> fromBinary(const uint8_t *data,
+                                                                   size_t size);
+
       private:
         class Impl;
 #pragma warning(suppress : 4251)
@@ -253,11 +271,30 @@ namespace electionguard
 
     /// <summary>
     /// Expand a compact ciphertext ballot into a ciphertext ballot
+    ///
+    /// <param name="verifyProofs">verify the regenerated proofs. The proofs were verified
+    ///                            by the device that encrypted the ballot and the regenerated
+    ///                            ballot code must still match, so this can be skipped
+    ///                            when rehydrating trusted ballots</param>
     /// </summary>
     EG_API std::unique_ptr<CiphertextBallot>
     expandCompactCiphertextBallot(const CompactCiphertextBallot &compactCiphertext,
                                   const InternalManifest &manifest,
-                                  const CiphertextElectionContext &context);
+                                  const CiphertextElectionContext &context,
+                                  bool verifyProofs = true);
+
+    /// <summary>
+    /// Expand a batch of compact ciphertext ballots that share a manifest and context.
+    /// The ballots are expanded concurrently and returned in the order provided.
+    ///
+    /// <param name="verifyProofs">verify the regenerated proofs of each ballot</param>
+    /// <param name="concurrency">the number of ballots expanded at once,
+    ///                           defaults to the number of hardware threads</param>
+    /// </summary>
+    EG_API std::vector<std::unique_ptr<CiphertextBallot>> expandCompactCiphertextBallots(
+      const std::vector<std::reference_wrapper<const CompactCiphertextBallot>> &compactCiphertexts,
+      const InternalManifest &manifest, const CiphertextElectionContext &context,
+      bool verifyProofs = true, uint32_t concurrency = 0);
 
 } // namespace electionguard
 
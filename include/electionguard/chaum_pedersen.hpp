@@ -8,6 +8,7 @@
 
 #include <map>
 #include <memory>
+#include <vector>
 
 namespace electionguard
 {
@@ -312,6 +313,8 @@ namespace electionguard
         RangedChaumPedersenProof(
           uint64_t rangeLimit, std::unique_ptr<ElementModQ> challenge,
           std::map<uint64_t, std::unique_ptr<ZeroKnowledgeProof>> integer_proofs);
+        RangedChaumPedersenProof(uint64_t rangeLimit, std::unique_ptr<ElementModQ> challenge,
+                                 std::vector<std::unique_ptr<ZeroKnowledgeProof>> integer_proofs);
 
         ~RangedChaumPedersenProof();
 
@@ -342,10 +345,19 @@ namespace electionguard
              uint64_t maxLimit, const ElementModP &k, const ElementModQ &q,
              const std::string &hashPrefix);
 
+        /// <Summary>
+        /// Make a `RangedChaumPedersenProof` deterministically from the seed.
+        ///
+        /// The commitments of the integer proofs are independent of each other, so for
+        /// large range limits they can be computed across several threads. The proof is
+        /// the same for every concurrency.
+        ///
+        /// <param name="concurrency"> The number of threads, zero for the hardware threads</param>
+        /// </Summary>
         static std::unique_ptr<RangedChaumPedersenProof>
         make(const ElGamalCiphertext &message, const ElementModQ &r, uint64_t selected,
              uint64_t maxLimit, const ElementModP &k, const ElementModQ &q,
-             const std::string &hashPrefix, const ElementModQ &seed);
+             const std::string &hashPrefix, const ElementModQ &seed, size_t concurrency = 1);
 
         /// <Summary>
         /// Validates a `RangedChaumPedersenProof`
@@ -353,10 +365,12 @@ namespace electionguard
         /// <param name="message"> The ciphertext message</param>
         /// <param name="k"> The public key of the election</param>
         /// <param name="q"> The extended base hash of the election</param>
+        /// <param name="concurrency"> The number of threads, zero for the hardware threads</param>
         /// <returns> True if everything is consistent. False otherwise. </returns>
         /// </Summary>
         ValidationResult isValid(const ElGamalCiphertext &message, const ElementModP &k,
-                                 const ElementModQ &q, const std::string &hashPrefix);
+                                 const ElementModQ &q, const std::string &hashPrefix,
+                                 size_t concurrency = 1);
 
         // protected:
         //   ValidationResult isValid(const ElGamalCiphertext &message, const ZeroKnowledgeProof &proof,
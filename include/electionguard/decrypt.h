@@ -0,0 +1,71 @@
+#ifndef __ELECTIONGUARD_DECRYPT_H_INCLUDED__
+#define __ELECTIONGUARD_DECRYPT_H_INCLUDED__
+
+#include "constants.h"
+#include "export.h"
+#include "group.h"
+#include "status.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef DecryptionShares
+
+/**
+ * @brief Compute a guardian's partial decryptions of a batch of ciphertexts,
+ * such as a whole tally, together with a Chaum-Pedersen proof for each share.
+ *
+ * All values are passed as contiguous limbs. The ciphertexts and the commitments
+ * are laid out as the pads of every entry followed by the data of every entry.
+ * Elements mod p take MAX_P_LEN limbs and elements mod q take MAX_Q_LEN limbs.
+ * The proof of share i verifies as 𝑎𝑖 = 𝑔^𝑣𝑖 ⋅ 𝐾𝑖^𝑐𝑖 mod 𝑝 and 𝑏𝑖 = 𝐴^𝑣𝑖 ⋅ 𝑀𝑖^𝑐𝑖 mod 𝑝.
+ *
+ * @param[in] in_ciphertexts The ciphertexts, 2 * in_ciphertexts_size * MAX_P_LEN limbs,
+ *            each pad and data in [1, p)
+ * @param[in] in_ciphertexts_size The number of ciphertexts
+ * @param[in] in_secret_key The guardian secret key 𝑠𝑖
+ * @param[in] in_extended_base_hash The extended base hash of the election 𝐻𝐸
+ * @param[in] in_nonce_seed A secret seed for the proof nonces
+ * @param[in] in_concurrency The number of threads to use, zero for the hardware threads
+ * @param[out] out_shares The shares 𝑀𝑖, in_ciphertexts_size * MAX_P_LEN limbs
+ * @param[out] out_commitments The commitments (𝑎𝑖, 𝑏𝑖), 2 * in_ciphertexts_size * MAX_P_LEN limbs
+ * @param[out] out_challenges The challenges 𝑐𝑖, in_ciphertexts_size * MAX_Q_LEN limbs
+ * @param[out] out_responses The responses 𝑣𝑖, in_ciphertexts_size * MAX_Q_LEN limbs
+ * @return eg_electionguard_status_t indicating success or failure,
+ *         ELECTIONGUARD_STATUS_ERROR_INVALID_ARGUMENT when a ciphertext is out of range
+ */
+EG_API eg_electionguard_status_t eg_decryption_shares_compute(
+  const uint64_t *in_ciphertexts, uint64_t in_ciphertexts_size, eg_element_mod_q_t *in_secret_key,
+  eg_element_mod_q_t *in_extended_base_hash, eg_element_mod_q_t *in_nonce_seed,
+  uint64_t in_concurrency, uint64_t *out_shares, uint64_t *out_commitments,
+  uint64_t *out_challenges, uint64_t *out_responses);
+
+/**
+ * @brief Combine the decryption shares of the guardians and decrypt a batch of ciphertexts.
+ *
+ * The shares are laid out guardian by guardian, each guardian holding its share of
+ * every ciphertext in order, MAX_P_LEN limbs each. Every ciphertext is decrypted as
+ * the discrete log of 𝐵 ⋅ (∏ 𝑀𝑖^𝑤𝑖)^−1 mod 𝑝 to the base.
+ *
+ * @param[in] in_ciphertexts The ciphertexts, 2 * in_ciphertexts_size * MAX_P_LEN limbs
+ * @param[in] in_ciphertexts_size The number of ciphertexts
+ * @param[in] in_shares The shares, in_guardians_size * in_ciphertexts_size * MAX_P_LEN limbs
+ * @param[in] in_coefficients The Lagrange coefficient 𝑤𝑖 of each guardian
+ * @param[in] in_guardians_size The number of guardians
+ * @param[in] in_base The base of the plaintext exponent, 𝐺 or the public key 𝐾
+ * @param[in] in_concurrency The number of threads to use, zero for the hardware threads
+ * @param[out] out_plaintexts The plaintext of each ciphertext, in_ciphertexts_size values
+ * @return eg_electionguard_status_t indicating success or failure
+ */
+EG_API eg_electionguard_status_t eg_decryption_shares_combine(
+  const uint64_t *in_ciphertexts, uint64_t in_ciphertexts_size, const uint64_t *in_shares,
+  eg_element_mod_q_t *in_coefficients[], uint64_t in_guardians_size, eg_element_mod_p_t *in_base,
+  uint64_t in_concurrency, uint64_t *out_plaintexts);
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* __ELECTIONGUARD_DECRYPT_H_INCLUDED__ */
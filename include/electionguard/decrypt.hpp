@@ -0,0 +1,160 @@
+#ifndef __ELECTIONGUARD_CPP_DECRYPT_HPP_INCLUDED__
+#define __ELECTIONGUARD_CPP_DECRYPT_HPP_INCLUDED__
+
+#include "chaum_pedersen.hpp"
+#include "elgamal.hpp"
+#include "export.h"
+#include "group.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace electionguard
+{
+    /// <summary>
+    /// A guardian's decryption shares for a batch of ciphertexts together with
+    /// a Chaum-Pedersen proof for each share.
+    ///
+    /// The values are stored in contiguous arrays of limbs:
+    /// the shares 𝑀𝑖 and the commitments 𝑎𝑖 and 𝑏𝑖 take MAX_P_LEN limbs each,
+    /// the challenges 𝑐𝑖 and the responses 𝑣𝑖 take MAX_Q_LEN limbs each.
+    /// Create one with `computeDecryptionShares`.
+    /// </summary>
+    class EG_API DecryptionShareBatch
+    {
+      public:
+        explicit DecryptionShareBatch(size_t size);
+        DecryptionShareBatch(DecryptionShareBatch &&other);
+        ~DecryptionShareBatch();
+
+        DecryptionShareBatch &operator=(DecryptionShareBatch &&rhs);
+
+        /// <summary>
+        /// The number of shares in the batch
+        /// </summary>
+        size_t size() const;
+
+        /// <summary>
+        /// The partial decryption 𝑀𝑖 = 𝐴^𝑠𝑖 mod 𝑝 of the ciphertext at the index
+        /// </summary>
+        const uint64_t *getShare(size_t index) const;
+
+        /// <summary>
+        /// The proof commitment 𝑎𝑖 = 𝑔^𝑢𝑖 mod 𝑝 of the share at the index
+        /// </summary>
+        const uint64_t *getCommitmentPad(size_t index) const;
+
+        /// <summary>
+        /// The proof commitment 𝑏𝑖 = 𝐴^𝑢𝑖 mod 𝑝 of the share at the index
+        /// </summary>
+        const uint64_t *getCommitmentData(size_t index) const;
+
+        /// <summary>
+        /// The proof challenge 𝑐𝑖 of the share at the index
+        /// </summary>
+        const uint64_t *getChallenge(size_t index) const;
+
+        /// <summary>
+        /// The proof response 𝑣𝑖 = (𝑢𝑖 − 𝑐𝑖 ⋅ 𝑠𝑖) mod 𝑞 of the share at the index
+        /// </summary>
+        const uint64_t *getResponse(size_t index) const;
+
+        /// <summary>
+        /// The share of the ciphertext at the index as an element
+        /// </summary>
+        std::unique_ptr<ElementModP> getShareElement(size_t index) const;
+
+        /// <summary>
+        /// The proof of the share at the index
+        /// </summary>
+        std::unique_ptr<ChaumPedersenProof> getProof(size_t index) const;
+
+      protected:
+        uint64_t *getMutableShare(size_t index);
+        uint64_t *getMutableCommitmentPad(size_t index);
+        uint64_t *getMutableCommitmentData(size_t index);
+        uint64_t *getMutableChallenge(size_t index);
+        uint64_t *getMutableResponse(size_t index);
+
+        friend EG_API DecryptionShareBatch computeDecryptionShares(
+          const ElGamalCiphertextBatch &ciphertexts, const ElementModQ &secretKey,
+          const ElementModQ &extendedBaseHash, const ElementModQ &nonceSeed, size_t concurrency);
+
+      private:
+        class Impl;
+#pragma warning(suppress : 4251)
+        std::unique_ptr<Impl> pimpl;
+    };
+
+    /// <summary>
+    /// Compute a guardian's partial decryptions of a whole tally, or of a batch of
+    /// challenged ballots, together with a Chaum-Pedersen proof for each share.
+    ///
+    /// For each ciphertext (𝐴,𝐵) with the guardian key pair (𝑠𝑖, 𝐾𝑖 = 𝑔^𝑠𝑖 mod 𝑝):
+    ///   𝑀𝑖 = 𝐴^𝑠𝑖 mod 𝑝
+    ///   𝑎𝑖 = 𝑔^𝑢𝑖 mod 𝑝, 𝑏𝑖 = 𝐴^𝑢𝑖 mod 𝑝
+    ///   𝑐𝑖 = H(𝐻𝐸;30,𝐾𝑖,𝐴,𝐵,𝑎𝑖,𝑏𝑖,𝑀𝑖)
+    ///   𝑣𝑖 = (𝑢𝑖 − 𝑐𝑖 ⋅ 𝑠𝑖) mod 𝑞
+    /// so that 𝑎𝑖 = 𝑔^𝑣𝑖 ⋅ 𝐾𝑖^𝑐𝑖 mod 𝑝 and 𝑏𝑖 = 𝐴^𝑣𝑖 ⋅ 𝑀𝑖^𝑐𝑖 mod 𝑝.
+    ///
+    /// The proof nonces 𝑢𝑖 = H(seed;30,𝐻𝐸,𝐾𝑖,𝐴,𝐵) are derived from the nonce seed and
+    /// the ciphertext itself, so a ciphertext always receives the same nonce and challenge
+    /// and two different ciphertexts never share a nonce, whichever batch they are in.
+    /// The commitments 𝑔^𝑢𝑖 are computed with the fixed base table of 𝑔 and the batch
+    /// is split across threads. Throws invalid_argument when a pad or data is not in [1, p).
+    ///
+    /// <param name="ciphertexts">the ciphertexts to decrypt, each pad and data in [1, p)</param>
+    /// <param name="secretKey">the guardian secret key 𝑠𝑖</param>
+    /// <param name="extendedBaseHash">the extended base hash of the election 𝐻𝐸</param>
+    /// <param name="nonceSeed">a secret seed for the proof nonces</param>
+    /// <param name="concurrency">the number of threads, zero for the hardware threads</param>
+    /// <returns>the shares and their proofs in the order of the ciphertexts</returns>
+    /// </summary>
+    EG_API DecryptionShareBatch computeDecryptionShares(const ElGamalCiphertextBatch &ciphertexts,
+                                                        const ElementModQ &secretKey,
+                                                        const ElementModQ &extendedBaseHash,
+                                                        const ElementModQ &nonceSeed,
+                                                        size_t concurrency = 0);
+
+    /// <summary>
+    /// Combine the decryption shares of the guardians and decrypt every ciphertext of a batch.
+    ///
+    /// For each ciphertext (𝐴,𝐵) and the shares 𝑀𝑖 of the guardians with the
+    /// Lagrange coefficients 𝑤𝑖 from `Polynomial::interpolate`:
+    ///   𝑀 = ∏ 𝑀𝑖^𝑤𝑖 mod 𝑝
+    ///   𝑇 = 𝐵 ⋅ 𝑀^−1 mod 𝑝
+    /// and the plaintext is the discrete log of 𝑇 to the base.
+    ///
+    /// The products are computed with a multi-exponentiation, the accumulations of each
+    /// group of ciphertexts are inverted together and the discrete logs of the whole batch
+    /// are resolved against the shared discrete log cache.
+    ///
+    /// <param name="ciphertexts">the ciphertexts to decrypt</param>
+    /// <param name="shares">for each guardian, its shares of every ciphertext in order</param>
+    /// <param name="coefficients">the Lagrange coefficient of each guardian</param>
+    /// <param name="base">the base of the plaintext exponent, 𝐺 or the public key 𝐾</param>
+    /// <param name="concurrency">the number of threads, zero for the hardware threads</param>
+    /// <returns>the plaintext of each ciphertext</returns>
+    /// </summary>
+    EG_API std::vector<uint64_t> combineDecryptionShares(
+      const ElGamalCiphertextBatch &ciphertexts,
+      const std::vector<std::reference_wrapper<const DecryptionShareBatch>> &shares,
+      const std::vector<std::reference_wrapper<const ElementModQ>> &coefficients,
+      const ElementModP &base, size_t concurrency = 0);
+
+    /// <summary>
+    /// Combine the decryption shares of the guardians and decrypt every ciphertext of a batch.
+    ///
+    /// Each pointer of the shares holds the shares of one guardian for every ciphertext,
+    /// contiguously and MAX_P_LEN limbs each.
+    /// </summary>
+    EG_API std::vector<uint64_t> combineDecryptionShares(
+      const ElGamalCiphertextBatch &ciphertexts, const std::vector<const uint64_t *> &shares,
+      const std::vector<std::reference_wrapper<const ElementModQ>> &coefficients,
+      const ElementModP &base, size_t concurrency = 0);
+
+} // namespace electionguard
+
+#endif /* __ELECTIONGUARD_CPP_DECRYPT_HPP_INCLUDED__ */
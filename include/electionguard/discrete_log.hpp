@@ -8,9 +8,11 @@
 
 #include <array>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace electionguard
 {
@@ -87,9 +89,22 @@ namespace electionguard
         /// </Summary>
         static uint64_t getAsync(const ElementModP &element, const ElementModP &base);
 
+        /// <Summary>
+        /// Get the discrete log values for several elements using the specified base.
+        ///
+        /// Elements missing from the cache are resolved together, so the cache is
+        /// extended once up to the largest value of the batch instead of once per element.
+        /// </Summary>
+        static std::vector<uint64_t>
+        getAsync(const std::vector<std::reference_wrapper<const ElementModP>> &elements,
+                 const ElementModP &base);
+
       protected:
         uint64_t computeCache(const ElementModP &element);
         uint64_t computeCache(const ElementModP &element, const ElementModP &base);
+        void computeCache(const std::vector<std::reference_wrapper<const ElementModP>> &elements,
+                          const ElementModP &base, std::vector<uint64_t> &results,
+                          const std::vector<size_t> &missing);
 
       private:
         AsyncSemaphore task_lock;
@@ -300,6 +300,74 @@ namespace electionguard
     elgamalEncrypt(uint64_t m, const ElementModP &publicKey,
                    const PrecomputedEncryption &precomputedValues);
 
+    /// <summary>
+    /// A batch of ElGamal ciphertexts stored in one contiguous array of limbs.
+    /// The pads of every ciphertext come first followed by the data of every ciphertext,
+    /// each value taking MAX_P_LEN limbs. Create one with `elgamalEncryptBatch`.
+    /// </summary>
+    class EG_API ElGamalCiphertextBatch
+    {
+      public:
+        explicit ElGamalCiphertextBatch(size_t size);
+        ElGamalCiphertextBatch(ElGamalCiphertextBatch &&other);
+        ~ElGamalCiphertextBatch();
+
+        ElGamalCiphertextBatch &operator=(ElGamalCiphertextBatch &&rhs);
+
+        /// <summary>
+        /// The number of ciphertexts in the batch
+        /// </summary>
+        size_t size() const;
+
+        /// <summary>
+        /// The limbs of the pad of the ciphertext at the index
+        /// </summary>
+        uint64_t *getPad(size_t index);
+
+        /// <summary>
+        /// The limbs of the pad of the ciphertext at the index
+        /// </summary>
+        const uint64_t *getPad(size_t index) const;
+
+        /// <summary>
+        /// The limbs of the data of the ciphertext at the index
+        /// </summary>
+        uint64_t *getData(size_t index);
+
+        /// <summary>
+        /// The limbs of the data of the ciphertext at the index
+        /// </summary>
+        const uint64_t *getData(size_t index) const;
+
+        /// <summary>
+        /// Copy the ciphertext at the index out of the batch
+        /// </summary>
+        std::unique_ptr<ElGamalCiphertext> getCiphertext(size_t index) const;
+
+      private:
+        class Impl;
+#pragma warning(suppress : 4251)
+        std::unique_ptr<Impl> pimpl;
+    };
+
+    /// <summary>
+    /// Encrypts several messages with their random nonces under the same ElGamal public key
+    /// using the "base-K" method.
+    ///
+    /// The exponentiations of every message are walked through the fixed base tables
+    /// together, which is considerably faster than calling `elgamalEncrypt` for each
+    /// message when a ballot has many selections.
+    ///
+    /// <param name="messages">Messages to encrypt; each must be an integer in [0,Q).</param>
+    /// <param name="nonces">A randomly chosen nonce in [1,Q) for each message.</param>
+    /// <param name="publicKey">ElGamal public key. (K in the spec)</param>
+    /// <returns>The ciphertexts in the order of the messages.</returns>
+    /// </summary>
+    EG_API ElGamalCiphertextBatch
+    elgamalEncryptBatch(const std::vector<uint64_t> &messages,
+                        const std::vector<std::reference_wrapper<const ElementModQ>> &nonces,
+                        const ElementModP &publicKey);
+
     /// <summary>
     /// Homomorphically accumulates one or more ElGamal ciphertexts by pairwise multiplication.
     /// The exponents of vote counters will add.
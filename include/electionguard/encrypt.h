@@ -181,6 +181,62 @@ EG_API eg_electionguard_status_t eg_encryption_mediator_encrypt_ballot_verify_pr
   eg_encryption_mediator_t *handle, eg_plaintext_ballot_t *in_plaintext,
   bool in_use_precomputed_values, eg_ciphertext_ballot_t **out_ciphertext_handle);
 
+/**
+ * @brief The serialized forms of the ballots passed to and from the batch encryption functions
+ */
+typedef enum eg_ballot_serialization_e {
+    /** UTF-8 encoded JSON */
+    ELECTIONGUARD_BALLOT_SERIALIZATION_JSON = 0,
+    /** BSON */
+    ELECTIONGUARD_BALLOT_SERIALIZATION_BSON = 1,
+    /** MessagePack */
+    ELECTIONGUARD_BALLOT_SERIALIZATION_MSGPACK = 2,
+    /** the versioned binary wire format, only available for ciphertext ballots */
+    ELECTIONGUARD_BALLOT_SERIALIZATION_BINARY = 3,
+} eg_ballot_serialization_t;
+
+/**
+* Encrypt a batch of serialized ballots and write the serialized ciphertexts into
+* a buffer owned by the caller.
+*
+* The plaintexts are read from one contiguous buffer, where ballot `i` spans the bytes
+* [in_plaintext_offsets[i], in_plaintext_offsets[i + 1]), so the offsets hold `in_count + 1`
+* entries. The ballots are encrypted natively with `in_concurrency` ballots in flight and
+* are chained in the order of the buffer, exactly as if each ballot was encrypted in turn.
+*
+* The ciphertexts are written to `out_arena` in the same layout, ciphertext `i` spanning the
+* bytes [out_offsets[i], out_offsets[i + 1]) so `out_offsets` must hold `in_count + 1` entries.
+* JSON ciphertexts are not null terminated.
+*
+* When the ciphertexts do not fit in the arena nothing is written, the ballot chain of the
+* mediator is rolled back so the batch can be submitted again with a larger arena, and
+* `ELECTIONGUARD_STATUS_ERROR_OUT_OF_RANGE` is returned. A second attempt encrypts with new
+* nonces, so sizes of the text formats can differ slightly from `out_required_size`.
+*
+* @param[in] in_plaintexts the serialized plaintext ballots
+* @param[in] in_plaintext_offsets the offset of each plaintext ballot followed by the total size
+* @param[in] in_count the number of ballots
+* @param[in] in_plaintext_format the serialization of the plaintexts, JSON, BSON or MessagePack
+* @param[in] in_ciphertext_format the serialization of the ciphertexts
+* @param[in] in_should_verify_proofs specify if the proofs should be verified prior to returning
+* @param[in] in_use_precomputed_values True if the mediator should use the precomputed values
+* @param[in] in_concurrency the number of ballots encrypted at once, zero for the hardware threads
+* @param[out] out_arena the buffer the serialized ciphertexts are written to
+* @param[in] in_arena_size the size of the arena in bytes
+* @param[out] out_offsets the offset of each ciphertext ballot followed by the total size
+* @param[out] out_required_size the number of bytes the ciphertexts take in the arena
+* @return eg_electionguard_status_t indicating success or failure
+* @retval ELECTIONGUARD_STATUS_SUCCESS The ciphertexts were written to the arena
+* @retval ELECTIONGUARD_STATUS_ERROR_OUT_OF_RANGE The arena is too small for the ciphertexts
+* @retval ELECTIONGUARD_STATUS_ERROR_INVALID_ARGUMENT A plaintext or a format is invalid
+*/
+EG_API eg_electionguard_status_t eg_encryption_mediator_encrypt_ballots(
+  eg_encryption_mediator_t *handle, const uint8_t *in_plaintexts,
+  const uint64_t *in_plaintext_offsets, uint64_t in_count,
+  eg_ballot_serialization_t in_plaintext_format, eg_ballot_serialization_t in_ciphertext_format,
+  bool in_should_verify_proofs, bool in_use_precomputed_values, uint32_t in_concurrency,
+  uint8_t *out_arena, uint64_t in_arena_size, uint64_t *out_offsets, uint64_t *out_required_size);
+
 #endif
 
 #ifndef Encryption Functions
@@ -9,6 +9,7 @@
 #include "manifest.hpp"
 #include "nonces.hpp"
 
+#include <functional>
 #include <memory>
 
 using std::string;
@@ -126,6 +127,37 @@ namespace electionguard
         std::unique_ptr<CompactCiphertextBallot> compactEncrypt(const PlaintextBallot &ballot,
                                                                 bool verifyProofs = true) const;
 
+        /// <summary>
+        /// Encrypt a batch of ballots using the cached election context.
+        ///
+        /// The contests of each ballot are encrypted concurrently, since they do not depend on
+        /// the ballot chain. The chained ballot code step is then applied in submission order,
+        /// so the returned ballots are chained exactly as if `encrypt` was called for each ballot
+        /// in turn. Subsequent calls to `encrypt` continue the same chain.
+        ///
+        /// <param name="ballots">the ballots to encrypt, in submission order</param>
+        /// <param name="verifyProofs">verify the proofs of each ballot before returning</param>
+        /// <param name="usePrecomputedValues">use values from the `PrecomputeBufferContext`</param>
+        /// <param name="concurrency">the number of ballots encrypted at once,
+        ///                           defaults to the number of hardware threads</param>
+        /// <returns>the encrypted ballots in submission order</returns>
+        /// </summary>
+        std::vector<std::unique_ptr<CiphertextBallot>>
+        encryptBatch(const std::vector<std::reference_wrapper<const PlaintextBallot>> &ballots,
+                     bool verifyProofs = true, bool usePrecomputedValues = false,
+                     uint32_t concurrency = 0) const;
+
+        /// <summary>
+        /// The ballot code that the next ballot encrypted by the mediator is chained to
+        /// </summary>
+        std::unique_ptr<ElementModQ> getBallotCodeSeed() const;
+
+        /// <summary>
+        /// Continue the ballot chain from the specified ballot code, such as to roll the chain
+        /// back over ballots that were encrypted but discarded before they were published
+        /// </summary>
+        void setBallotCodeSeed(const ElementModQ &ballotCodeSeed);
+
       private:
         class Impl;
         std::unique_ptr<Impl> pimpl;
@@ -27,6 +27,24 @@ EG_API eg_electionguard_status_t eg_element_mod_p_new_unchecked(const uint64_t i
 EG_API eg_electionguard_status_t eg_element_mod_p_new_bytes(uint8_t *in_data, uint64_t in_size,
                                                             eg_element_mod_p_t **out_handle);
 
+/**
+ * @brief Create a read-only element over limbs owned by the caller without copying them,
+ * such as a pinned managed array or a memory mapped record. The handle is accepted by every
+ * function that takes an `eg_element_mod_p_t` and is released with `eg_element_mod_p_free`.
+ *
+ * @param[in] in_data MAX_P_LEN limbs that must outlive the handle and must not change
+ * @param[out] out_handle a handle to the borrowed element. Caller is responsible for lifecycle.
+ */
+EG_API eg_electionguard_status_t eg_element_mod_p_borrow(const uint64_t *in_data,
+                                                         eg_element_mod_p_t **out_handle);
+
+/**
+ * @brief Create a read-only element over limbs owned by the caller without copying
+ * or checking them, see `eg_element_mod_p_borrow`
+ */
+EG_API eg_electionguard_status_t eg_element_mod_p_borrow_unchecked(const uint64_t *in_data,
+                                                                   eg_element_mod_p_t **out_handle);
+
 EG_API eg_electionguard_status_t eg_element_mod_p_free(eg_element_mod_p_t *handle);
 
 EG_API eg_electionguard_status_t eg_element_mod_p_get_data(eg_element_mod_p_t *handle,
@@ -66,6 +84,24 @@ EG_API eg_electionguard_status_t eg_element_mod_q_new_unchecked(const uint64_t i
 EG_API eg_electionguard_status_t eg_element_mod_q_new_bytes(uint8_t *in_data, uint64_t in_size,
                                                             eg_element_mod_q_t **out_handle);
 
+/**
+ * @brief Create a read-only element over limbs owned by the caller without copying them,
+ * such as a pinned managed array or a memory mapped record. The handle is accepted by every
+ * function that takes an `eg_element_mod_q_t` and is released with `eg_element_mod_q_free`.
+ *
+ * @param[in] in_data MAX_Q_LEN limbs that must outlive the handle and must not change
+ * @param[out] out_handle a handle to the borrowed element. Caller is responsible for lifecycle.
+ */
+EG_API eg_electionguard_status_t eg_element_mod_q_borrow(const uint64_t *in_data,
+                                                         eg_element_mod_q_t **out_handle);
+
+/**
+ * @brief Create a read-only element over limbs owned by the caller without copying
+ * or checking them, see `eg_element_mod_q_borrow`
+ */
+EG_API eg_electionguard_status_t eg_element_mod_q_borrow_unchecked(const uint64_t *in_data,
+                                                                   eg_element_mod_q_t **out_handle);
+
 EG_API eg_electionguard_status_t eg_element_mod_q_free(eg_element_mod_q_t *handle);
 
 EG_API eg_electionguard_status_t eg_element_mod_q_get_data(eg_element_mod_q_t *handle,
@@ -157,6 +193,18 @@ EG_API eg_electionguard_status_t eg_element_mod_q_pow_mod_p(eg_element_mod_p_t *
                                                             eg_element_mod_q_t *exponent,
                                                             eg_element_mod_p_t **out_handle);
 
+/**
+ * @brief Validate that each of a contiguous array of elements is in Z^r_p, reading the
+ * caller's limbs in place so no handle is created for any element.
+ *
+ * @param[in] in_data the limbs of the elements, MAX_P_LEN limbs each
+ * @param[in] in_count the number of elements
+ * @param[out] out_values the result for each element, `in_count` values written in order
+ */
+EG_API eg_electionguard_status_t eg_element_mod_p_is_valid_residue_batch(const uint64_t *in_data,
+                                                                         uint64_t in_count,
+                                                                         bool *out_values);
+
 #endif
 
 #ifndef ElementModQ Group Math Functions
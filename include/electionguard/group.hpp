@@ -5,6 +5,7 @@
 #include "export.h"
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
 #include <variant>
@@ -42,6 +43,7 @@ namespace electionguard
         /// <Summary>
         /// Get the integer representation of the element
         /// Note the Element is stored in HACL format
+        /// and any cached representation is discarded since the caller may mutate it
         /// <returns> a pointer to the first limb. </returns>
         /// </Summary>
         uint64_t *get() const;
@@ -49,9 +51,28 @@ namespace electionguard
         /// <Summary>
         /// Get the integer representation of the element as a reference
         /// Note the Element is stored in HACL format
+        /// and any cached representation is discarded since the caller may mutate it
         /// <Summary>
         uint64_t (&ref() const)[MAX_P_LEN];
 
+        /// <Summary>
+        /// Get a read only view of the integer representation of the element
+        /// that leaves any cached representation intact
+        /// <returns> a pointer to the first limb. </returns>
+        /// </Summary>
+        const uint64_t *cget() const;
+
+        /// <Summary>
+        /// Get a read only view of the integer representation of the element as a reference
+        /// that leaves any cached representation intact
+        /// <Summary>
+        const uint64_t (&cref() const)[MAX_P_LEN];
+
+        /// <Summary>
+        /// Whether the element still reads limbs owned by the caller, see `borrow`
+        /// </Summary>
+        bool isBorrowed() const;
+
         ///<Summary>
         /// Get the length of the element
         /// <returns> the length of the element </returns>
@@ -87,6 +108,22 @@ namespace electionguard
 
         void setIsFixedBase(bool fixedBase) const;
 
+        /// <Summary>
+        /// Opt in to caching the hex and bytes representations of the element.
+        /// Intended for long lived values that are hashed or serialized repeatedly.
+        /// Fixed base elements are always cacheable.
+        /// </Summary>
+        void setIsCacheable(bool cacheable) const;
+
+        bool isCacheable() const;
+
+        /// <Summary>
+        /// Mark the element as secret. A secret element never caches a representation.
+        /// </Summary>
+        void setIsSecret(bool secret) const;
+
+        bool isSecret() const;
+
         /// <summary>
         /// Converts the binary value stored by the hex string in Big Endian format
         /// to its big num representation stored as ElementModP
@@ -102,8 +139,17 @@ namespace electionguard
         static std::unique_ptr<ElementModP> fromUint64(uint64_t representation,
                                                        bool unchecked = false);
 
+        /// <summary>
+        /// Creates an element that reads limbs owned by the caller in place instead of copying
+        /// them, such as a pinned managed array or a memory mapped record. The limbs must outlive
+        /// the element and must not change while it is in use. They are only copied into the
+        /// element if it is mutated through `get` or `ref`.
+        /// </summary>
+        static std::unique_ptr<ElementModP> borrow(const uint64_t *limbs, bool unchecked = false);
+
       private:
         class Impl;
+        explicit ElementModP(Impl *impl);
 #pragma warning(suppress : 4251)
         std::unique_ptr<Impl> pimpl;
     };
@@ -135,12 +181,27 @@ namespace electionguard
         /// <Summary>
         /// Get the integer representation of the element
         /// Note the Element is stored in HACL format
+        /// and any cached representation is discarded since the caller may mutate it
         /// <returns> a pointer to the first limb</returns>
         /// </Summary>
         uint64_t *get() const;
 
         uint64_t (&ref() const)[MAX_Q_LEN];
 
+        /// <Summary>
+        /// Get a read only view of the integer representation of the element
+        /// that leaves any cached representation intact
+        /// <returns> a pointer to the first limb</returns>
+        /// </Summary>
+        const uint64_t *cget() const;
+
+        const uint64_t (&cref() const)[MAX_Q_LEN];
+
+        /// <Summary>
+        /// Whether the element still reads limbs owned by the caller, see `borrow`
+        /// </Summary>
+        bool isBorrowed() const;
+
         uint64_t length() const;
 
         /// <Summary>
@@ -163,6 +224,21 @@ namespace electionguard
         /// </Summary>
         std::unique_ptr<ElementModQ> clone() const;
 
+        /// <Summary>
+        /// Opt in to caching the hex and bytes representations of the element.
+        /// Intended for long lived values that are hashed or serialized repeatedly.
+        /// </Summary>
+        void setIsCacheable(bool cacheable) const;
+
+        bool isCacheable() const;
+
+        /// <Summary>
+        /// Mark the element as secret. A secret element never caches a representation.
+        /// </Summary>
+        void setIsSecret(bool secret) const;
+
+        bool isSecret() const;
+
         /// <summary>
         /// Converts the binary value stored by the hex string
         /// to its big num representation stored as ElementModQ
@@ -178,6 +254,14 @@ namespace electionguard
         static std::unique_ptr<ElementModQ> fromUint64(uint64_t representation,
                                                        bool unchecked = false);
 
+        /// <summary>
+        /// Creates an element that reads limbs owned by the caller in place instead of copying
+        /// them, such as a pinned managed array or a memory mapped record. The limbs must outlive
+        /// the element and must not change while it is in use. They are only copied into the
+        /// element if it is mutated through `get` or `ref`.
+        /// </summary>
+        static std::unique_ptr<ElementModQ> borrow(const uint64_t *limbs, bool unchecked = false);
+
         /// <Summary>
         /// create a copy of the Element in ElementModP space
         /// </Summary>
@@ -185,6 +269,7 @@ namespace electionguard
 
       private:
         class Impl;
+        explicit ElementModQ(Impl *impl);
 #pragma warning(suppress : 4251)
         std::unique_ptr<Impl> pimpl;
     };
@@ -244,6 +329,16 @@ namespace electionguard
     EG_API std::unique_ptr<ElementModP> div_mod_p(const ElementModP &numerator,
                                                   const ElementModP &denominator);
 
+    /// <summary>
+    /// Computes numerator * (denominator^-1) mod p for each pair of MAX_P_LEN limbs
+    /// and writes the results contiguously into the results array.
+    ///
+    /// All of the denominators are inverted with a single modular inversion
+    /// and three multiplications per pair.
+    /// </summary>
+    EG_API void div_mod_p_batch(const uint64_t *numerators, const uint64_t *denominators,
+                                size_t count, uint64_t *results);
+
     /// <summary>
     /// computes element mod p
     /// </summary>
@@ -255,26 +350,109 @@ namespace electionguard
     EG_API std::unique_ptr<ElementModP> pow_mod_p(const ElementModP &base,
                                                   const ElementModP &exponent);
 
+    /// <summary>
+    /// How an exponentiation of a fixed base walks its lookup table
+    /// </summary>
+    enum class FixedBaseTiming {
+        /// <summary>
+        /// the timing selected for every call with `set_constant_time_fixed_base`
+        /// </summary>
+        configured,
+        /// <summary>
+        /// skips the zero windows of the exponent and reads only the entries it multiplies
+        /// </summary>
+        variableTime,
+        /// <summary>
+        /// multiplies every window and reads every entry of each row, so neither the time
+        /// taken nor the memory accessed depends on the exponent. use for secret nonces.
+        /// </summary>
+        constantTime
+    };
+
     /// <summary>
     /// Computes b^e mod p.
+    ///
+    /// When the base is a fixed base, the timing selects whether the exponentiation
+    /// runs in constant time. Other bases are unaffected by the timing.
     /// </summary>
-    EG_API std::unique_ptr<ElementModP> pow_mod_p(const ElementModP &base,
-                                                  const ElementModQ &exponent);
+    EG_API std::unique_ptr<ElementModP>
+    pow_mod_p(const ElementModP &base, const ElementModQ &exponent,
+              FixedBaseTiming timing = FixedBaseTiming::configured);
 
     /// <summary>
     /// Computes b^e mod p.
     /// </summary>
     EG_API std::unique_ptr<ElementModP> pow_mod_p(const ElementModP &base, uint64_t exponent);
 
+    /// <summary>
+    /// Computes b^e mod p for each exponent and writes the results contiguously,
+    /// MAX_P_LEN limbs per exponent, into the results array.
+    ///
+    /// When the base is a fixed base, the table walks of several exponents are interleaved
+    /// so that the reads of the table overlap the multiplications.
+    /// </summary>
+    EG_API void
+    pow_mod_p_batch(const ElementModP &base,
+                    const std::vector<std::reference_wrapper<const ElementModQ>> &exponents,
+                    uint64_t *results, FixedBaseTiming timing = FixedBaseTiming::configured);
+
+    /// <summary>
+    /// Computes b0^e0 ⋅ b1^e1 ⋯ mod p.
+    ///
+    /// The terms are exponentiated together over a single chain of squarings,
+    /// which is considerably faster than multiplying the result of `pow_mod_p` for each term.
+    /// </summary>
+    EG_API std::unique_ptr<ElementModP>
+    pow_mod_p_multi(const std::vector<std::reference_wrapper<const ElementModP>> &bases,
+                    const std::vector<std::reference_wrapper<const ElementModQ>> &exponents);
+
+    /// <summary>
+    /// Validates that each element is in Z^r_p, the same as calling `isValidResidue`
+    /// on each element, and returns the result of each element in order.
+    ///
+    /// The elements are checked together with a randomized product: for random 64-bit
+    /// weights w_i, (∏ x_i^w_i)^q mod p is one when every element is in the subgroup and,
+    /// except with probability 2^-63, is not one otherwise. Since p − 1 = 2qr for a prime r,
+    /// the order two component of each element is checked separately with its Jacobi symbol.
+    /// When the product fails, every element is checked on its own.
+    /// </summary>
+    EG_API std::vector<bool>
+    is_valid_residue_batch(const std::vector<std::reference_wrapper<const ElementModP>> &elements);
+
+    /// <summary>
+    /// Registers a base with the shared fixed base cache, so that `pow_mod_p` uses a lookup table
+    /// for every element of the same value, however the element was constructed.
+    /// The election context registers its public key and the generator when it is created.
+    /// </summary>
+    EG_API void register_fixed_base(const ElementModP &base);
+
+    /// <summary>
+    /// Whether `pow_mod_p` uses a lookup table for the base, either because the element
+    /// is flagged as a fixed base or because its value is registered with `register_fixed_base`.
+    /// </summary>
+    EG_API bool is_fixed_base(const ElementModP &base);
+
+    /// <summary>
+    /// Exponentiate every fixed base in constant time, unless a call selects its own timing.
+    /// Disabled by default, since the constant time walk reads every entry of each table row.
+    /// </summary>
+    EG_API void set_constant_time_fixed_base(bool enabled);
+
+    /// <summary>
+    /// Whether fixed bases are exponentiated in constant time by default
+    /// </summary>
+    EG_API bool is_constant_time_fixed_base();
+
     /// <summary>
     /// Computes g^e mod p.
     /// </summary>
     EG_API std::unique_ptr<ElementModP> g_pow_p(const ElementModP &exponent);
 
     /// <summary>
-    /// Computes g^e mod p.
+    /// Computes g^e mod p, in constant time when the timing selects it.
     /// </summary>
-    EG_API std::unique_ptr<ElementModP> g_pow_p(const ElementModQ &exponent);
+    EG_API std::unique_ptr<ElementModP>
+    g_pow_p(const ElementModQ &exponent, FixedBaseTiming timing = FixedBaseTiming::configured);
 
     /// <summary>
     /// Adds together the left hand side and right hand side and returns the sum mod Q
@@ -259,6 +259,18 @@ namespace electionguard
     /// <returns>A cryptographic hash of these elements, concatenated.</returns>
     /// </Summary>
     EG_API std::unique_ptr<ElementModQ> hash_elems(CryptoHashableType a);
+
+    /// <Summary>
+    /// Calculate the hashes of independent lists of elements in one batch.
+    /// Each result is the same as calling `hash_elems` with the corresponding list,
+    /// but the underlying SHA256 computations run together in parallel lanes
+    /// when the cpu supports it.
+
+    /// <param name="a"> The lists of elements to hash independently.</param>
+    /// <returns>The hash of each list, in the same order as the lists.</returns>
+    /// </Summary>
+    EG_API std::vector<std::unique_ptr<ElementModQ>>
+    hash_elems_batch(const std::vector<std::vector<CryptoHashableType>> &a);
 } // namespace electionguard
 
 #endif /* __ELECTIONGUARD_CPP_HASH_HPP_INCLUDED__ */
@@ -0,0 +1,79 @@
+/// @file metrics.h
+#ifndef __ELECTIONGUARD_CPP_METRICS_H_INCLUDED__
+#define __ELECTIONGUARD_CPP_METRICS_H_INCLUDED__
+
+#include "export.h"
+#include "status.h"
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief The hot path events counted by the library.
+ * The values index the array written by `eg_metrics_snapshot`.
+ */
+typedef enum eg_metric_e {
+    ELECTIONGUARD_METRIC_POW_MOD_P_FULL = 0,
+    ELECTIONGUARD_METRIC_POW_MOD_P_TABLE = 1,
+    ELECTIONGUARD_METRIC_POW_MOD_Q = 2,
+    ELECTIONGUARD_METRIC_LOOKUP_TABLE_BUILDS = 3,
+    ELECTIONGUARD_METRIC_PRECOMPUTE_HITS = 4,
+    ELECTIONGUARD_METRIC_PRECOMPUTE_MISSES = 5,
+    ELECTIONGUARD_METRIC_DISCRETE_LOG_CACHE_HITS = 6,
+    ELECTIONGUARD_METRIC_DISCRETE_LOG_CACHE_MISSES = 7,
+    ELECTIONGUARD_METRIC_HASH_INVOCATIONS = 8,
+    ELECTIONGUARD_METRIC_HASH_BYTES = 9,
+    ELECTIONGUARD_METRIC_ELEMENT_ALLOCATIONS = 10,
+} eg_metric_t;
+
+/**
+ * @brief Get the number of metrics written by a full snapshot
+ */
+EG_API uint64_t eg_metrics_get_count();
+
+/**
+ * @brief Get the stable name of a metric, suitable for exporting to monitoring.
+ * The string is owned by the library and must not be freed.
+ *
+ * @param[in] in_metric the metric
+ * @return the name, or NULL if the metric is unknown
+ */
+EG_API const char *eg_metrics_get_name(eg_metric_t in_metric);
+
+/**
+ * @brief Get the count of a metric across all threads since the last reset
+ *
+ * @param[in] in_metric the metric
+ * @param[out] out_value the count
+ * @return eg_electionguard_status_t indicating success or failure
+ */
+EG_API eg_electionguard_status_t eg_metrics_get(eg_metric_t in_metric, uint64_t *out_value);
+
+/**
+ * @brief Copy the count of every metric across all threads since the last reset.
+ * The counts are read together and indexed by `eg_metric_t`.
+ *
+ * When the capacity is smaller than the number of metrics only the first
+ * `in_capacity` counts are written.
+ *
+ * @param[out] out_values a caller allocated array of at least `in_capacity` counts
+ * @param[in] in_capacity the length of `out_values`
+ * @param[out] out_count the number of counts written
+ * @return eg_electionguard_status_t indicating success or failure
+ */
+EG_API eg_electionguard_status_t eg_metrics_snapshot(uint64_t *out_values, uint64_t in_capacity,
+                                                     uint64_t *out_count);
+
+/**
+ * @brief Start counting every metric from zero
+ */
+EG_API eg_electionguard_status_t eg_metrics_reset();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ELECTIONGUARD_CPP_METRICS_H_INCLUDED__ */
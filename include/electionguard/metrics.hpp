@@ -0,0 +1,105 @@
+#ifndef __ELECTIONGUARD_CPP_METRICS_HPP_INCLUDED__
+#define __ELECTIONGUARD_CPP_METRICS_HPP_INCLUDED__
+
+#include "export.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace electionguard
+{
+    /// <summary>
+    /// The hot path events counted by the library
+    /// </summary>
+    enum class Metric : uint32_t {
+        /// <summary>
+        /// pow_mod_p computed with a full modular exponentiation
+        /// </summary>
+        powModPFull = 0,
+        /// <summary>
+        /// pow_mod_p served by a fixed base lookup table
+        /// </summary>
+        powModPTable = 1,
+        /// <summary>
+        /// pow_mod_q computed with a full modular exponentiation
+        /// </summary>
+        powModQ = 2,
+        /// <summary>
+        /// Fixed base lookup tables generated
+        /// </summary>
+        lookupTableBuilds = 3,
+        /// <summary>
+        /// Precomputed values taken from a precompute buffer
+        /// </summary>
+        precomputeHits = 4,
+        /// <summary>
+        /// Requests for precomputed values that found the buffer empty
+        /// and fell back to generating the values in real time
+        /// </summary>
+        precomputeMisses = 5,
+        /// <summary>
+        /// Discrete logs found in the cache
+        /// </summary>
+        discreteLogCacheHits = 6,
+        /// <summary>
+        /// Discrete logs that extended the cache
+        /// </summary>
+        discreteLogCacheMisses = 7,
+        /// <summary>
+        /// Messages digested by hash_elems
+        /// </summary>
+        hashInvocations = 8,
+        /// <summary>
+        /// Bytes digested by hash_elems
+        /// </summary>
+        hashBytes = 9,
+        /// <summary>
+        /// ElementModP and ElementModQ values allocated
+        /// </summary>
+        elementAllocations = 10,
+    };
+
+    /// <summary>
+    /// A process wide registry of hot path counters.
+    ///
+    /// Each thread counts into its own block, so recording an event is a plain
+    /// thread local add. Reading the counters sums every thread's block, including
+    /// the totals of threads that have exited.
+    /// </summary>
+    class EG_API Metrics
+    {
+      public:
+        static constexpr size_t COUNT = 11;
+
+        typedef std::array<uint64_t, COUNT> Snapshot;
+
+        /// <summary>
+        /// Record occurrences of an event on the calling thread
+        /// </summary>
+        static void increment(Metric metric, uint64_t amount = 1);
+
+        /// <summary>
+        /// Get the count of an event across all threads since the last reset
+        /// </summary>
+        static uint64_t get(Metric metric);
+
+        /// <summary>
+        /// Get the counts of every event across all threads since the last reset,
+        /// indexed by the Metric value
+        /// </summary>
+        static Snapshot snapshot();
+
+        /// <summary>
+        /// Start counting every event from zero
+        /// </summary>
+        static void reset();
+
+        /// <summary>
+        /// Get the stable name of an event, suitable for exporting to monitoring
+        /// </summary>
+        static const char *getName(Metric metric);
+    };
+} // namespace electionguard
+
+#endif /* __ELECTIONGUARD_CPP_METRICS_HPP_INCLUDED__ */
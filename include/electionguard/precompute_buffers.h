@@ -62,9 +62,9 @@ eg_precompute_buffer_context_initialize(eg_element_mod_p_t *in_public_key, uint3
 EG_API eg_electionguard_status_t eg_precompute_buffer_context_start();
 
 /**
- * @brief Start a new precompute buffer context.  This is useful for when you want to
- * precompute buffers for multiple elections.  This will clear the existing context
- * and start a new one.
+ * @brief Start filling the precompute buffer for a public key, adding a buffer when
+ * the key has none.  This is useful for when you want to precompute buffers for
+ * multiple elections.  The buffers of other keys are kept.
  * 
  * @param in_public_key  the public key to use for precomputing
  */
@@ -73,9 +73,75 @@ eg_precompute_buffer_context_start_new(eg_element_mod_p_t *in_public_key);
 
 EG_API eg_electionguard_status_t eg_precompute_buffer_context_stop();
 
+/**
+ * @brief Add a precompute buffer for a public key alongside the buffers of other
+ * elections, and make it the buffer reported by `eg_precompute_buffer_context_status`.
+ *
+ * @param[in] in_public_key the public key of the election
+ * @param[in] max_buffers the quota of precomputed selections for the buffer, or 0 for the default
+ */
+EG_API eg_electionguard_status_t
+eg_precompute_buffer_context_add(eg_element_mod_p_t *in_public_key, uint32_t max_buffers);
+
+/**
+ * @brief Stop and remove the precompute buffer for a public key
+ *
+ * @param[in] in_public_key the public key of the election
+ */
+EG_API eg_electionguard_status_t
+eg_precompute_buffer_context_remove(eg_element_mod_p_t *in_public_key);
+
+/**
+ * @brief Set the number of bytes every precompute buffer may hold together.
+ * Buffers stop filling once the budget is spent.
+ *
+ * @param[in] in_bytes the budget in bytes, or 0 for unlimited
+ */
+EG_API eg_electionguard_status_t eg_precompute_buffer_context_set_memory_budget(uint64_t in_bytes);
+
+/**
+ * @brief Get the number of bytes currently held by every precompute buffer
+ *
+ * @param[out] out_bytes the bytes held
+ */
+EG_API eg_electionguard_status_t eg_precompute_buffer_context_get_memory_usage(uint64_t *out_bytes);
+
 EG_API eg_electionguard_status_t eg_precompute_buffer_context_status(uint32_t *out_count,
                                                                      uint32_t *out_queue_size);
 
+/**
+ * @brief The queues held by a precompute buffer
+ */
+typedef enum eg_precompute_queue_e {
+    /** precomputed values used once per selection, including placeholders */
+    ELECTIONGUARD_PRECOMPUTE_QUEUE_SELECTIONS = 0,
+    /** precomputed encryptions used by the contest proofs and the contest data */
+    ELECTIONGUARD_PRECOMPUTE_QUEUE_ENCRYPTIONS = 1,
+} eg_precompute_queue_t;
+
+/**
+ * @brief Set the expected contests and selections per ballot from the ballot styles
+ * of a manifest, which steers how many precomputed encryptions are produced per
+ * precomputed selection until enough consumption is observed.
+ *
+ * @param[in] in_manifest the manifest of the election being encrypted
+ */
+EG_API eg_electionguard_status_t
+eg_precompute_buffer_context_set_profile(eg_internal_manifest_t *in_manifest);
+
+/**
+ * @brief Get the fill level and usage of one of the precompute queues
+ *
+ * @param[in] in_queue the queue
+ * @param[out] out_count the number of values in the queue
+ * @param[out] out_target the depth the queue is filled to
+ * @param[out] out_hits the number of values taken from the queue
+ * @param[out] out_misses the number of times the queue was empty when a value was needed
+ */
+EG_API eg_electionguard_status_t eg_precompute_buffer_context_queue_status(
+  eg_precompute_queue_t in_queue, uint32_t *out_count, uint32_t *out_target, uint64_t *out_hits,
+  uint64_t *out_misses);
+
 #endif
 
 #ifdef __cplusplus
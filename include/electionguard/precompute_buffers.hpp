@@ -4,6 +4,7 @@
 #include "electionguard/group.hpp"
 
 #include <array>
+#include <atomic>
 #include <cstdint>
 #include <electionguard/constants.h>
 #include <electionguard/export.h>
@@ -13,9 +14,13 @@
 #include <mutex>
 #include <optional>
 #include <queue>
+#include <thread>
+#include <vector>
 
 namespace electionguard
 {
+    class InternalManifest;
+
     /// <summary>
     /// A PrecomputedEncryption is a triplet-set of precomputed values
     /// that are used to speed up encryption.
@@ -194,23 +199,153 @@ namespace electionguard
 
     // TODO: range proof precompute table?
 
+    /// <summary>
+    /// The expected shape of the ballots encrypted with a precompute buffer.
+    ///
+    /// Every selection, including placeholders, draws a precomputed selection and every
+    /// contest draws two precomputed encryptions, one for the constant chaum pedersen
+    /// proof and one for the hashed elgamal encryption of the contest data. The profile
+    /// decides how many encryptions to keep per selection until consumption is observed.
+    /// </summary>
+    struct EG_API PrecomputeProfile {
+        /// <summary>
+        /// The precomputed encryptions drawn by each contest
+        /// </summary>
+        static constexpr double ENCRYPTIONS_PER_CONTEST = 2.0;
+
+        /// <summary>
+        /// The average number of selections per ballot, including placeholders
+        /// </summary>
+        double selectionsPerBallot = 3.0;
+
+        /// <summary>
+        /// The average number of contests per ballot
+        /// </summary>
+        double contestsPerBallot = 1.0;
+
+        /// <summary>
+        /// The number of precomputed encryptions expected per precomputed selection
+        /// </summary>
+        double getEncryptionsPerSelection() const;
+
+        /// <summary>
+        /// Average the contests and selections of every ballot style in the manifest
+        /// </summary>
+        static PrecomputeProfile fromManifest(const InternalManifest &manifest);
+    };
+
+    /// <summary>
+    /// The fill level and usage of one of the precompute queues
+    /// </summary>
+    struct PrecomputeQueueStatus {
+        /// <summary>
+        /// The number of values currently in the queue
+        /// </summary>
+        uint32_t size = 0;
+
+        /// <summary>
+        /// The depth the queue is filled to
+        /// </summary>
+        uint32_t target = 0;
+
+        /// <summary>
+        /// The number of values taken from the queue
+        /// </summary>
+        uint64_t hits = 0;
+
+        /// <summary>
+        /// The number of times the queue was empty and the caller
+        /// fell back to realtime exponentiations
+        /// </summary>
+        uint64_t misses = 0;
+    };
+
+    /// <summary>
+    /// The status of both precompute queues
+    /// </summary>
+    struct PrecomputeStatus {
+        PrecomputeQueueStatus selections;
+        PrecomputeQueueStatus encryptions;
+
+        /// <summary>
+        /// The ratio of encryptions to selections the buffer is currently producing
+        /// </summary>
+        double encryptionsPerSelection = 0.0;
+
+        /// <summary>
+        /// The number of background producers still filling the buffer. Producers
+        /// finish once the queues are full or the memory budget is spent.
+        /// </summary>
+        uint32_t producers = 0;
+    };
+
+    /// <summary>
+    /// A memory budget shared by the precompute buffers of a process.
+    ///
+    /// Buffers reserve the estimated size of each value before generating it
+    /// and stop filling once the budget is spent, and release the reservation
+    /// when the value is drawn or the buffer is cleared.
+    /// </summary>
+    class EG_API PrecomputeMemoryBudget
+    {
+      public:
+        /// <summary>
+        /// Create a budget of the given number of bytes, where zero is unlimited
+        /// </summary>
+        explicit PrecomputeMemoryBudget(uint64_t limit = 0) : limit(limit) {}
+
+        uint64_t getLimit() const { return limit; }
+        void setLimit(uint64_t bytes) { limit = bytes; }
+
+        /// <summary>
+        /// The bytes currently reserved by every buffer sharing the budget
+        /// </summary>
+        uint64_t getUsed() const { return used; }
+
+        /// <summary>
+        /// Reserve bytes for a value, or return false when the budget would be exceeded
+        /// </summary>
+        bool tryReserve(uint64_t bytes);
+
+        /// <summary>
+        /// Return bytes reserved with tryReserve
+        /// </summary>
+        void release(uint64_t bytes);
+
+      private:
+        std::atomic<uint64_t> limit{0};
+        std::atomic<uint64_t> used{0};
+    };
+
     /// <summary>
     /// A buffer of precomputed values that are used to speed up encryption
     /// of a selection. Since the values are precomputed it removes many the
     /// exponentiations from the ElGamal encryption of the selection as well
     /// as the computation of the Chaum Pedersen proof.
     ///
-    /// The precompute buffer is a queue of TwoTriplesAndAQuadruple objects.
-    /// The queue is filled by a background thread. The background thread
-    /// will fill the queue until it reaches the max queue size. The max
-    /// queue size is set by the caller and defaults to 5000. The queue
-    /// size is set by the caller in the init method.
+    /// The precompute buffer is a queue of TwoTriplesAndAQuadruple objects
+    /// and a queue of triples used once per contest. The queues are filled
+    /// until the selection queue reaches the max queue size, which is set by
+    /// the caller and defaults to 5000. The depth of the triple queue follows
+    /// the ratio at which the two queues are consumed, which starts from the
+    /// profile and converges on the observed consumption.
     ///
     /// This class is initialized against a specific public key and is thread safe.
     /// </summary>
     class EG_API PrecomputeBuffer
     {
       public:
+        /// <summary>
+        /// The estimated bytes held by one precomputed encryption
+        /// </summary>
+        static constexpr uint64_t ENCRYPTION_BYTES = MAX_Q_SIZE + 2 * MAX_P_SIZE;
+
+        /// <summary>
+        /// The estimated bytes held by one precomputed selection
+        /// </summary>
+        static constexpr uint64_t SELECTION_BYTES =
+          2 * ENCRYPTION_BYTES + 2 * MAX_Q_SIZE + 3 * MAX_P_SIZE;
+
         /// <summary>
         /// The init method initializes the precompute and allows the queue
         /// size to be set.
@@ -228,6 +363,16 @@ namespace electionguard
         PrecomputeBuffer(const ElementModP &publicKey, uint32_t maxQueueSize = 0,
                          bool shouldAutoPopulate = false);
 
+        /// <summary>
+        /// Create a buffer that shares a memory budget with other buffers
+        ///
+        /// <param name="publicKey">the elgamal public key for the election</param>
+        /// <param name="maxQueueSize">the quota of quadruples for this buffer</param>
+        /// <param name="budget">the budget shared by the buffers of the process</param>
+        /// </summary>
+        PrecomputeBuffer(const ElementModP &publicKey, uint32_t maxQueueSize,
+                         std::shared_ptr<PrecomputeMemoryBudget> budget);
+
         PrecomputeBuffer(const PrecomputeBuffer &other) = delete;
         PrecomputeBuffer(PrecomputeBuffer &&other) = delete;
         PrecomputeBuffer &operator=(const PrecomputeBuffer &) = delete;
@@ -252,17 +397,28 @@ namespace electionguard
 
         /// <summary>
         /// The start method populates the precomputations queues with
-        /// values used by encryptSelection. The function is stopped by calling
-        /// stop. Pre-computed values are currently computed by generating
-        /// two triples and a quad. We do this because two triples and a quad
-        /// are need for an encryptSelection.
+        /// values used by encryptSelection on background threads, which under
+        /// emscripten pthreads are web workers. The function is stopped by calling
+        /// stop. A single threaded webassembly module populates the queues before
+        /// returning, see populate.
+        ///
+        /// <param name="concurrency">the number of threads producing values</param>
         /// <returns>immediately and schedules work in the background</returns>
         /// </summary>
-        void startAsync();
+        void startAsync(uint32_t concurrency = 1);
+
+        /// <summary>
+        /// Produce at most count values on the calling thread, which lets a host
+        /// without threads fill the queues in slices between its other work.
+        ///
+        /// <returns>true once the queues are full or the memory budget is spent</returns>
+        /// </summary>
+        bool populate(uint32_t count);
 
         /// <summary>
         /// The stopPopulating method stops the population of the
-        /// precomputations queues started by the populate method.
+        /// precomputations queues started by the populate method
+        /// and waits for the background threads to finish their current value.
         /// </summary>
         void stop();
 
@@ -284,6 +440,17 @@ namespace electionguard
         /// </summary>
         ElementModP *getPublicKey();
 
+        /// <summary>
+        /// Set the expected shape of the ballots, which steers the production
+        /// of the triple queue until enough consumption is observed.
+        /// </summary>
+        void setProfile(const PrecomputeProfile &profile);
+
+        /// <summary>
+        /// Get the fill level, target depth and usage of each queue
+        /// </summary>
+        PrecomputeStatus getStatus();
+
         /// <summary>
         /// Get the next triple from the triple queue.
         /// If no triple exists, one is created.
@@ -325,27 +492,65 @@ namespace electionguard
         static std::unique_ptr<PrecomputedSelection>
         createPrecomputedSelection(const ElementModP &publicKey);
 
+        /// <summary>
+        /// Weight the profile with this many selections when blending it with the
+        /// observed consumption, so that a few early draws do not swing the mix
+        /// </summary>
+        static constexpr double PROFILE_WEIGHT = 64.0;
+
+        /// <summary>
+        /// Blend the profile with the observed consumption of the two queues
+        /// </summary>
+        double getEncryptionsPerSelection();
+
+        /// <summary>
+        /// The depth to fill the triple queue to for the current mix
+        /// </summary>
+        uint32_t getEncryptionTarget();
+
       private:
+        bool reserve(uint64_t bytes);
+        void release(uint64_t bytes);
+
+        /// <summary>
+        /// Produce one value for the queue that is emptier relative to its target.
+        /// Returns false when both queues are full or the memory budget is spent.
+        /// </summary>
+        bool produceNext();
+
         uint32_t maxQueueSize = DEFAULT_PRECOMPUTE_SIZE;
-        bool isRunning = false;
+        std::atomic<bool> isRunning{false};
+        std::atomic<uint32_t> activeProducers{0};
+        std::atomic<double> profileEncryptionsPerSelection{
+          PrecomputeProfile().getEncryptionsPerSelection()};
+        std::atomic<uint64_t> selectionHits{0};
+        std::atomic<uint64_t> selectionMisses{0};
+        std::atomic<uint64_t> encryptionHits{0};
+        std::atomic<uint64_t> encryptionMisses{0};
         bool shouldAutoPopulate = false;
         std::mutex encryption_queue_lock;
         std::mutex selection_queue_lock;
         std::unique_ptr<ElementModP> publicKey;
+        std::shared_ptr<PrecomputeMemoryBudget> budget;
         std::queue<std::unique_ptr<PrecomputedEncryption>> encryption_queue;
         std::queue<std::unique_ptr<PrecomputedSelection>> selection_queue;
+        std::mutex schedule_lock;
+        std::atomic<uint32_t> pendingSelections{0};
+        std::atomic<uint32_t> pendingEncryptions{0};
+        std::mutex producer_lock;
+        std::vector<std::thread> producers;
     };
 
     /// <summary>
-    /// A singleton context for a collection of precomputed triples and quadruples.
+    /// A singleton registry of precompute buffers, one per election public key.
     ///
-    /// When initializing the context, the caller can specify the maximum number of
-    /// quadruples to precompute. The number of triples in the triple queue will be
-    /// twice this.
+    /// A process encrypting for several elections keeps a buffer for each key, so
+    /// switching between elections does not discard precomputed values. Each buffer
+    /// has its own quota of quadruples and every buffer shares one memory budget.
     ///
-    /// The context is initialized against a specific public key. There can only be one context
-    /// initialized at a time. If the caller attempts to initialize the context with a different
-    /// public key, then the context will be cleared and re-initialized.
+    /// The methods without a public key act on the current buffer, which is the one
+    /// most recently initialized, added or started. Encryption looks up the buffer
+    /// matching the public key of the election context once per contest.
     ///
     /// The context is thread safe.
     /// </summary>
@@ -358,7 +563,7 @@ namespace electionguard
         PrecomputeBufferContext &operator=(PrecomputeBufferContext &&) = delete;
 
       private:
-        PrecomputeBufferContext() {}
+        PrecomputeBufferContext() : budget(std::make_shared<PrecomputeMemoryBudget>()) {}
         ~PrecomputeBufferContext() {}
 
       private:
@@ -370,13 +575,13 @@ namespace electionguard
 
       public:
         /// <summary>
-        /// clear the precomputations queues
+        /// clear the precomputations queues of every buffer and remove them
         /// </summary>
         static void clear();
 
         /// <summary>
-        /// The init method initializes the precompute and allows the queue
-        /// size to be set.
+        /// The init method clears every buffer and initializes a buffer for
+        /// the public key, which allows the queue size to be set.
         ///
         /// <param name="publicKey">the elgamal public key for the election</param>
         /// <param name="maxQueueSize">by default the quad queue size is 5000, so
@@ -387,24 +592,33 @@ namespace electionguard
         static void initialize(const ElementModP &publicKey, uint32_t maxQueueSize = 0);
 
         /// <summary>
-        /// The start method populates the precomputations queues with
-        /// values used by encryptSelection. The function is stopped by calling
+        /// Add a buffer for the public key alongside the existing buffers and make it
+        /// the current buffer. When the key already has a buffer its quota is kept.
+        ///
+        /// <param name="publicKey">the elgamal public key for the election</param>
+        /// <param name="maxQueueSize">the quota of quadruples for the buffer</param>
+        /// </summary>
+        static void add(const ElementModP &publicKey, uint32_t maxQueueSize = 0);
+
+        /// <summary>
+        /// Stop and remove the buffer for the public key, releasing its share of the budget
+        /// </summary>
+        static void remove(const ElementModP &publicKey);
+
+        /// <summary>
+        /// The start method populates the precomputations queues of every buffer
+        /// with values used by encryptSelection. The function is stopped by calling
         /// stop. Pre-computed values are currently computed by generating
         /// two triples and a quad. We do this because two triples and a quad
         /// are need for an encryptSelection.
-        /// <returns>once the queue is populated</returns>
+        /// <returns>once the queues are populated</returns>
         /// </summary>
         static void start();
 
         /// <summary>
-        /// The start method populates the precomputations queues with
-        /// values used by encryptSelection. The function is stopped by calling
-        /// stop. Pre-computed values are currently computed by generating
-        /// two triples and a quad. We do this because two triples and a quad
-        /// are need for an encryptSelection.
-        ///
-        /// calling this override will re-initialize the context with the
-        /// provided public key.
+        /// The start method populates the precomputations queues of the buffer
+        /// for the public key, adding the buffer when the key has none.
+        /// The buffers of other keys are kept.
         ///
         /// <param name="publicKey">the elgamal public key for the election</param>
         /// <returns>once the queue is populated</returns>
@@ -412,50 +626,94 @@ namespace electionguard
         static void start(const ElementModP &publicKey);
 
         /// <summary>
-        /// The start method populates the precomputations queues with
-        /// values used by encryptSelection. The function is stopped by calling
-        /// stop. Pre-computed values are currently computed by generating
-        /// two triples and a quad. We do this because two triples and a quad
-        /// are need for an encryptSelection.
+        /// The start method populates the precomputations queues of the buffer
+        /// for the public key, adding the buffer when the key has none.
+        ///
+        /// <param name="publicKey">the elgamal public key for the election</param>
+        /// <param name="concurrency">the number of threads producing values</param>
         /// <returns>immediately and schedules work in the background</returns>
         /// </summary>
-        static void startAsync(const ElementModP &publicKey);
+        static void startAsync(const ElementModP &publicKey, uint32_t concurrency = 1);
+
+        /// <summary>
+        /// Produce at most count values for the current buffer on the calling thread,
+        /// see PrecomputeBuffer::populate
+        /// </summary>
+        static bool populate(uint32_t count);
 
         /// <summary>
         /// The stopPopulating method stops the population of the
-        /// precomputations queues started by the populate method.
+        /// precomputations queues of every buffer.
         /// <returns>void</returns>
         /// </summary>
         static void stop();
 
         /// <summary>
         /// Get the currently set maximum queue size for the number
-        /// of quadruples to generate. The number of triples in
-        /// the triple_queue will be twice this.
+        /// of quadruples to generate in the current buffer.
         /// <returns>uint32_t</returns>
         /// </summary>
         static uint32_t getMaxQueueSize();
 
         /// <summary>
-        /// Get the current number of quadruples in the quadruple_queue,
-        /// the number of triples in the triple_queue will be twice this.
+        /// Get the current number of quadruples in the current buffer.
         /// </summary>
         static uint32_t getCurrentQueueSize();
 
         /// <summary>
-        /// Get the public key that the precompute buffer is initialized against.
+        /// Get the public key of the current buffer.
         /// </summary>
         static ElementModP *getPublicKey();
 
         /// <summary>
-        /// Get the next triple from the triple queue. If there is no triple
-        /// in the queue, then one is created.
+        /// Get the buffer for the public key, or nullptr when the key has none.
+        /// The buffer stays valid while it is held, even if it is removed.
+        /// </summary>
+        static std::shared_ptr<PrecomputeBuffer> getBuffer(const ElementModP &publicKey);
+
+        /// <summary>
+        /// Get the number of buffers in the registry
+        /// </summary>
+        static size_t getBufferCount();
+
+        /// <summary>
+        /// Set the number of bytes every buffer may hold together, where zero is unlimited.
+        /// Buffers over a lowered budget stop filling but keep their values.
+        /// </summary>
+        static void setMemoryBudget(uint64_t bytes);
+
+        /// <summary>
+        /// Get the bytes currently held by every buffer
+        /// </summary>
+        static uint64_t getMemoryUsage();
+
+        /// <summary>
+        /// Set the expected shape of the ballots encrypted with the current buffer,
+        /// see PrecomputeBuffer::setProfile
+        /// </summary>
+        static void setProfile(const PrecomputeProfile &profile);
+
+        /// <summary>
+        /// Get the fill level, target depth and usage of each queue of the current
+        /// buffer, or an empty status when the context is not initialized.
+        /// </summary>
+        static PrecomputeStatus getStatus();
+
+        /// <summary>
+        /// Get the next triple from the triple queue of the current buffer.
+        /// If there is no triple in the queue, then one is created.
         /// </summary>
         static std::unique_ptr<PrecomputedEncryption> getPrecomputedEncryption();
 
         /// <summary>
-        /// Pop the next triple from the triple queue. If there is no triple
-        /// in the queue, then nullopt is returned.
+        /// Pop the next triple from the triple queue of the current buffer.
+        /// If there is no triple in the queue, then nullopt is returned.
+        /// </summary>
+        static std::optional<std::unique_ptr<PrecomputedEncryption>> popPrecomputedEncryption();
+
+        /// <summary>
+        /// Pop the next triple from the triple queue of the buffer for the public key.
+        /// If there is no buffer or no triple in the queue, then nullopt is returned.
         ///
         /// This method is called by hashedElgamalEncrypt in order to get
         /// the precomputed value to perform the hashed elgamal encryption.
@@ -463,28 +721,36 @@ namespace electionguard
         /// This method is also called by ConstantChaumPedersenProof::make
         /// in order to get the precomputed value to make the proof.
         /// </summary>
-        static std::optional<std::unique_ptr<PrecomputedEncryption>> popPrecomputedEncryption();
+        static std::optional<std::unique_ptr<PrecomputedEncryption>>
+        popPrecomputedEncryption(const ElementModP &publicKey);
 
         /// <summary>
-        /// Get the next two triples and a quadruple from the queues.
+        /// Get the next two triples and a quadruple from the queues of the current buffer.
         /// If no quadruple exists, one is created.
         /// <returns>std::unique_ptr<TwoTriplesAndAQuadruple></returns>
         /// </summary>
         static std::unique_ptr<PrecomputedSelection> getPrecomputedSelection();
 
         /// <summary>
-        /// Pop the next quadruple set from the triple queue.
+        /// Pop the next quadruple set from the queues of the current buffer.
         /// If no quadruple exists, then nullopt is returned.
-        ///
-        /// This method is called by encryptSelection in order to get
-        /// the precomputed values to encrypt the selection and make a
-        /// proof for it.
         /// </summary>
         static std::optional<std::unique_ptr<PrecomputedSelection>> popPrecomputedSelection();
 
       private:
+        struct Entry {
+            uint64_t fingerprint;
+            std::shared_ptr<PrecomputeBuffer> buffer;
+        };
+
+        static std::shared_ptr<PrecomputeBuffer> getCurrent();
+        std::shared_ptr<PrecomputeBuffer> find(const ElementModP &publicKey,
+                                               uint64_t fingerprint) const;
+
         std::mutex _mutex;
-        std::unique_ptr<PrecomputeBuffer> _instance = nullptr;
+        std::vector<Entry> _buffers;
+        std::shared_ptr<PrecomputeBuffer> _current;
+        std::shared_ptr<PrecomputeMemoryBudget> budget;
     };
 
 } // namespace electionguard
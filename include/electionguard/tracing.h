@@ -0,0 +1,47 @@
+/// @file tracing.h
+#ifndef __ELECTIONGUARD_CPP_TRACING_H_INCLUDED__
+#define __ELECTIONGUARD_CPP_TRACING_H_INCLUDED__
+
+#include "export.h"
+#include "status.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Check whether the library was built with trace spans (USE_TRACING)
+ */
+EG_API bool eg_tracing_is_compiled_in();
+
+/**
+ * @brief Start or stop recording trace spans.
+ * Has no effect when the library was built without trace spans.
+ *
+ * @param[in] in_enabled whether spans should be recorded
+ * @return eg_electionguard_status_t indicating success or failure
+ */
+EG_API eg_electionguard_status_t eg_tracing_set_enabled(bool in_enabled);
+
+/**
+ * @brief Discard every recorded trace span
+ */
+EG_API eg_electionguard_status_t eg_tracing_clear();
+
+/**
+ * @brief Export the recorded trace spans in the Chrome trace event JSON format
+ *
+ * @param[out] out_data a pointer to the JSON string. The caller is responsible for freeing it
+ * @param[out] out_size the size of the string including the terminator
+ * @return eg_electionguard_status_t indicating success or failure
+ */
+EG_API eg_electionguard_status_t eg_tracing_to_chrome_json(char **out_data, uint64_t *out_size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ELECTIONGUARD_CPP_TRACING_H_INCLUDED__ */
@@ -0,0 +1,60 @@
+#ifndef __ELECTIONGUARD_CPP_TRACING_HPP_INCLUDED__
+#define __ELECTIONGUARD_CPP_TRACING_HPP_INCLUDED__
+
+#include "export.h"
+
+#include <cstddef>
+#include <string>
+
+namespace electionguard
+{
+    /// <summary>
+    /// Scoped trace spans around the encryption, verification and precompute paths.
+    ///
+    /// Spans are only compiled into the library when it is built with USE_TRACING,
+    /// and are only recorded while tracing is enabled at runtime. Each thread records
+    /// into its own ring buffer, which keeps the most recent spans once it is full.
+    /// </summary>
+    class EG_API Tracing
+    {
+      public:
+        /// <summary>
+        /// The number of spans kept per thread unless changed with setThreadCapacity
+        /// </summary>
+        static constexpr size_t DEFAULT_THREAD_CAPACITY = 4096;
+
+        /// <summary>
+        /// Check whether the library was built with trace spans
+        /// </summary>
+        static bool isCompiledIn();
+
+        /// <summary>
+        /// Check whether spans are currently being recorded
+        /// </summary>
+        static bool isEnabled();
+
+        /// <summary>
+        /// Start or stop recording spans. Has no effect when the spans are not compiled in.
+        /// </summary>
+        static void setEnabled(bool enabled);
+
+        /// <summary>
+        /// Set the number of spans kept per thread. Applies to threads that record
+        /// their first span after the call, and to every thread after a clear.
+        /// </summary>
+        static void setThreadCapacity(size_t capacity);
+
+        /// <summary>
+        /// Discard every recorded span
+        /// </summary>
+        static void clear();
+
+        /// <summary>
+        /// Export the recorded spans in the Chrome trace event format,
+        /// which can be loaded by chrome://tracing and Perfetto
+        /// </summary>
+        static std::string toChromeTraceJson();
+    };
+} // namespace electionguard
+
+#endif /* __ELECTIONGUARD_CPP_TRACING_HPP_INCLUDED__ */
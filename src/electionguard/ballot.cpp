@@ -8,6 +8,7 @@
 #include "serialize.hpp"
 #include "utils.hpp"
 
+#include <algorithm>
 #include <cstdlib>
 #include <ctime>
 #include <stdexcept>
@@ -1219,9 +1220,56 @@ namespace electionguard
         return CiphertextBallotSerializer::toMsgPack(*this, withNonces);
     }
 
-    unique_ptr<CiphertextBallot> CiphertextBallot::fromJson(string data)
+    // check every group element of a deserialized ballot is in the subgroup, in one batch
+    static void validateResidues(const CiphertextBallot &ballot)
     {
-        return CiphertextBallotSerializer::fromJson(move(data));
+        vector<unique_ptr<HashedElGamalCiphertext>> extendedData;
+        vector<reference_wrapper<const ElementModP>> elements;
+        auto addCiphertext = [&elements](const ElGamalCiphertext *ciphertext) {
+            if (ciphertext != nullptr) {
+                elements.push_back(*ciphertext->getPad());
+                elements.push_back(*ciphertext->getData());
+            }
+        };
+        auto addProof = [&addCiphertext](const RangedChaumPedersenProof *proof) {
+            if (proof == nullptr) {
+                return;
+            }
+            for (const auto &integerProof : proof->getProofs()) {
+                if (integerProof.get().commitment.has_value()) {
+                    addCiphertext(integerProof.get().commitment->get());
+                }
+            }
+        };
+
+        for (const auto &contest : ballot.getContests()) {
+            addCiphertext(contest.get().getCiphertextAccumulation());
+            addProof(contest.get().getProof());
+            if (auto hashedElGamal = contest.get().getHashedElGamalCiphertext()) {
+                elements.push_back(*hashedElGamal->getPad());
+                extendedData.push_back(move(hashedElGamal));
+            }
+            for (const auto &selection : contest.get().getSelections()) {
+                addCiphertext(selection.get().getCiphertext());
+                addProof(selection.get().getProof());
+            }
+        }
+
+        auto results = is_valid_residue_batch(elements);
+        if (std::find(results.begin(), results.end(), false) != results.end()) {
+            throw invalid_argument("ballot " + ballot.getObjectId() +
+                                   " contains an element that is not a valid residue");
+        }
+    }
+
+    unique_ptr<CiphertextBallot> CiphertextBallot::fromJson(string data,
+                                                            bool validateResidues /* = false */)
+    {
+        auto ballot = CiphertextBallotSerializer::fromJson(move(data));
+        if (validateResidues) {
+            electionguard::validateResidues(*ballot);
+        }
+        return ballot;
     }
 
     unique_ptr<CiphertextBallot> CiphertextBallot::fromBson(vector<uint8_t> data)
@@ -1229,9 +1277,29 @@ namespace electionguard
         return CiphertextBallotSerializer::fromBson(move(data));
     }
 
-    unique_ptr<CiphertextBallot> CiphertextBallot::fromMsgPack(vector<uint8_t> data)
+    unique_ptr<CiphertextBallot> CiphertextBallot::fromMsgPack(vector<uint8_t> data,
+                                                               bool validateResidues /* = false */)
+    {
+        auto ballot = CiphertextBallotSerializer::fromMsgPack(move(data));
+        if (validateResidues) {
+            electionguard::validateResidues(*ballot);
+        }
+        return ballot;
+    }
+
+    vector<uint8_t> CiphertextBallot::toBinary(bool withNonces /* = false */) const
+    {
+        return CiphertextBallotSerializer::toBinary(*this, withNonces);
+    }
+
+    unique_ptr<CiphertextBallot> CiphertextBallot::fromBinary(const vector<uint8_t> &data)
     {
-        return CiphertextBallotSerializer::fromMsgPack(move(data));
+        return CiphertextBallotSerializer::fromBinary(data.data(), data.size());
+    }
+
+    unique_ptr<CiphertextBallot> CiphertextBallot::fromBinary(const uint8_t *data, size_t size)
+    {
+        return CiphertextBallotSerializer::fromBinary(data, size);
     }
 
     // Protected Methods
@@ -1352,6 +1420,21 @@ namespace electionguard
         return SubmittedBallotSerializer::fromMsgPack(move(data));
     }
 
+    vector<uint8_t> SubmittedBallot::toBinary() const
+    {
+        return SubmittedBallotSerializer::toBinary(*this);
+    }
+
+    unique_ptr<SubmittedBallot> SubmittedBallot::fromBinary(const vector<uint8_t> &data)
+    {
+        return SubmittedBallotSerializer::fromBinary(data.data(), data.size());
+    }
+
+    unique_ptr<SubmittedBallot> SubmittedBallot::fromBinary(const uint8_t *data, size_t size)
+    {
+        return SubmittedBallotSerializer::fromBinary(data, size);
+    }
+
 #pragma endregion
 
 } // namespace electionguard
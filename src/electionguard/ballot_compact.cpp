@@ -1,3 +1,4 @@
+#include "electionguard/async.hpp"
 #include "electionguard/ballot.hpp"
 #include "electionguard/ballot_code.hpp"
 #include "electionguard/election_object_base.hpp"
@@ -225,6 +226,23 @@ namespace electionguard
         return CompactCiphertextBallotSerializer::fromMsgPack(move(data));
     }
 
+    vector<uint8_t> CompactCiphertextBallot::toBinary() const
+    {
+        return CompactCiphertextBallotSerializer::toBinary(*this);
+    }
+
+    unique_ptr<CompactCiphertextBallot>
+    CompactCiphertextBallot::fromBinary(const vector<uint8_t> &data)
+    {
+        return CompactCiphertextBallotSerializer::fromBinary(data.data(), data.size());
+    }
+
+    unique_ptr<CompactCiphertextBallot> CompactCiphertextBallot::fromBinary(const uint8_t *data,
+                                                                            size_t size)
+    {
+        return CompactCiphertextBallotSerializer::fromBinary(data, size);
+    }
+
 #pragma endregion
 
 #pragma region Compress Functions
@@ -307,7 +325,8 @@ namespace electionguard
     unique_ptr<CiphertextBallot>
     expandCompactCiphertextBallot(const CompactCiphertextBallot &compactCiphertext,
                                   const InternalManifest &manifest,
-                                  const CiphertextElectionContext &context)
+                                  const CiphertextElectionContext &context,
+                                  bool verifyProofs /* = true */)
     {
         if (compactCiphertext.getPlaintext() == nullptr) {
             throw runtime_error("the plaintext seelctions were not found");
@@ -327,7 +346,8 @@ namespace electionguard
         auto plaintext = expandCompactPlaintextBallot(*compactCiphertext.getPlaintext(), manifest);
         auto ciphertext =
           encryptBallot(*plaintext, manifest, context, *compactCiphertext.getBallotCodeSeed(),
-                        compactCiphertext.getNonce()->clone(), compactCiphertext.getTimestamp());
+                        compactCiphertext.getNonce()->clone(), compactCiphertext.getTimestamp(),
+                        verifyProofs);
 
         if (compactCiphertext.getBallotBoxState() == BallotBoxState::cast) {
             ciphertext->cast();
@@ -342,6 +362,18 @@ namespace electionguard
         return ciphertext;
     }
 
+    vector<unique_ptr<CiphertextBallot>> expandCompactCiphertextBallots(
+      const vector<reference_wrapper<const CompactCiphertextBallot>> &compactCiphertexts,
+      const InternalManifest &manifest, const CiphertextElectionContext &context,
+      bool verifyProofs /* = true */, uint32_t concurrency /* = 0 */)
+    {
+        return map_async<unique_ptr<CiphertextBallot>>(
+          compactCiphertexts.size(), concurrency, [&](size_t index) {
+              return expandCompactCiphertextBallot(compactCiphertexts.at(index).get(), manifest,
+                                                   context, verifyProofs);
+          });
+    }
+
 #pragma endregion
 
 } // namespace electionguard
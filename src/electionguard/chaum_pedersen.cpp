@@ -1,9 +1,11 @@
 #include "electionguard/chaum_pedersen.hpp"
 
 #include "convert.hpp"
+#include "electionguard/async.hpp"
 #include "electionguard/nonces.hpp"
 #include "electionguard/precompute_buffers.hpp"
 #include "log.hpp"
+#include "trace_span.hpp"
 
 #include <algorithm>
 #include <cstdlib>
@@ -22,6 +24,7 @@ using std::reference_wrapper;
 using std::string;
 using std::to_string;
 using std::unique_ptr;
+using std::vector;
 
 namespace electionguard
 {
@@ -163,7 +166,8 @@ namespace electionguard
             throw invalid_argument(
               "DisjunctiveChaumPedersenProof::make:: only supports plaintexts of 0 or 1");
         }
-        Log::trace("DisjunctiveChaumPedersenProof: making proof without seed.");
+        EG_TRACE_SPAN("DisjunctiveChaumPedersenProof::make");
+        EG_LOG_TRACE("DisjunctiveChaumPedersenProof: making proof without seed.");
         if (plaintext == 1) {
             return make_one(message, r, k, q);
         }
@@ -179,7 +183,8 @@ namespace electionguard
             throw invalid_argument(
               "DisjunctiveChaumPedersenProof::make:: only supports plaintexts of 0 or 1");
         }
-        Log::trace("DisjunctiveChaumPedersenProof: making proof with seed.");
+        EG_TRACE_SPAN("DisjunctiveChaumPedersenProof::make");
+        EG_LOG_TRACE("DisjunctiveChaumPedersenProof: making proof with seed.");
         if (plaintext == 1) {
             return make_one(message, r, k, q, seed);
         }
@@ -206,7 +211,8 @@ namespace electionguard
             throw invalid_argument(
               "DisjunctiveChaumPedersenProof::make:: only supports plaintexts of 0 or 1");
         }
-        Log::trace("DisjunctiveChaumPedersenProof: making proof without seed.");
+        EG_TRACE_SPAN("DisjunctiveChaumPedersenProof::make");
+        EG_LOG_TRACE("DisjunctiveChaumPedersenProof: making proof without seed.");
         if (plaintext == 1) {
             return make_one(message, r, move(real), move(fake), k, q);
         }
@@ -219,7 +225,8 @@ namespace electionguard
     bool DisjunctiveChaumPedersenProof::isValid(const ElGamalCiphertext &message,
                                                 const ElementModP &k, const ElementModQ &q)
     {
-        Log::trace("DisjunctiveChaumPedersenProof::isValid: ");
+        EG_TRACE_SPAN("DisjunctiveChaumPedersenProof::isValid");
+        EG_LOG_TRACE("DisjunctiveChaumPedersenProof::isValid: ");
         auto *alpha = message.getPad();
         auto *beta = message.getData();
 
@@ -287,26 +294,26 @@ namespace electionguard
               {"consistent_k^w1", consistent_kw1},
             };
 
-            Log::info("found an invalid Disjunctive Chaum-Pedersen proof", printMap);
-
-            Log::debug("k->get", k.toHex());
-            Log::debug("q->get", q.toHex());
-            Log::debug("alpha->get", alpha->toHex());
-            Log::debug("beta->get", beta->toHex());
-            Log::debug("a0->get", a0.toHex());
-            Log::debug("b0->get", b0.toHex());
-            Log::debug("a1->get", a1.toHex());
-            Log::debug("b1->get", b1.toHex());
-            Log::debug("c0->get", c0.toHex());
-            Log::debug("c1->get", c1.toHex());
-            Log::debug("c->get", c.toHex());
-            Log::debug("v0->get", v0.toHex());
-            Log::debug("v1->get", v1.toHex());
-            Log::debug("w1->get", w1->toHex());
+            EG_LOG_INFO("found an invalid Disjunctive Chaum-Pedersen proof", printMap);
+
+            EG_LOG_DEBUG("k->get", k.toHex());
+            EG_LOG_DEBUG("q->get", q.toHex());
+            EG_LOG_DEBUG("alpha->get", alpha->toHex());
+            EG_LOG_DEBUG("beta->get", beta->toHex());
+            EG_LOG_DEBUG("a0->get", a0.toHex());
+            EG_LOG_DEBUG("b0->get", b0.toHex());
+            EG_LOG_DEBUG("a1->get", a1.toHex());
+            EG_LOG_DEBUG("b1->get", b1.toHex());
+            EG_LOG_DEBUG("c0->get", c0.toHex());
+            EG_LOG_DEBUG("c1->get", c1.toHex());
+            EG_LOG_DEBUG("c->get", c.toHex());
+            EG_LOG_DEBUG("v0->get", v0.toHex());
+            EG_LOG_DEBUG("v1->get", v1.toHex());
+            EG_LOG_DEBUG("w1->get", w1->toHex());
 
             return false;
         }
-        Log::trace("DisjunctiveChaumPedersenProof::isValid: TRUE!");
+        EG_LOG_TRACE("DisjunctiveChaumPedersenProof::isValid: TRUE!");
         return success;
     }
 
@@ -342,8 +349,8 @@ namespace electionguard
         auto *alpha = message.getPad();
         auto *beta = message.getData();
 
-        Log::trace("alpha: ", alpha->toHex());
-        Log::trace("beta: ", beta->toHex());
+        EG_LOG_TRACE("alpha: ", alpha->toHex());
+        EG_LOG_TRACE("beta: ", beta->toHex());
 
         // Pick three random numbers in Q.
         auto nonces = make_unique<Nonces>(seed, "disjoint-chaum-pedersen-proof");
@@ -396,8 +403,8 @@ namespace electionguard
         auto *alpha = message.getPad();
         auto *beta = message.getData();
 
-        Log::trace("alpha: ", alpha->toHex());
-        Log::trace("beta: ", beta->toHex());
+        EG_LOG_TRACE("alpha: ", alpha->toHex());
+        EG_LOG_TRACE("beta: ", beta->toHex());
 
         // Pick 3 random numbers in Q.
         auto u0 = real->getSecret();
@@ -496,8 +503,8 @@ namespace electionguard
         auto *alpha = message.getPad();
         auto *beta = message.getData();
 
-        Log::trace("alpha: ", alpha->toHex());
-        Log::trace("beta: ", beta->toHex());
+        EG_LOG_TRACE("alpha: ", alpha->toHex());
+        EG_LOG_TRACE("beta: ", beta->toHex());
 
         // Pick three random numbers in Q.
         auto u0 = fake->getSecret1();
@@ -528,25 +535,49 @@ namespace electionguard
 
 #pragma region RangedChaumPedersenProof
 
+    // the number of integer proofs handled by one task when the proofs are fanned out,
+    // each one costs a few exponentiations so small groups still amortize the task
+    constexpr uint64_t RANGED_PROOF_CHUNK_SIZE = 4;
+
+    // run `task(start, end)` over the integer proof indices, serially for a concurrency of one
+    // or a single chunk and otherwise across at most `concurrency` tasks
+    template <typename F>
+    static void forEachRangedProofChunk(uint64_t count, size_t concurrency, F task)
+    {
+        auto chunks = (count + RANGED_PROOF_CHUNK_SIZE - 1) / RANGED_PROOF_CHUNK_SIZE;
+        if (concurrency == 1 || chunks <= 1) {
+            task(0, count);
+            return;
+        }
+        map_async<bool>(chunks, concurrency, [&](size_t chunk) {
+            auto start = chunk * RANGED_PROOF_CHUNK_SIZE;
+            task(start, std::min(start + RANGED_PROOF_CHUNK_SIZE, count));
+            return true;
+        });
+    }
+
     struct RangedChaumPedersenProof::Impl {
         uint64_t rangeLimit;
 
         // the joint challenge Equation (56) in the v2.0.0 spec
         // c = H(HE;0x21,K,α ̄,β ̄,a0,b0,a1,b1,...,aL,bL)
         unique_ptr<ElementModQ> challenge;
-        map<uint64_t, unique_ptr<ZeroKnowledgeProof>> integerProofs;
+
+        // the integer proof for each value j in the range, addressed by j
+        vector<unique_ptr<ZeroKnowledgeProof>> integerProofs;
 
         Impl(uint64_t inRangeLimit, unique_ptr<ElementModQ> inChallenge,
-             map<uint64_t, unique_ptr<ZeroKnowledgeProof>> inProofs)
+             vector<unique_ptr<ZeroKnowledgeProof>> inProofs)
             : rangeLimit(inRangeLimit), challenge(move(inChallenge)), integerProofs(move(inProofs))
         {
         }
 
         [[nodiscard]] unique_ptr<RangedChaumPedersenProof::Impl> clone() const
         {
-            map<uint64_t, unique_ptr<ZeroKnowledgeProof>> _proofs;
-            for (auto &proof : integerProofs) {
-                _proofs[proof.first] = proof.second->clone();
+            vector<unique_ptr<ZeroKnowledgeProof>> _proofs;
+            _proofs.reserve(integerProofs.size());
+            for (const auto &proof : integerProofs) {
+                _proofs.push_back(proof->clone());
             }
             return make_unique<RangedChaumPedersenProof::Impl>(rangeLimit, challenge->clone(),
                                                                move(_proofs));
@@ -555,18 +586,27 @@ namespace electionguard
         // get hashable commitments for the integer proofs
         // if the commitment is not present, recompute it using the public values
         vector<reference_wrapper<CryptoHashable>>
-        getHashableCommitments(const ElGamalCiphertext &message, const ElementModP &k) const
+        getHashableCommitments(const ElGamalCiphertext &message, const ElementModP &k,
+                               size_t concurrency) const
         {
-            vector<reference_wrapper<CryptoHashable>> commitments;
-            for (auto &proof : integerProofs) {
-                if (!proof.second->commitment.has_value()) {
-                    // recompute using the publically known values
-                    auto recomputedCommitment = recomputeCommitment(
-                      message, *proof.second->challenge, *proof.second->response, proof.first, k);
-                    proof.second->commitment = move(recomputedCommitment);
+            // each index only writes its own proof, so the chunks need no locking
+            forEachRangedProofChunk(integerProofs.size(), concurrency, [&](uint64_t start,
+                                                                           uint64_t end) {
+                for (auto j = start; j < end; j++) {
+                    auto &proof = *integerProofs[j];
+                    if (!proof.commitment.has_value()) {
+                        // recompute using the publically known values
+                        proof.commitment =
+                          recomputeCommitment(message, *proof.challenge, *proof.response, j, k);
+                    }
                 }
+            });
+
+            vector<reference_wrapper<CryptoHashable>> commitments;
+            commitments.reserve(integerProofs.size());
+            for (const auto &proof : integerProofs) {
                 commitments.emplace_back(
-                  static_cast<CryptoHashable &>(*proof.second->commitment.value()));
+                  static_cast<CryptoHashable &>(*proof->commitment.value()));
             }
             return commitments;
         }
@@ -575,8 +615,9 @@ namespace electionguard
         vector<reference_wrapper<ElementModQ>> getChallenges() const
         {
             vector<reference_wrapper<ElementModQ>> challengeValues;
-            for (auto &proof : integerProofs) {
-                challengeValues.emplace_back(*proof.second->challenge);
+            challengeValues.reserve(integerProofs.size());
+            for (const auto &proof : integerProofs) {
+                challengeValues.emplace_back(*proof->challenge);
             }
             return challengeValues;
         }
@@ -610,8 +651,9 @@ namespace electionguard
             // when trying to validate against a proof that has been deserialized
             // from an election record that does not include the commitment values
             if (!proof.commitment.has_value()) {
-                Log::trace("RangedChaumPedersenProof::Impl::isValid: inconclusive integer proof " +
-                           to_string(j));
+                EG_LOG_TRACE(
+                  "RangedChaumPedersenProof::Impl::isValid: inconclusive integer proof " +
+                  to_string(j));
                 return ValidationResult{false, {"j: " + to_string(j) + " inconclusive commitment"}};
             }
 
@@ -644,8 +686,8 @@ namespace electionguard
 
             if (!consistent_gv || !consistent_kv) {
                 auto jstring = to_string(j);
-                Log::debug("RangedChaumPedersenProof::Impl::isValid: invalid integer proof " +
-                           jstring);
+                EG_LOG_DEBUG("RangedChaumPedersenProof::Impl::isValid: invalid integer proof " +
+                             jstring);
                 return ValidationResult{
                   false,
                   {
@@ -661,14 +703,29 @@ namespace electionguard
         }
 
         // validate the integer proofs against the message
-        ValidationResult isValid(const ElGamalCiphertext &message, const ElementModP &k)
+        ValidationResult isValid(const ElGamalCiphertext &message, const ElementModP &k,
+                                 size_t concurrency) const
         {
+            // the proofs are validated independently and the results are read in index order
+            vector<ValidationResult> results(this->rangeLimit);
+            forEachRangedProofChunk(this->rangeLimit, concurrency, [&](uint64_t start,
+                                                                       uint64_t end) {
+                for (auto i = start; i < end; i++) {
+                    if (i >= this->integerProofs.size()) {
+                        results[i] = ValidationResult{
+                          false, {"j: " + to_string(i) + " missing integer proof"}};
+                        continue;
+                    }
+                    results[i] = isValid(message, *this->integerProofs[i], i, k);
+                }
+            });
+
             bool proofsAreValid = true;
             std::vector<std::string> messages;
             for (uint64_t i = 0; i < this->rangeLimit; i++) {
-                auto proof = *this->integerProofs[i];
-                auto isInclonclusive = !proof.commitment.has_value();
-                auto validationResult = isValid(message, proof, i, k);
+                const auto &validationResult = results[i];
+                auto isInclonclusive = i < this->integerProofs.size() &&
+                                       !this->integerProofs[i]->commitment.has_value();
 
                 // if the proof is conclusively invalid, meanining it has a commitment
                 // and the commitment does not match the recomputed commitment
@@ -705,11 +762,10 @@ namespace electionguard
 
     std::unique_ptr<RangedChaumPedersenProof> RangedChaumPedersenProof::clone() const
     {
-        map<uint64_t, unique_ptr<ZeroKnowledgeProof>> _proofs;
-        auto integerProofs = this->getProofs();
-        int index = 0;
-        for (auto &proof : integerProofs) {
-            _proofs[index++] = proof.get().clone();
+        vector<unique_ptr<ZeroKnowledgeProof>> _proofs;
+        _proofs.reserve(pimpl->integerProofs.size());
+        for (const auto &proof : pimpl->integerProofs) {
+            _proofs.push_back(proof->clone());
         }
 
         return make_unique<RangedChaumPedersenProof>(this->getRangeLimit(),
@@ -724,6 +780,19 @@ namespace electionguard
     RangedChaumPedersenProof::RangedChaumPedersenProof(
       uint64_t inRangeLimit, unique_ptr<ElementModQ> challenge,
       map<uint64_t, unique_ptr<ZeroKnowledgeProof>> inProofs)
+    {
+        // the proofs are stored by position in the order of their keys
+        vector<unique_ptr<ZeroKnowledgeProof>> proofs;
+        proofs.reserve(inProofs.size());
+        for (auto &proof : inProofs) {
+            proofs.push_back(move(proof.second));
+        }
+        pimpl = make_unique<Impl>(inRangeLimit, move(challenge), move(proofs));
+    }
+
+    RangedChaumPedersenProof::RangedChaumPedersenProof(
+      uint64_t inRangeLimit, unique_ptr<ElementModQ> challenge,
+      vector<unique_ptr<ZeroKnowledgeProof>> inProofs)
         : pimpl(new Impl(inRangeLimit, move(challenge), move(inProofs)))
     {
     }
@@ -773,63 +842,85 @@ namespace electionguard
     /// </summary>
     unique_ptr<RangedChaumPedersenProof> RangedChaumPedersenProof::make(
       const ElGamalCiphertext &message, const ElementModQ &r, uint64_t selected, uint64_t maxLimit,
-      const ElementModP &k, const ElementModQ &q, const string &hashPrefix, const ElementModQ &seed)
+      const ElementModP &k, const ElementModQ &q, const string &hashPrefix, const ElementModQ &seed,
+      size_t concurrency /* = 1 */)
     {
-        Log::trace("RangedChaumPedersenProof:: making proof");
+        EG_TRACE_SPAN("RangedChaumPedersenProof::make");
+        EG_LOG_TRACE("RangedChaumPedersenProof:: making proof");
 
         auto *alpha = message.getPad();
         auto *beta = message.getData();
         auto l = ElementModQ::fromUint64(selected);
 
-        auto nonces = make_unique<Nonces>(seed, "ranged-chaum-pedersen-proof");
+        Nonces nonces(seed, "ranged-chaum-pedersen-proof");
+
+        // derive every nonce once, 𝑢𝑗 at index 𝑗 and the fake challenge 𝑐𝑗 at index 𝐿 + 𝑗 + 1
+        auto u = nonces.get(0, maxLimit);
+        auto fakeChallenges = nonces.get(maxLimit + 1, maxLimit);
 
-        map<uint64_t, unique_ptr<ElGamalCiphertext>> commitments;
-        map<uint64_t, unique_ptr<ElementModQ>> challenges;
+        vector<unique_ptr<ElGamalCiphertext>> commitments(maxLimit);
+        vector<unique_ptr<ElementModQ>> challenges(maxLimit);
 
         // Compute commitments
-        for (uint64_t i = 0; i < maxLimit; i++) {
-            auto u = nonces->get(i);
-            auto a = g_pow_p(*u); // 𝑔^𝑢 mod 𝑝
-
-            unique_ptr<ElementModQ> cj;
-            unique_ptr<ElementModQ> tj;
-            if (i == selected) {
-                // create the real proof
-                cj = ZERO_MOD_Q().clone();
-                tj = make_unique<ElementModQ>(*u);
-            } else {
-                // create a fake proof
-                auto j = ElementModQ::fromUint64(i);
-
-                // 𝑢 + (𝑙 − 𝑗) ⋅ 𝑐𝑗 mod 𝑞
-                cj = nonces->get(maxLimit + i + 1);
-                tj = add_mod_q(*u, *mul_mod_q(*sub_mod_q(*l, *j), *cj));
+        forEachRangedProofChunk(maxLimit, concurrency, [&](uint64_t start, uint64_t end) {
+            // 𝑔^𝑢 mod 𝑝 walks the fixed base table of 𝑔 for the whole chunk
+            vector<reference_wrapper<const ElementModQ>> exponents;
+            exponents.reserve(end - start);
+            for (auto i = start; i < end; i++) {
+                exponents.push_back(*u[i]);
             }
+            vector<uint64_t> pads((end - start) * MAX_P_LEN);
+            pow_mod_p_batch(G(), exponents, pads.data());
+
+            for (auto i = start; i < end; i++) {
+                unique_ptr<ElementModQ> cj;
+                unique_ptr<ElementModQ> tj;
+                if (i == selected) {
+                    // create the real proof
+                    cj = ZERO_MOD_Q().clone();
+                    tj = make_unique<ElementModQ>(*u[i]);
+                } else {
+                    // create a fake proof
+                    auto j = ElementModQ::fromUint64(i);
+
+                    // 𝑢 + (𝑙 − 𝑗) ⋅ 𝑐𝑗 mod 𝑞
+                    cj = move(fakeChallenges[i]);
+                    tj = add_mod_q(*u[i], *mul_mod_q(*sub_mod_q(*l, *j), *cj));
+                }
 
-            auto b = pow_mod_p(k, *tj); // 𝐾^tj mod 𝑝
+                const auto *pad = pads.data() + (i - start) * MAX_P_LEN;
+                auto a = make_unique<ElementModP>(
+                  *reinterpret_cast<const uint64_t(*)[MAX_P_LEN]>(pad), true);
+                auto b = pow_mod_p(k, *tj); // 𝐾^tj mod 𝑝
 
-            commitments[i] = make_unique<ElGamalCiphertext>(move(a), move(b));
-            challenges[i] = move(cj);
-        }
+                commitments[i] = make_unique<ElGamalCiphertext>(move(a), move(b));
+                challenges[i] = move(cj);
+            }
+        });
 
         // compute the joint challenge
 
         // c = H(HE;21,K,α ̄,β ̄,a0,b0,a1,b1,...,aL,bL). Ballot Contest Limit Encryption Proof 3.3.8
-        auto commitmentReferences = referenceWrap<CryptoHashable>(commitments);
+        vector<reference_wrapper<CryptoHashable>> commitmentReferences;
+        commitmentReferences.reserve(maxLimit);
+        for (const auto &commitment : commitments) {
+            commitmentReferences.emplace_back(*commitment);
+        }
         auto c = hash_elems({&const_cast<ElementModQ &>(q), hashPrefix,
                              &const_cast<ElementModP &>(k), alpha, beta, commitmentReferences});
 
         // Compute the challenge for the selected value
-        // and replace it in the challenges map
+        // when the selected value is outside of the range it has no integer proof to hold it
         auto c_sum = add_mod_q(referenceWrap(challenges));
-        challenges[selected] = sub_mod_q(*c, *c_sum); // 𝑐𝑙 = 𝑐 − ∑𝑐𝑗 mod 𝑞
+        if (selected < maxLimit) {
+            challenges[selected] = sub_mod_q(*c, *c_sum); // 𝑐𝑙 = 𝑐 − ∑𝑐𝑗 mod 𝑞
+        }
 
         // Compute the responses
-        map<uint64_t, unique_ptr<ZeroKnowledgeProof>> responses;
+        vector<unique_ptr<ZeroKnowledgeProof>> responses(maxLimit);
         for (uint64_t i = 0; i < maxLimit; i++) {
-            auto u = nonces->get(i);
             auto cjR = mul_mod_q(*challenges[i], r);
-            auto vj = sub_mod_q(*u, *cjR); // 𝑢 − 𝑐 ⋅ 𝑅 mod 𝑞
+            auto vj = sub_mod_q(*u[i], *cjR); // 𝑢 − 𝑐 ⋅ 𝑅 mod 𝑞
             responses[i] =
               make_unique<ZeroKnowledgeProof>(move(commitments[i]), move(challenges[i]), move(vj));
         }
@@ -841,19 +932,21 @@ namespace electionguard
 
     ValidationResult RangedChaumPedersenProof::isValid(const ElGamalCiphertext &message,
                                                        const ElementModP &k, const ElementModQ &q,
-                                                       const std::string &hashPrefix)
+                                                       const std::string &hashPrefix,
+                                                       size_t concurrency /* = 1 */)
     {
+        EG_TRACE_SPAN("RangedChaumPedersenProof::isValid");
         auto *alpha = message.getPad();
         auto *beta = message.getData();
 
         // validate the integer proofs against the message
-        auto validationResult = pimpl->isValid(message, k);
+        auto validationResult = pimpl->isValid(message, k, concurrency);
         if (!validationResult.isValid) {
             validationResult.isValid = false;
-            Log::info("- Verification 6.5a: invalid ranged computed challenge");
+            EG_LOG_INFO("- Verification 6.5a: invalid ranged computed challenge");
         }
 
-        auto commitments = pimpl->getHashableCommitments(message, k);
+        auto commitments = pimpl->getHashableCommitments(message, k, concurrency);
 
         // Compute the challenge
         // TODO: change the HashPrefix to an input param since it can also be
@@ -873,10 +966,10 @@ namespace electionguard
 
         // print out the error messages if the proof is invalid
         if (!validationResult.isValid) {
-            Log::info("RangedChaumPedersenProof::isValid: found an invalid Range-Bound "
-                      "Chaum-Pedersen proof");
+            EG_LOG_INFO("RangedChaumPedersenProof::isValid: found an invalid Range-Bound "
+                        "Chaum-Pedersen proof");
             for (const auto &message : validationResult.messages) {
-                Log::debug(message);
+                EG_LOG_DEBUG(message);
             }
         }
 
@@ -955,7 +1048,8 @@ namespace electionguard
                                      const ElementModQ &hash_header, uint64_t constant,
                                      bool shouldUsePrecomputedValues /* = false */)
     {
-        Log::trace("ConstantChaumPedersenProof:: making proof");
+        EG_TRACE_SPAN("ConstantChaumPedersenProof::make");
+        EG_LOG_TRACE("ConstantChaumPedersenProof:: making proof");
         auto *alpha = message.getPad();
         auto *beta = message.getData();
 
@@ -966,10 +1060,10 @@ namespace electionguard
         unique_ptr<ElementModP> b; // 𝐾^𝑢 mod 𝑝
 
         if (shouldUsePrecomputedValues) {
-            Log::debug("ConstantChaumPedersenProof:: using precomputed values. Your seed value is "
-                       "ignored and is no longer deterministic.");
+            EG_LOG_DEBUG("ConstantChaumPedersenProof:: using precomputed values. Your seed value "
+                         "is ignored and is no longer deterministic.");
             // check if the are precompute values rather than doing the exponentiations here
-            auto triple = PrecomputeBufferContext::popPrecomputedEncryption();
+            auto triple = PrecomputeBufferContext::popPrecomputedEncryption(k);
             if (triple != nullptr && triple.has_value()) {
                 u = triple.value()->getSecret()->clone();
                 a = triple.value()->getPad()->clone();
@@ -999,7 +1093,8 @@ namespace electionguard
     bool ConstantChaumPedersenProof::isValid(const ElGamalCiphertext &message, const ElementModP &k,
                                              const ElementModQ &q)
     {
-        Log::trace("ConstantChaumPedersenProof::isValid: checking validity");
+        EG_TRACE_SPAN("ConstantChaumPedersenProof::isValid");
+        EG_LOG_TRACE("ConstantChaumPedersenProof::isValid: checking validity");
         auto *alpha = message.getPad();
         auto *beta = message.getData();
 
@@ -1045,20 +1140,20 @@ namespace electionguard
               {"consistent_kv", consistent_kv},
             };
 
-            Log::info("found an invalid Constant Chaum-Pedersen proof", printMap);
+            EG_LOG_INFO("found an invalid Constant Chaum-Pedersen proof", printMap);
 
-            Log::debug("k->get", k.toHex());
-            Log::debug("q->get", q.toHex());
-            Log::debug("alpha->get", alpha->toHex());
-            Log::debug("beta->get", beta->toHex());
-            Log::debug("a->get", a.toHex());
-            Log::debug("b->get", b.toHex());
-            Log::debug("c->get", c.toHex());
-            Log::debug("v->get", v.toHex());
+            EG_LOG_DEBUG("k->get", k.toHex());
+            EG_LOG_DEBUG("q->get", q.toHex());
+            EG_LOG_DEBUG("alpha->get", alpha->toHex());
+            EG_LOG_DEBUG("beta->get", beta->toHex());
+            EG_LOG_DEBUG("a->get", a.toHex());
+            EG_LOG_DEBUG("b->get", b.toHex());
+            EG_LOG_DEBUG("c->get", c.toHex());
+            EG_LOG_DEBUG("v->get", v.toHex());
 
             return false;
         }
-        Log::trace("ConstantChaumPedersenProof::isValid: TRUE!");
+        EG_LOG_TRACE("ConstantChaumPedersenProof::isValid: TRUE!");
         return success;
     }
 #pragma endregion
@@ -1132,7 +1227,7 @@ namespace electionguard
     bool ChaumPedersenProof::isValid(const ElGamalCiphertext &message, const ElementModP &k,
                                      const ElementModP &m, const ElementModQ &q)
     {
-        Log::trace("ChaumPedersenProof::isValid: checking validity");
+        EG_LOG_TRACE("ChaumPedersenProof::isValid: checking validity");
         auto *alpha = message.getPad();
         auto *beta = message.getData();
 
@@ -1177,20 +1272,20 @@ namespace electionguard
         //       {"consistent_kv", consistent_kv},
         //     };
 
-        //     Log::info("found an invalid Constant Chaum-Pedersen proof", printMap);
+        //     EG_LOG_INFO("found an invalid Constant Chaum-Pedersen proof", printMap);
 
-        //     Log::debug("k->get", k.toHex());
-        //     Log::debug("q->get", q.toHex());
-        //     Log::debug("alpha->get", alpha->toHex());
-        //     Log::debug("beta->get", beta->toHex());
-        //     Log::debug("a->get", a.toHex());
-        //     Log::debug("b->get", b.toHex());
-        //     Log::debug("c->get", c.toHex());
-        //     Log::debug("v->get", v.toHex());
+        //     EG_LOG_DEBUG("k->get", k.toHex());
+        //     EG_LOG_DEBUG("q->get", q.toHex());
+        //     EG_LOG_DEBUG("alpha->get", alpha->toHex());
+        //     EG_LOG_DEBUG("beta->get", beta->toHex());
+        //     EG_LOG_DEBUG("a->get", a.toHex());
+        //     EG_LOG_DEBUG("b->get", b.toHex());
+        //     EG_LOG_DEBUG("c->get", c.toHex());
+        //     EG_LOG_DEBUG("v->get", v.toHex());
 
         //     return false;
         // }
-        // Log::trace("ConstantChaumPedersenProof::isValid: TRUE!");
+        // EG_LOG_TRACE("ConstantChaumPedersenProof::isValid: TRUE!");
         return true;
     }
 #pragma endregion
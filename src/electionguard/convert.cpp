@@ -14,18 +14,234 @@
 #include <string>
 #include <vector>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    include <emmintrin.h>
+#    define EG_HEX_SSE2
+#endif
+
 using electionguard::facades::Bignum4096;
 using hacl::Bignum256;
 using std::string;
 using time_point = std::chrono::system_clock::time_point;
 using std::get_time;
 using std::gmtime;
+using std::invalid_argument;
 using std::mktime;
+using std::out_of_range;
 using std::stringstream;
+using std::to_string;
 using std::chrono::system_clock;
 
 namespace electionguard
 {
+#pragma region Hex Codec
+
+    // the hex codec works on fixed width buffers supplied by the caller.
+    // a lookup table handles the scalar path and SSE2 is used when available
+    // to process 16 bytes (32 characters) at a time
+
+    static constexpr char HEX_DIGITS[] = "0123456789ABCDEF";
+    static constexpr uint8_t HEX_INVALID = 0xFF;
+
+    struct HexEncodeTable {
+        char pairs[256][2];
+        constexpr HexEncodeTable() : pairs()
+        {
+            for (size_t i = 0; i < 256; i++) {
+                pairs[i][0] = HEX_DIGITS[i >> 4];
+                pairs[i][1] = HEX_DIGITS[i & 0x0F];
+            }
+        }
+    };
+
+    struct HexDecodeTable {
+        uint8_t nibbles[256];
+        constexpr HexDecodeTable() : nibbles()
+        {
+            for (size_t i = 0; i < 256; i++) {
+                nibbles[i] = HEX_INVALID;
+            }
+            for (uint8_t i = 0; i < 10; i++) {
+                nibbles['0' + i] = i;
+            }
+            for (uint8_t i = 0; i < 6; i++) {
+                nibbles['A' + i] = static_cast<uint8_t>(10 + i);
+                nibbles['a' + i] = static_cast<uint8_t>(10 + i);
+            }
+        }
+    };
+
+    static constexpr HexEncodeTable HEX_ENCODE_TABLE;
+    static constexpr HexDecodeTable HEX_DECODE_TABLE;
+
+    static inline uint8_t decode_nibble(char c)
+    {
+        auto nibble = HEX_DECODE_TABLE.nibbles[static_cast<uint8_t>(c)];
+        if (nibble == HEX_INVALID) {
+            throw invalid_argument("invalid hex character: " + string(1, c));
+        }
+        return nibble;
+    }
+
+#ifdef EG_HEX_SSE2
+    static inline __m128i nibbles_to_ascii(__m128i nibbles)
+    {
+        // '0' + n, plus 7 more to jump from '9' to 'A' when n > 9
+        auto isLetter = _mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9));
+        auto ascii = _mm_add_epi8(nibbles, _mm_set1_epi8('0'));
+        return _mm_add_epi8(ascii, _mm_and_si128(isLetter, _mm_set1_epi8(7)));
+    }
+
+    static inline bool ascii_to_nibbles(__m128i ascii, __m128i *nibbles)
+    {
+        // bytes above 0x7F compare as negative and fail both range checks
+        auto isDigit = _mm_and_si128(_mm_cmpgt_epi8(ascii, _mm_set1_epi8('0' - 1)),
+                                     _mm_cmplt_epi8(ascii, _mm_set1_epi8('9' + 1)));
+        auto upper = _mm_and_si128(ascii, _mm_set1_epi8(static_cast<char>(0xDF)));
+        auto isLetter = _mm_and_si128(_mm_cmpgt_epi8(upper, _mm_set1_epi8('A' - 1)),
+                                      _mm_cmplt_epi8(upper, _mm_set1_epi8('F' + 1)));
+        if (_mm_movemask_epi8(_mm_or_si128(isDigit, isLetter)) != 0xFFFF) {
+            return false;
+        }
+
+        auto digits = _mm_and_si128(isDigit, _mm_sub_epi8(ascii, _mm_set1_epi8('0')));
+        auto letters = _mm_and_si128(isLetter, _mm_sub_epi8(upper, _mm_set1_epi8('A' - 10)));
+        *nibbles = _mm_or_si128(digits, letters);
+        return true;
+    }
+#endif
+
+    size_t hex_encode(const uint8_t *bytes, size_t size, char *out)
+    {
+        size_t i = 0;
+#ifdef EG_HEX_SSE2
+        const auto lowMask = _mm_set1_epi8(0x0F);
+        for (; i + 16 <= size; i += 16) {
+            auto in = _mm_loadu_si128(reinterpret_cast<const __m128i *>(bytes + i));
+            auto high = _mm_and_si128(_mm_srli_epi16(in, 4), lowMask);
+            auto low = _mm_and_si128(in, lowMask);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 2 * i),
+                             nibbles_to_ascii(_mm_unpacklo_epi8(high, low)));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 2 * i + 16),
+                             nibbles_to_ascii(_mm_unpackhi_epi8(high, low)));
+        }
+#endif
+        for (; i < size; i++) {
+            out[2 * i] = HEX_ENCODE_TABLE.pairs[bytes[i]][0];
+            out[2 * i + 1] = HEX_ENCODE_TABLE.pairs[bytes[i]][1];
+        }
+        return size * 2;
+    }
+
+    size_t hex_decode(const char *hex, size_t length, uint8_t *out)
+    {
+        if (length % 2 != 0) {
+            throw invalid_argument("hex string must have an even length: " + to_string(length));
+        }
+
+        size_t i = 0;
+#ifdef EG_HEX_SSE2
+        const auto lowByte = _mm_set1_epi16(0x00FF);
+        for (; i + 32 <= length; i += 32) {
+            __m128i first;
+            __m128i second;
+            if (!ascii_to_nibbles(_mm_loadu_si128(reinterpret_cast<const __m128i *>(hex + i)),
+                                  &first) ||
+                !ascii_to_nibbles(
+                  _mm_loadu_si128(reinterpret_cast<const __m128i *>(hex + i + 16)), &second)) {
+                // let the scalar path report the offending character
+                break;
+            }
+            // each 16 bit lane holds (high nibble, low nibble) in memory order
+            auto firstBytes = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(first, lowByte), 4),
+                                           _mm_srli_epi16(first, 8));
+            auto secondBytes = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(second, lowByte), 4),
+                                            _mm_srli_epi16(second, 8));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i / 2),
+                             _mm_packus_epi16(firstBytes, secondBytes));
+        }
+#endif
+        for (; i < length; i += 2) {
+            out[i / 2] = static_cast<uint8_t>((decode_nibble(hex[i]) << 4) |
+                                              decode_nibble(hex[i + 1]));
+        }
+        return length / 2;
+    }
+
+    size_t limbs_to_hex(const uint64_t *limbs, size_t length, char *out)
+    {
+        if (length > MAX_P_LEN) {
+            throw out_of_range("Cannot convert limbs to hex with length: " + to_string(length));
+        }
+
+        // limbs are stored least significant first
+        uint8_t bytes[MAX_P_SIZE];
+        for (size_t i = 0; i < length; i++) {
+            store64_be(bytes + (length - 1 - i) * sizeof(uint64_t), limbs[i]);
+        }
+
+        // match bytes_to_hex by ignoring any leading 0-bytes
+        size_t size = length * sizeof(uint64_t);
+        size_t first = 0;
+        while (first < size && bytes[first] == 0) {
+            first++;
+        }
+        if (first == size) {
+            out[0] = '0';
+            out[1] = '0';
+            return 2;
+        }
+        return hex_encode(bytes + first, size - first, out);
+    }
+
+    void hex_to_limbs(const char *hex, size_t length, uint64_t *limbs, size_t limbCount)
+    {
+        if (limbCount > MAX_P_LEN) {
+            throw out_of_range("Cannot convert hex to limbs with length: " + to_string(limbCount));
+        }
+
+        // skip the same leading characters as sanitize_hex_string
+        size_t start = 0;
+        while (start < length && LEADING_CHARS.find(hex[start]) != string::npos) {
+            start++;
+        }
+        auto digits = length - start;
+        auto size = limbCount * sizeof(uint64_t);
+        if (digits > size * 2) {
+            throw out_of_range("Cannot convert hex with length: " + to_string(digits));
+        }
+
+        // decode into a zero padded big endian buffer of the target width
+        uint8_t bytes[MAX_P_SIZE] = {};
+        auto offset = size - (digits + 1) / 2;
+        if (digits % 2 != 0) {
+            bytes[offset++] = decode_nibble(hex[start++]);
+            digits--;
+        }
+        hex_decode(hex + start, digits, bytes + offset);
+
+        for (size_t i = 0; i < limbCount; i++) {
+            limbs[i] = load64_be(bytes + (limbCount - 1 - i) * sizeof(uint64_t));
+        }
+    }
+
+    string bytes_to_hex(const uint8_t *bytes, size_t size)
+    {
+        // ignore any initial 0-bytes
+        size_t first = 0;
+        while (first < size && bytes[first] == 0) {
+            first++;
+        }
+        if (first == size) {
+            return "00";
+        }
+        string result((size - first) * 2, '\0');
+        hex_encode(bytes + first, size - first, &result[0]);
+        return result;
+    }
+
+#pragma endregion
+
     vector<uint8_t> bignum_to_bytes(const vector<uint64_t> &bignum)
     {
         size_t offset = sizeof(uint64_t) / sizeof(uint8_t);
@@ -51,20 +267,16 @@ namespace electionguard
 
     string hacl_to_hex_256(uint64_t *data)
     {
-        // Returned bytes array from Hacl needs to be pre-allocated to 32 bytes
-        uint8_t byteResult[MAX_Q_SIZE] = {};
-        // Use Hacl to convert the bignum to byte array
-        hacl::Bignum256::toBytes(static_cast<uint64_t *>(data), static_cast<uint8_t *>(byteResult));
-        return bytes_to_hex(byteResult);
+        char hex[MAX_Q_SIZE * 2];
+        auto length = limbs_to_hex(data, MAX_Q_LEN, static_cast<char *>(hex));
+        return string(static_cast<char *>(hex), length);
     }
 
     string hacl_to_hex_4096(uint64_t *data)
     {
-        // Returned bytes array from Hacl needs to be pre-allocated to 512 bytes
-        uint8_t byteResult[MAX_P_SIZE] = {};
-        // Use Hacl to convert the bignum to byte array
-        Bignum4096::toBytes(static_cast<uint64_t *>(data), static_cast<uint8_t *>(byteResult));
-        return bytes_to_hex(byteResult);
+        char hex[MAX_P_SIZE * 2];
+        auto length = limbs_to_hex(data, MAX_P_LEN, static_cast<char *>(hex));
+        return string(static_cast<char *>(hex), length);
     }
 
     const string defaultFormat = "%FT%TZ";
@@ -52,29 +52,54 @@ namespace electionguard
         return static_cast<uint32_t>(size);
     }
 
+    /// <summary>
+    /// Encode the bytes as upper case hex into the caller provided buffer.
+    /// The buffer must hold at least 2 * size characters.
+    /// Returns the number of characters written.
+    /// </summary>
+    EG_INTERNAL_API size_t hex_encode(const uint8_t *bytes, size_t size, char *out);
+
+    /// <summary>
+    /// Decode an even length hex string into the caller provided buffer.
+    /// The buffer must hold at least length / 2 bytes.
+    /// Throws invalid_argument if a character is not a hex digit.
+    /// Returns the number of bytes written.
+    /// </summary>
+    EG_INTERNAL_API size_t hex_decode(const char *hex, size_t length, uint8_t *out);
+
+    /// <summary>
+    /// Encode a little endian limb array as a big endian hex string without
+    /// leading zero bytes (or "00" when the value is zero), matching `bytes_to_hex`.
+    /// The buffer must hold at least length * 16 characters.
+    /// Returns the number of characters written.
+    /// </summary>
+    EG_INTERNAL_API size_t limbs_to_hex(const uint64_t *limbs, size_t length, char *out);
+
+    /// <summary>
+    /// Decode a big endian hex string into a zero padded little endian limb array.
+    /// Leading zeros and whitespace are ignored, matching `sanitize_hex_string`.
+    /// Throws out_of_range if the value does not fit in limbCount limbs.
+    /// </summary>
+    EG_INTERNAL_API void hex_to_limbs(const char *hex, size_t length, uint64_t *limbs,
+                                      size_t limbCount);
+
+    EG_INTERNAL_API string bytes_to_hex(const uint8_t *bytes, size_t size);
+
     inline void hex_to_bytes(const string &hex, uint8_t *bytesOut)
     {
-        const size_t baseHex = 16;
-        for (size_t i(0); i < hex.size(); i += 2) {
-            string byteString = hex.substr(i, 2);
-            uint16_t as_int = static_cast<uint16_t>(stoi(byteString, nullptr, baseHex));
-            uint8_t byte = static_cast<uint8_t>(as_int);
-            bytesOut[i / 2] = byte;
+        auto even = hex.size() - (hex.size() % 2);
+        hex_decode(hex.data(), even, bytesOut);
+        if (even != hex.size()) {
+            // a trailing odd character is treated as a single byte
+            const char last[] = {'0', hex.back()};
+            hex_decode(static_cast<const char *>(last), sizeof(last), bytesOut + even / 2);
         }
     }
 
     inline vector<uint8_t> hex_to_bytes(const string &hexString)
     {
-        vector<uint8_t> bytes;
-        const size_t baseHex = 16;
-        for (size_t i = 0; i < hexString.size(); i += 2) {
-            auto byteString = hexString.substr(i, 2);
-            uint16_t as_int = static_cast<uint16_t>(stoi(byteString, nullptr, baseHex));
-            uint8_t array[sizeof(uint16_t)];
-            memmove(&array, &as_int, sizeof(as_int));
-            bytes.push_back(array[0]);
-        }
-
+        vector<uint8_t> bytes((hexString.size() + 1) / 2);
+        hex_to_bytes(hexString, bytes.data());
         return bytes;
     }
 
@@ -170,37 +195,12 @@ namespace electionguard
 
     inline string bytes_to_hex(const vector<uint8_t> &bytes)
     {
-        // Iterate through the returned bytes to convert to Hex representation
-        // while ignoring any initial 0-bytes
-        bool detectedFirstNonZeroBytes = false;
-        stringstream stream;
-        stream << hex << uppercase;
-        for (auto byte : bytes) {
-            if (!detectedFirstNonZeroBytes && byte != 0) {
-                detectedFirstNonZeroBytes = true;
-            }
-            if (detectedFirstNonZeroBytes) {
-                stream << setw(2) << setfill('0') << static_cast<uint16_t>(byte);
-            }
-        }
-
-        return detectedFirstNonZeroBytes ? (stream.str()) : "00";
+        return bytes_to_hex(bytes.data(), bytes.size());
     }
 
     template <typename T, size_t S> string bytes_to_hex(T (&data)[S])
     {
-        vector<T> vec(begin(data), end(data));
-        auto result = bytes_to_hex(vec);
-        release(vec);
-        return result;
-    }
-
-    template <typename T> string bytes_to_hex(T *data, size_t size)
-    {
-        vector<T> vec(begin(data), data + size);
-        auto result = bytes_to_hex(vec);
-        release(vec);
-        return result;
+        return bytes_to_hex(static_cast<const uint8_t *>(data), S);
     }
 
     inline string bignum_to_hex_string(const vector<uint64_t> &bignum)
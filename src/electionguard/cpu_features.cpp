@@ -0,0 +1,105 @@
+#include "cpu_features.hpp"
+
+#include <cstdint>
+
+#ifdef EG_CPU_X64
+#    if defined(_MSC_VER)
+#        include <intrin.h>
+#    else
+#        include <cpuid.h>
+#    endif
+#endif
+
+namespace electionguard
+{
+#ifdef EG_CPU_X64
+    // cpuid leaf 1 ecx
+    constexpr uint32_t CPUID_SSE41 = 1U << 19;
+    constexpr uint32_t CPUID_OSXSAVE = 1U << 27;
+    // cpuid leaf 7 ebx
+    constexpr uint32_t CPUID_AVX2 = 1U << 5;
+    constexpr uint32_t CPUID_AVX512F = 1U << 16;
+    constexpr uint32_t CPUID_AVX512IFMA = 1U << 21;
+    constexpr uint32_t CPUID_SHA = 1U << 29;
+    // xcr0: sse and avx state enabled by the os
+    constexpr uint64_t XCR0_AVX_STATE = 0x06;
+    // xcr0: sse, avx, opmask, zmm0-15 upper halves and zmm16-31 state enabled by the os
+    constexpr uint64_t XCR0_AVX512_STATE = 0xE6;
+
+    struct CpuId {
+        uint32_t leaf1Ecx = 0;
+        uint32_t leaf7Ebx = 0;
+        uint64_t xcr0 = 0;
+    };
+
+    static void cpuid(uint32_t leaf, uint32_t subleaf, uint32_t (&registers)[4])
+    {
+#    if defined(_MSC_VER)
+        int info[4];
+        __cpuidex(info, static_cast<int>(leaf), static_cast<int>(subleaf));
+        for (size_t i = 0; i < 4; i++) {
+            registers[i] = static_cast<uint32_t>(info[i]);
+        }
+#    else
+        __cpuid_count(leaf, subleaf, registers[0], registers[1], registers[2], registers[3]);
+#    endif
+    }
+
+    static uint64_t xgetbv()
+    {
+#    if defined(_MSC_VER)
+        return _xgetbv(0);
+#    else
+        uint32_t eax = 0;
+        uint32_t edx = 0;
+        __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+        return (static_cast<uint64_t>(edx) << 32) | eax;
+#    endif
+    }
+
+    static const CpuId &getCpuId()
+    {
+        static const CpuId instance = [] {
+            CpuId result;
+            uint32_t registers[4];
+            cpuid(0, 0, registers);
+            auto maxLeaf = registers[0];
+
+            cpuid(1, 0, registers);
+            result.leaf1Ecx = registers[2];
+            if ((result.leaf1Ecx & CPUID_OSXSAVE) != 0) {
+                result.xcr0 = xgetbv();
+            }
+            if (maxLeaf >= 7) {
+                cpuid(7, 0, registers);
+                result.leaf7Ebx = registers[1];
+            }
+            return result;
+        }();
+        return instance;
+    }
+
+    bool CpuFeatures::hasAvx2()
+    {
+        const auto &id = getCpuId();
+        return (id.xcr0 & XCR0_AVX_STATE) == XCR0_AVX_STATE && (id.leaf7Ebx & CPUID_AVX2) != 0;
+    }
+
+    bool CpuFeatures::hasAvx512Ifma()
+    {
+        const auto &id = getCpuId();
+        return (id.xcr0 & XCR0_AVX512_STATE) == XCR0_AVX512_STATE &&
+               (id.leaf7Ebx & CPUID_AVX512F) != 0 && (id.leaf7Ebx & CPUID_AVX512IFMA) != 0;
+    }
+
+    bool CpuFeatures::hasShaNi()
+    {
+        const auto &id = getCpuId();
+        return (id.leaf1Ecx & CPUID_SSE41) != 0 && (id.leaf7Ebx & CPUID_SHA) != 0;
+    }
+#else
+    bool CpuFeatures::hasAvx2() { return false; }
+    bool CpuFeatures::hasAvx512Ifma() { return false; }
+    bool CpuFeatures::hasShaNi() { return false; }
+#endif
+} // namespace electionguard
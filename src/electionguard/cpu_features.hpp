@@ -0,0 +1,28 @@
+#ifndef __ELECTIONGUARD_CPP_CPU_FEATURES_HPP_INCLUDED__
+#define __ELECTIONGUARD_CPP_CPU_FEATURES_HPP_INCLUDED__
+
+#include <electionguard/export.h>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#    define EG_CPU_X64
+#endif
+
+namespace electionguard
+{
+    /// <summary>
+    /// Instruction set extensions used by the runtime dispatched code paths.
+    ///
+    /// Each check covers both the cpu and the operating system, so a feature is only
+    /// reported when its registers are saved across context switches.
+    /// The results are detected once and cached.
+    /// </summary>
+    class EG_INTERNAL_API CpuFeatures
+    {
+      public:
+        static bool hasAvx2();
+        static bool hasAvx512Ifma();
+        static bool hasShaNi();
+    };
+} // namespace electionguard
+
+#endif /* __ELECTIONGUARD_CPP_CPU_FEATURES_HPP_INCLUDED__ */
@@ -0,0 +1,312 @@
+#include "electionguard/decrypt.hpp"
+
+#include "electionguard/async.hpp"
+#include "electionguard/discrete_log.hpp"
+#include "electionguard/hash.hpp"
+#include "log.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+using std::copy;
+using std::invalid_argument;
+using std::make_unique;
+using std::min;
+using std::move;
+using std::out_of_range;
+using std::reference_wrapper;
+using std::unique_ptr;
+using std::vector;
+
+namespace electionguard
+{
+    // the number of ciphertexts handled by one task, large enough that the
+    // interleaved table walk of the commitments has lanes to fill
+    constexpr size_t DECRYPTION_CHUNK_SIZE = 16;
+
+    static unique_ptr<ElementModP> elementModPFromLimbs(const uint64_t *limbs)
+    {
+        return make_unique<ElementModP>(*reinterpret_cast<const uint64_t(*)[MAX_P_LEN]>(limbs),
+                                        true);
+    }
+
+    /// the ciphertexts come from the caller, so unlike the generated values
+    /// they are checked to be in [1, p) before they meet the secret key
+    static unique_ptr<ElementModP> ciphertextElementFromLimbs(const uint64_t *limbs)
+    {
+        auto element = elementModPFromLimbs(limbs);
+        if (!element->isInBounds()) {
+            throw invalid_argument("computeDecryptionShares requires ciphertexts in [1, p)");
+        }
+        return element;
+    }
+
+    static unique_ptr<ElementModQ> elementModQFromLimbs(const uint64_t *limbs)
+    {
+        return make_unique<ElementModQ>(*reinterpret_cast<const uint64_t(*)[MAX_Q_LEN]>(limbs),
+                                        true);
+    }
+
+#pragma region DecryptionShareBatch
+
+    struct DecryptionShareBatch::Impl {
+        size_t size;
+        vector<uint64_t> shares;
+        // the pads of every commitment followed by the data of every commitment
+        vector<uint64_t> commitments;
+        vector<uint64_t> challenges;
+        vector<uint64_t> responses;
+
+        explicit Impl(size_t size)
+            : size(size), shares(size * MAX_P_LEN), commitments(2 * size * MAX_P_LEN),
+              challenges(size * MAX_Q_LEN), responses(size * MAX_Q_LEN)
+        {
+        }
+    };
+
+    // Lifecycle Methods
+
+    DecryptionShareBatch::DecryptionShareBatch(size_t size) : pimpl(new Impl(size)) {}
+
+    DecryptionShareBatch::DecryptionShareBatch(DecryptionShareBatch &&other)
+        : pimpl(move(other.pimpl))
+    {
+    }
+
+    DecryptionShareBatch::~DecryptionShareBatch() = default;
+
+    // Operator Overloads
+
+    DecryptionShareBatch &DecryptionShareBatch::operator=(DecryptionShareBatch &&rhs)
+    {
+        swap(pimpl, rhs.pimpl);
+        return *this;
+    }
+
+    // Property Getters
+
+    size_t DecryptionShareBatch::size() const { return pimpl->size; }
+
+    const uint64_t *DecryptionShareBatch::getShare(size_t index) const
+    {
+        return pimpl->shares.data() + index * MAX_P_LEN;
+    }
+
+    const uint64_t *DecryptionShareBatch::getCommitmentPad(size_t index) const
+    {
+        return pimpl->commitments.data() + index * MAX_P_LEN;
+    }
+
+    const uint64_t *DecryptionShareBatch::getCommitmentData(size_t index) const
+    {
+        return pimpl->commitments.data() + (pimpl->size + index) * MAX_P_LEN;
+    }
+
+    const uint64_t *DecryptionShareBatch::getChallenge(size_t index) const
+    {
+        return pimpl->challenges.data() + index * MAX_Q_LEN;
+    }
+
+    const uint64_t *DecryptionShareBatch::getResponse(size_t index) const
+    {
+        return pimpl->responses.data() + index * MAX_Q_LEN;
+    }
+
+    uint64_t *DecryptionShareBatch::getMutableShare(size_t index)
+    {
+        return pimpl->shares.data() + index * MAX_P_LEN;
+    }
+
+    uint64_t *DecryptionShareBatch::getMutableCommitmentPad(size_t index)
+    {
+        return pimpl->commitments.data() + index * MAX_P_LEN;
+    }
+
+    uint64_t *DecryptionShareBatch::getMutableCommitmentData(size_t index)
+    {
+        return pimpl->commitments.data() + (pimpl->size + index) * MAX_P_LEN;
+    }
+
+    uint64_t *DecryptionShareBatch::getMutableChallenge(size_t index)
+    {
+        return pimpl->challenges.data() + index * MAX_Q_LEN;
+    }
+
+    uint64_t *DecryptionShareBatch::getMutableResponse(size_t index)
+    {
+        return pimpl->responses.data() + index * MAX_Q_LEN;
+    }
+
+    // Public Methods
+
+    unique_ptr<ElementModP> DecryptionShareBatch::getShareElement(size_t index) const
+    {
+        if (index >= pimpl->size) {
+            throw out_of_range("share index is outside of the batch");
+        }
+        return elementModPFromLimbs(getShare(index));
+    }
+
+    unique_ptr<ChaumPedersenProof> DecryptionShareBatch::getProof(size_t index) const
+    {
+        if (index >= pimpl->size) {
+            throw out_of_range("share index is outside of the batch");
+        }
+        return make_unique<ChaumPedersenProof>(
+          elementModPFromLimbs(getCommitmentPad(index)),
+          elementModPFromLimbs(getCommitmentData(index)),
+          elementModQFromLimbs(getChallenge(index)), elementModQFromLimbs(getResponse(index)));
+    }
+
+#pragma endregion
+
+    DecryptionShareBatch computeDecryptionShares(const ElGamalCiphertextBatch &ciphertexts,
+                                                 const ElementModQ &secretKey,
+                                                 const ElementModQ &extendedBaseHash,
+                                                 const ElementModQ &nonceSeed, size_t concurrency)
+    {
+        auto count = ciphertexts.size();
+        DecryptionShareBatch shares(count);
+        if (count == 0) {
+            return shares;
+        }
+
+        // 𝐾𝑖 = 𝑔^𝑠𝑖 mod 𝑝 is the same for every proof
+        auto publicKey = g_pow_p(secretKey);
+
+        auto chunks = (count + DECRYPTION_CHUNK_SIZE - 1) / DECRYPTION_CHUNK_SIZE;
+        map_async<bool>(chunks, concurrency, [&](size_t chunk) {
+            auto start = chunk * DECRYPTION_CHUNK_SIZE;
+            auto end = min(start + DECRYPTION_CHUNK_SIZE, count);
+
+            // 𝑢𝑖 = H(seed;30,𝐻𝐸,𝐾𝑖,𝐴,𝐵) is bound to the ciphertext rather than its position,
+            // so reusing the seed for another batch never pairs a nonce with two challenges
+            vector<unique_ptr<ElementModP>> alphas;
+            vector<unique_ptr<ElementModP>> betas;
+            vector<unique_ptr<ElementModQ>> u;
+            vector<reference_wrapper<const ElementModQ>> exponents;
+            alphas.reserve(end - start);
+            betas.reserve(end - start);
+            u.reserve(end - start);
+            exponents.reserve(end - start);
+            for (auto i = start; i < end; i++) {
+                alphas.push_back(ciphertextElementFromLimbs(ciphertexts.getPad(i)));
+                betas.push_back(ciphertextElementFromLimbs(ciphertexts.getData(i)));
+                u.push_back(hash_elems({&const_cast<ElementModQ &>(nonceSeed),
+                                        HashPrefix::get_prefix_decrypt_selection_proof(),
+                                        &const_cast<ElementModQ &>(extendedBaseHash),
+                                        publicKey.get(), alphas.back().get(),
+                                        betas.back().get()}));
+                exponents.push_back(*u.back());
+            }
+
+            // 𝑎𝑖 = 𝑔^𝑢𝑖 mod 𝑝 walks the fixed base table of 𝑔 for the whole chunk
+            pow_mod_p_batch(G(), exponents, shares.getMutableCommitmentPad(start));
+
+            for (auto i = start; i < end; i++) {
+                const auto &nonce = *u[i - start];
+                const auto &alpha = alphas[i - start];
+                const auto &beta = betas[i - start];
+                auto a = elementModPFromLimbs(shares.getCommitmentPad(i));
+
+                auto m = pow_mod_p(*alpha, secretKey); // 𝑀𝑖 = 𝐴^𝑠𝑖 mod 𝑝
+                auto b = pow_mod_p(*alpha, nonce);     // 𝑏𝑖 = 𝐴^𝑢𝑖 mod 𝑝
+
+                // 𝑐𝑖 = H(𝐻𝐸;30,𝐾𝑖,𝐴,𝐵,𝑎𝑖,𝑏𝑖,𝑀𝑖)
+                auto c = hash_elems({HashPrefix::get_prefix_decrypt_selection_proof(),
+                                     &const_cast<ElementModQ &>(extendedBaseHash),
+                                     publicKey.get(), alpha.get(), beta.get(), a.get(), b.get(),
+                                     m.get()});
+
+                // 𝑣𝑖 = (𝑢𝑖 − 𝑐𝑖 ⋅ 𝑠𝑖) mod 𝑞
+                auto v = a_minus_bc_mod_q(nonce, *c, secretKey);
+
+                copy(m->cget(), m->cget() + MAX_P_LEN, shares.getMutableShare(i));
+                copy(b->cget(), b->cget() + MAX_P_LEN, shares.getMutableCommitmentData(i));
+                copy(c->cget(), c->cget() + MAX_Q_LEN, shares.getMutableChallenge(i));
+                copy(v->cget(), v->cget() + MAX_Q_LEN, shares.getMutableResponse(i));
+            }
+            return true;
+        });
+
+        EG_LOG_TRACE("Generated Batch Decryption Shares");
+        return shares;
+    }
+
+    vector<uint64_t>
+    combineDecryptionShares(const ElGamalCiphertextBatch &ciphertexts,
+                            const vector<reference_wrapper<const DecryptionShareBatch>> &shares,
+                            const vector<reference_wrapper<const ElementModQ>> &coefficients,
+                            const ElementModP &base, size_t concurrency)
+    {
+        vector<const uint64_t *> limbs;
+        limbs.reserve(shares.size());
+        for (const auto &guardianShares : shares) {
+            if (guardianShares.get().size() != ciphertexts.size()) {
+                throw invalid_argument("combineDecryptionShares requires a share per ciphertext");
+            }
+            limbs.push_back(guardianShares.get().getShare(0));
+        }
+        return combineDecryptionShares(ciphertexts, limbs, coefficients, base, concurrency);
+    }
+
+    vector<uint64_t>
+    combineDecryptionShares(const ElGamalCiphertextBatch &ciphertexts,
+                            const vector<const uint64_t *> &shares,
+                            const vector<reference_wrapper<const ElementModQ>> &coefficients,
+                            const ElementModP &base, size_t concurrency)
+    {
+        if (shares.size() != coefficients.size()) {
+            throw invalid_argument("combineDecryptionShares requires a coefficient per guardian");
+        }
+
+        auto count = ciphertexts.size();
+        if (count == 0) {
+            return {};
+        }
+
+        // 𝑇 = 𝐵 ⋅ 𝑀^−1 mod 𝑝 for every ciphertext
+        vector<uint64_t> products(count * MAX_P_LEN);
+        auto chunks = (count + DECRYPTION_CHUNK_SIZE - 1) / DECRYPTION_CHUNK_SIZE;
+        map_async<bool>(chunks, concurrency, [&](size_t chunk) {
+            auto start = chunk * DECRYPTION_CHUNK_SIZE;
+            auto end = min(start + DECRYPTION_CHUNK_SIZE, count);
+
+            // 𝑀 = ∏ 𝑀𝑖^𝑤𝑖 mod 𝑝
+            vector<uint64_t> accumulations((end - start) * MAX_P_LEN);
+            for (auto i = start; i < end; i++) {
+                vector<unique_ptr<ElementModP>> guardianShares;
+                vector<reference_wrapper<const ElementModP>> bases;
+                guardianShares.reserve(shares.size());
+                bases.reserve(shares.size());
+                for (const auto *guardianShare : shares) {
+                    guardianShares.push_back(elementModPFromLimbs(guardianShare + i * MAX_P_LEN));
+                    bases.push_back(*guardianShares.back());
+                }
+                auto accumulation = pow_mod_p_multi(bases, coefficients);
+                copy(accumulation->cget(), accumulation->cget() + MAX_P_LEN,
+                     accumulations.data() + (i - start) * MAX_P_LEN);
+            }
+
+            div_mod_p_batch(ciphertexts.getData(start), accumulations.data(), end - start,
+                            products.data() + start * MAX_P_LEN);
+            return true;
+        });
+
+        // the discrete logs share one walk of the cache for the whole batch
+        vector<unique_ptr<ElementModP>> elements;
+        vector<reference_wrapper<const ElementModP>> elementRefs;
+        elements.reserve(count);
+        elementRefs.reserve(count);
+        for (size_t i = 0; i < count; i++) {
+            elements.push_back(elementModPFromLimbs(products.data() + i * MAX_P_LEN));
+            elementRefs.push_back(*elements.back());
+        }
+        auto plaintexts = DiscreteLog::getAsync(elementRefs, base);
+
+        EG_LOG_TRACE("Combined Batch Decryption Shares");
+        return plaintexts;
+    }
+
+} // namespace electionguard
@@ -2,6 +2,7 @@
 
 #include "electionguard/constants.h"
 #include "electionguard/group.hpp"
+#include "electionguard/metrics.hpp"
 #include "log.hpp"
 
 #include <array>
@@ -34,17 +35,48 @@ namespace electionguard
             // search for the existing element and return it if found
             auto iter = getInstance().cache.find(element);
             if (iter != getInstance().cache.end()) {
+                Metrics::increment(Metric::discreteLogCacheHits);
                 return iter->second;
             }
         }
 
         {
+            Metrics::increment(Metric::discreteLogCacheMisses);
             // otherwise, calculate the discrete log value
             auto cached = getInstance().computeCache(element, base);
             return cached;
         }
     }
 
+    std::vector<uint64_t>
+    DiscreteLog::getAsync(const std::vector<std::reference_wrapper<const ElementModP>> &elements,
+                          const ElementModP &base)
+    {
+        std::vector<uint64_t> results(elements.size());
+        std::vector<size_t> missing;
+
+        // look up every element that is already cached for the base
+        auto existingBase = getInstance().base.get();
+        auto &cache = getInstance().cache;
+        for (size_t i = 0; i < elements.size(); i++) {
+            if (existingBase != nullptr && base == *existingBase) {
+                auto iter = cache.find(elements[i].get());
+                if (iter != cache.end()) {
+                    Metrics::increment(Metric::discreteLogCacheHits);
+                    results[i] = iter->second;
+                    continue;
+                }
+            }
+            Metrics::increment(Metric::discreteLogCacheMisses);
+            missing.push_back(i);
+        }
+
+        if (!missing.empty()) {
+            getInstance().computeCache(elements, base, results, missing);
+        }
+        return results;
+    }
+
     uint64_t DiscreteLog::computeCache(const ElementModP &element)
     {
         return computeCache(element, G());
@@ -99,4 +131,50 @@ namespace electionguard
         // return the exponent since we already have the value
         return exponent;
     }
-} // namespace electionguard
\ No newline at end of file
+
+    void DiscreteLog::computeCache(
+      const std::vector<std::reference_wrapper<const ElementModP>> &elements,
+      const ElementModP &base, std::vector<uint64_t> &results, const std::vector<size_t> &missing)
+    {
+        // the first missing element resets the table if the base changed
+        // and extends it up to its own exponent
+        results[missing.front()] = computeCache(elements[missing.front()].get(), base);
+
+        // the remaining elements are either now cached or larger than the last exponent,
+        // so they are all found while extending the table a single time
+        std::unordered_map<ElementModP, std::vector<size_t>, KeyHash, KeyEqual> pending;
+        for (auto it = missing.begin() + 1; it != missing.end(); it++) {
+            const auto &element = elements[*it].get();
+            auto iter = cache.find(element);
+            if (iter != cache.end()) {
+                results[*it] = iter->second;
+            } else {
+                pending[element].push_back(*it);
+            }
+        }
+        if (pending.empty()) {
+            return;
+        }
+
+        // the exponent of the first missing element is now the largest in the cache
+        auto exponent = results[missing.front()];
+        auto lastElement = elements[missing.front()].get();
+        while (!pending.empty()) {
+            exponent++;
+            if (exponent > DLOG_MAX_SIZE) {
+                throw std::out_of_range("computeCache: size is larger than max.");
+            }
+
+            lastElement = *mul_mod_p(*this->base, lastElement);
+            cache[lastElement] = exponent;
+
+            auto iter = pending.find(lastElement);
+            if (iter != pending.end()) {
+                for (auto index : iter->second) {
+                    results[index] = exponent;
+                }
+                pending.erase(iter);
+            }
+        }
+    }
+} // namespace electionguard
@@ -52,6 +52,7 @@ namespace electionguard
             this->quorum = quorum;
             this->extendedData = {};
             this->configuration = make_unique<ContextConfiguration>();
+            cacheRepresentations();
         }
 
         Impl(uint64_t numberOfGuardians, uint64_t quorum, unique_ptr<ElementModP> elGamalPublicKey,
@@ -79,6 +80,7 @@ namespace electionguard
             this->numberOfGuardians = numberOfGuardians;
             this->quorum = quorum;
             this->configuration = make_unique<ContextConfiguration>();
+            cacheRepresentations();
         }
 
         Impl(uint64_t numberOfGuardians, uint64_t quorum, unique_ptr<ElementModP> elGamalPublicKey,
@@ -93,6 +95,27 @@ namespace electionguard
             this->quorum = quorum;
             this->configuration = move(config);
         }
+
+        /// <summary>
+        /// The context values are hashed into every ballot, so keep their representations cached.
+        /// The public key is the base of every encryption, so it always uses a lookup table,
+        /// and it is registered so that any other element holding the key uses the same table
+        /// </summary>
+        void cacheRepresentations()
+        {
+            if (elGamalPublicKey != nullptr) {
+                elGamalPublicKey->setIsFixedBase(true);
+                elGamalPublicKey->setIsCacheable(true);
+                register_fixed_base(*elGamalPublicKey);
+                register_fixed_base(G());
+            }
+            for (auto *hash : {commitmentHash.get(), manifestHash.get(), cryptoBaseHash.get(),
+                               cryptoExtendedBaseHash.get()}) {
+                if (hash != nullptr) {
+                    hash->setIsCacheable(true);
+                }
+            }
+        }
     };
 
     // Lifecycle Methods
@@ -16,9 +16,11 @@
 
 using electionguard::HMAC;
 using electionguard::facades::Bignum4096;
+using std::copy;
 using std::invalid_argument;
 using std::make_unique;
 using std::move;
+using std::out_of_range;
 using std::reference_wrapper;
 using std::runtime_error;
 using std::unique_ptr;
@@ -31,6 +33,9 @@ namespace electionguard
         Impl(unique_ptr<ElementModQ> secretKey, unique_ptr<ElementModP> publicKey)
             : secretKey(move(secretKey)), publicKey(move(publicKey))
         {
+            if (this->secretKey != nullptr) {
+                this->secretKey->setIsSecret(true);
+            }
         }
 
         unique_ptr<ElementModQ> secretKey;
@@ -330,10 +335,10 @@ namespace electionguard
             data = mul_mod_p(*message, blindingFactor); // B^V * K^R mod p
         }
 
-        Log::trace("Compatible Base Generated Encryption");
-        Log::trace("publicKey", publicKey.toHex());
-        Log::trace("pad", pad->toHex());
-        Log::trace("data", data->toHex());
+        EG_LOG_TRACE("Compatible Base Generated Encryption");
+        EG_LOG_TRACE("publicKey", publicKey.toHex());
+        EG_LOG_TRACE("pad", pad->toHex());
+        EG_LOG_TRACE("data", data->toHex());
 
         return make_unique<ElGamalCiphertext>(move(pad), move(data));
     }
@@ -360,10 +365,10 @@ namespace electionguard
 
         auto data = pow_mod_p(publicKey, *exponent); // K^(V+R) mod p
 
-        Log::trace("Base-K Generated Encryption");
-        Log::trace("publicKey", publicKey.toHex());
-        Log::trace("pad", pad->toHex());
-        Log::trace("data", data->toHex());
+        EG_LOG_TRACE("Base-K Generated Encryption");
+        EG_LOG_TRACE("publicKey", publicKey.toHex());
+        EG_LOG_TRACE("pad", pad->toHex());
+        EG_LOG_TRACE("data", data->toHex());
 
         return make_unique<ElGamalCiphertext>(move(pad), move(data));
     }
@@ -395,6 +400,118 @@ namespace electionguard
         return elgamalEncrypt(m, move(pad), *blindingFactor, publicKey, publicKey);
     }
 
+#pragma region ElGamalCiphertextBatch
+
+    struct ElGamalCiphertextBatch::Impl {
+        size_t size;
+        // the pads of every ciphertext followed by the data of every ciphertext
+        vector<uint64_t> limbs;
+
+        explicit Impl(size_t size) : size(size), limbs(2 * size * MAX_P_LEN) {}
+    };
+
+    // Lifecycle Methods
+
+    ElGamalCiphertextBatch::ElGamalCiphertextBatch(size_t size) : pimpl(new Impl(size)) {}
+
+    ElGamalCiphertextBatch::ElGamalCiphertextBatch(ElGamalCiphertextBatch &&other)
+        : pimpl(move(other.pimpl))
+    {
+    }
+
+    ElGamalCiphertextBatch::~ElGamalCiphertextBatch() = default;
+
+    // Operator Overloads
+
+    ElGamalCiphertextBatch &ElGamalCiphertextBatch::operator=(ElGamalCiphertextBatch &&rhs)
+    {
+        swap(pimpl, rhs.pimpl);
+        return *this;
+    }
+
+    // Property Getters
+
+    size_t ElGamalCiphertextBatch::size() const { return pimpl->size; }
+
+    uint64_t *ElGamalCiphertextBatch::getPad(size_t index)
+    {
+        return pimpl->limbs.data() + index * MAX_P_LEN;
+    }
+
+    const uint64_t *ElGamalCiphertextBatch::getPad(size_t index) const
+    {
+        return pimpl->limbs.data() + index * MAX_P_LEN;
+    }
+
+    uint64_t *ElGamalCiphertextBatch::getData(size_t index)
+    {
+        return pimpl->limbs.data() + (pimpl->size + index) * MAX_P_LEN;
+    }
+
+    const uint64_t *ElGamalCiphertextBatch::getData(size_t index) const
+    {
+        return pimpl->limbs.data() + (pimpl->size + index) * MAX_P_LEN;
+    }
+
+    // Public Methods
+
+    unique_ptr<ElGamalCiphertext> ElGamalCiphertextBatch::getCiphertext(size_t index) const
+    {
+        if (index >= pimpl->size) {
+            throw out_of_range("ciphertext index is outside of the batch");
+        }
+        uint64_t pad[MAX_P_LEN] = {};
+        uint64_t data[MAX_P_LEN] = {};
+        copy(getPad(index), getPad(index) + MAX_P_LEN, pad);
+        copy(getData(index), getData(index) + MAX_P_LEN, data);
+        return make_unique<ElGamalCiphertext>(make_unique<ElementModP>(pad, true),
+                                              make_unique<ElementModP>(data, true));
+    }
+
+#pragma endregion
+
+    ElGamalCiphertextBatch
+    elgamalEncryptBatch(const vector<uint64_t> &messages,
+                        const vector<reference_wrapper<const ElementModQ>> &nonces,
+                        const ElementModP &publicKey)
+    {
+        if (messages.size() != nonces.size()) {
+            throw invalid_argument("elgamalEncryptBatch requires a nonce for each message");
+        }
+
+        // E.G. 2.0 Base-K ElGamal Encrypt in realtime.
+        // (g^R mod p, K^(V+R) mod p) for every message
+        vector<unique_ptr<ElementModQ>> sums;
+        vector<reference_wrapper<const ElementModQ>> exponents;
+        exponents.reserve(messages.size());
+        for (size_t i = 0; i < messages.size(); i++) {
+            const auto &nonce = nonces[i].get();
+            if ((const_cast<ElementModQ &>(nonce) == ZERO_MOD_Q())) {
+                throw invalid_argument("elgamalEncryptBatch encryption requires a non-zero nonce");
+            }
+            if (messages[i] == 0) {
+                exponents.push_back(nonce); // (V+0)
+                continue;
+            }
+            if (messages[i] == 1) {
+                sums.push_back(add_mod_q(nonce, ONE_MOD_Q())); // (V+1)
+            } else {
+                sums.push_back(add_mod_q(nonce, *ElementModQ::fromUint64(messages[i]))); // (V+R)
+            }
+            exponents.push_back(*sums.back());
+        }
+
+        ElGamalCiphertextBatch batch(messages.size());
+        if (messages.empty()) {
+            return batch;
+        }
+        pow_mod_p_batch(G(), nonces, batch.getPad(0));             // g^R mod p
+        pow_mod_p_batch(publicKey, exponents, batch.getData(0)); // K^(V+R) mod p
+
+        EG_LOG_TRACE("Base-K Generated Batch Encryption");
+        return batch;
+    }
+
     unique_ptr<ElGamalCiphertext>
     elgamalAdd(const vector<reference_wrapper<ElGamalCiphertext>> &ciphertexts)
     {
@@ -701,7 +818,7 @@ namespace electionguard
 
         if (usePrecompute) {
             // check if the are precompute values rather than doing the exponentiations here
-            auto triple = PrecomputeBufferContext::popPrecomputedEncryption();
+            auto triple = PrecomputeBufferContext::popPrecomputedEncryption(publicKey);
             if (triple != nullptr && triple.has_value()) {
                 alpha = triple.value()->getPad()->clone();
                 beta = triple.value()->getBlindingFactor()->clone();
@@ -10,17 +10,23 @@
 #include "facades/bignum4096.hpp"
 #include "log.hpp"
 #include "serialize.hpp"
+#include "trace_span.hpp"
 #include "utils.hpp"
 
+#include <algorithm>
+#include <deque>
 #include <future>
 #include <iostream>
 #include <nlohmann/json.hpp>
 #include <optional>
 
+using std::deque;
+using std::future;
 using std::invalid_argument;
 using std::make_unique;
 using std::move;
 using std::optional;
+using std::reference_wrapper;
 using std::runtime_error;
 using std::to_string;
 using std::unique_ptr;
@@ -55,8 +61,8 @@ namespace electionguard
         : pimpl(new Impl(deviceUuid, sessionUuid, launchCode, location))
     {
 
-        Log::trace("EncryptionDevice: Created: UUID: " + to_string(deviceUuid) +
-                   " at: " + location);
+        EG_LOG_TRACE("EncryptionDevice: Created: UUID: " + to_string(deviceUuid) +
+                     " at: " + location);
     }
     EncryptionDevice::~EncryptionDevice() = default;
 
@@ -96,6 +102,44 @@ namespace electionguard
 
 #pragma endregion
 
+#pragma region Ballot Encryption Stages
+
+    /// <summary>
+    /// The part of a ballot encryption that does not depend on the ballot chain
+    /// </summary>
+    struct BallotContestsEncryption {
+        unique_ptr<ElementModQ> nonce;
+        vector<unique_ptr<CiphertextBallotContest>> contests;
+    };
+
+    /// <summary>
+    /// Encrypt the contests of a ballot, generating the ballot nonce if one is not provided
+    /// </summary>
+    BallotContestsEncryption encryptBallotContests(const PlaintextBallot &ballot,
+                                                   const InternalManifest &manifest,
+                                                   const CiphertextElectionContext &context,
+                                                   unique_ptr<ElementModQ> nonce,
+                                                   bool verifyProofs, bool usePrecompute,
+                                                   bool allowOvervotes = true);
+
+    /// <summary>
+    /// Make the ballot from its encrypted contests, linking it to the ballot chain
+    /// </summary>
+    unique_ptr<CiphertextBallot> chainBallot(const PlaintextBallot &ballot,
+                                             const InternalManifest &manifest,
+                                             const CiphertextElectionContext &context,
+                                             const ElementModQ &ballotCodeSeed,
+                                             BallotContestsEncryption contests, uint64_t timestamp);
+
+    /// <summary>
+    /// Verify the proofs of an encrypted ballot, throwing if any are invalid
+    /// </summary>
+    unique_ptr<CiphertextBallot> verifyBallot(unique_ptr<CiphertextBallot> encryptedBallot,
+                                              const InternalManifest &manifest,
+                                              const CiphertextElectionContext &context);
+
+#pragma endregion
+
 #pragma region EncryptionMediator
 
     struct EncryptionMediator::Impl {
@@ -111,6 +155,20 @@ namespace electionguard
 
         {
         }
+
+        // this implementation chains each ballot encrypted by the mediator
+        // to every subsequent ballot creating a linked list data structure
+        // that can be used to prove there are no gaps in the election record
+        // but this is not required as part of the specification
+        const ElementModQ &getBallotCodeSeed()
+        {
+            if (!ballotCodeSeed) {
+                auto deviceHash = encryptionDevice.getHash();
+                ballotCodeSeed.swap(deviceHash);
+                EG_LOG_TRACE("encrypt: instantiated ballotCodeSeed:", ballotCodeSeed->toHex());
+            }
+            return *ballotCodeSeed;
+        }
     };
 
     EncryptionMediator::EncryptionMediator(const InternalManifest &internalManifest,
@@ -137,23 +195,13 @@ namespace electionguard
     EncryptionMediator::encrypt(const PlaintextBallot &ballot, bool verifyProofs /* = true */,
                                 bool usePrecomputedValues /* = false */) const
     {
-        Log::trace("encrypt: objectId: " + ballot.getObjectId());
-
-        // this implementation chains each ballot encrypted by the mediator
-        // to every subsequent ballot creating a linked list data structure
-        // that can be used to prove there are no gaps in the election record
-        // but this is not required as part of the specification
-        if (!pimpl->ballotCodeSeed) {
-            auto deviceHash = pimpl->encryptionDevice.getHash();
-            pimpl->ballotCodeSeed.swap(deviceHash);
-            Log::trace("encrypt: instantiated ballotCodeSeed:", pimpl->ballotCodeSeed->toHex());
-        }
+        EG_LOG_TRACE("encrypt: objectId: " + ballot.getObjectId());
 
         auto encryptedBallot = encryptBallot(
-          ballot, pimpl->internalManifest, pimpl->context, *pimpl->ballotCodeSeed, nullptr,
+          ballot, pimpl->internalManifest, pimpl->context, pimpl->getBallotCodeSeed(), nullptr,
           pimpl->encryptionDevice.getTimestamp(), verifyProofs, usePrecomputedValues);
 
-        Log::trace("encrypt: ballot encrypted");
+        EG_LOG_TRACE("encrypt: ballot encrypted");
         pimpl->ballotCodeSeed = make_unique<ElementModQ>(*encryptedBallot->getBallotCode());
         return encryptedBallot;
     }
@@ -162,27 +210,104 @@ namespace electionguard
     EncryptionMediator::compactEncrypt(const PlaintextBallot &ballot,
                                        bool verifyProofs /* = true */) const
     {
-        Log::trace("encrypt: objectId:" + ballot.getObjectId());
-
-        // this implementation chains each ballot encrypted by the mediator
-        // to every subsequent ballot creating a linked list data structure
-        // that can be used to prove there are no gaps in the election record
-        // but this is not required as part of the specification.
-        if (!pimpl->ballotCodeSeed) {
-            auto deviceHash = pimpl->encryptionDevice.getHash();
-            pimpl->ballotCodeSeed.swap(deviceHash);
-            Log::trace("encrypt: instantiated ballotCodeSeed:", pimpl->ballotCodeSeed->toHex());
-        }
+        EG_LOG_TRACE("encrypt: objectId:" + ballot.getObjectId());
 
         auto encryptedBallot = encryptCompactBallot(
-          ballot, pimpl->internalManifest, pimpl->context, *pimpl->ballotCodeSeed, nullptr,
+          ballot, pimpl->internalManifest, pimpl->context, pimpl->getBallotCodeSeed(), nullptr,
           pimpl->encryptionDevice.getTimestamp(), verifyProofs);
 
-        Log::trace("encrypt: ballot encrypted");
+        EG_LOG_TRACE("encrypt: ballot encrypted");
         pimpl->ballotCodeSeed = make_unique<ElementModQ>(*encryptedBallot->getBallotCode());
         return encryptedBallot;
     }
 
+    vector<unique_ptr<CiphertextBallot>> EncryptionMediator::encryptBatch(
+      const vector<reference_wrapper<const PlaintextBallot>> &ballots,
+      bool verifyProofs /* = true */, bool usePrecomputedValues /* = false */,
+      uint32_t concurrency /* = 0 */) const
+    {
+        EG_LOG_TRACE("encryptBatch: ballots: " + to_string(ballots.size()));
+
+        if (concurrency == 0) {
+            concurrency = std::max(1U, std::thread::hardware_concurrency());
+        }
+
+        const auto &manifest = pimpl->internalManifest;
+        const auto &context = pimpl->context;
+
+        // the contests of a ballot do not depend on the ballot chain,
+        // so keep a window of ballots encrypting ahead of the chain
+        auto encryptAt = [&](size_t index) {
+            return std::async(std::launch::async, [&, index] {
+                return encryptBallotContests(ballots.at(index).get(), manifest, context, nullptr,
+                                             verifyProofs, usePrecomputedValues);
+            });
+        };
+        auto verify = [&](unique_ptr<CiphertextBallot> encrypted) {
+            return std::async(std::launch::async,
+                              [&, encrypted = move(encrypted)]() mutable {
+                                  return verifyBallot(move(encrypted), manifest, context);
+                              });
+        };
+
+        size_t next = 0;
+        deque<future<BallotContestsEncryption>> encrypting;
+        deque<future<unique_ptr<CiphertextBallot>>> verifying;
+        vector<unique_ptr<CiphertextBallot>> results;
+        results.reserve(ballots.size());
+        while (next < ballots.size() && encrypting.size() < concurrency) {
+            encrypting.push_back(encryptAt(next++));
+        }
+
+        // the mediator only moves to the end of the chain once every ballot is returned,
+        // so a failure partway through leaves it where serial encryption would resume
+        auto ballotCodeSeed = make_unique<ElementModQ>(pimpl->getBallotCodeSeed());
+
+        // apply the chain in submission order as each ballot's contests complete
+        for (const auto &ballot : ballots) {
+            auto contests = encrypting.front().get();
+            encrypting.pop_front();
+            if (next < ballots.size()) {
+                encrypting.push_back(encryptAt(next++));
+            }
+
+            auto encrypted =
+              chainBallot(ballot.get(), manifest, context, *ballotCodeSeed, move(contests),
+                          pimpl->encryptionDevice.getTimestamp());
+            ballotCodeSeed = make_unique<ElementModQ>(*encrypted->getBallotCode());
+
+            if (!verifyProofs) {
+                results.push_back(move(encrypted));
+                continue;
+            }
+
+            verifying.push_back(verify(move(encrypted)));
+            if (verifying.size() >= concurrency) {
+                results.push_back(verifying.front().get());
+                verifying.pop_front();
+            }
+        }
+
+        while (!verifying.empty()) {
+            results.push_back(verifying.front().get());
+            verifying.pop_front();
+        }
+
+        pimpl->ballotCodeSeed.swap(ballotCodeSeed);
+        EG_LOG_TRACE("encryptBatch: ballots encrypted");
+        return results;
+    }
+
+    unique_ptr<ElementModQ> EncryptionMediator::getBallotCodeSeed() const
+    {
+        return make_unique<ElementModQ>(pimpl->getBallotCodeSeed());
+    }
+
+    void EncryptionMediator::setBallotCodeSeed(const ElementModQ &ballotCodeSeed)
+    {
+        pimpl->ballotCodeSeed = make_unique<ElementModQ>(ballotCodeSeed);
+    }
+
 #pragma endregion
 
 #pragma region Encryption Helpers
@@ -372,8 +497,8 @@ namespace electionguard
                      std::unique_ptr<PrecomputedSelection> precomputedValues, bool isPlaceholder)
     {
         // Configure the crypto input values
-        Log::trace("encryptSelection: precompute for " + objectId + " hash: ",
-                   descriptionHash.toHex());
+        EG_LOG_TRACE("encryptSelection: precompute for " + objectId + " hash: ",
+                     descriptionHash.toHex());
 
         // Generate the encryption using precomputed values
         auto partialEncryption = *precomputedValues->getPartialEncryption();
@@ -395,6 +520,30 @@ namespace electionguard
         return encrypted;
     }
 
+    /// <summary>
+    /// Completes a selection in realtime from a ciphertext that was already encrypted
+    /// with the selection nonce, such as one from a batch encryption of the contest.
+    /// </summary>
+    static unique_ptr<CiphertextBallotSelection>
+    encryptSelection(const std::string objectId, uint64_t sequenceOrder, uint64_t vote,
+                     const ElementModQ &descriptionHash, const CiphertextElectionContext &context,
+                     unique_ptr<ElGamalCiphertext> ciphertext,
+                     unique_ptr<ElementModQ> selectionNonce, bool isPlaceholder)
+    {
+        if (ciphertext == nullptr) {
+            throw runtime_error("encryptSelection:: Error generating ciphertext");
+        }
+
+        auto encrypted = CiphertextBallotSelection::make(objectId, sequenceOrder, descriptionHash,
+                                                         move(ciphertext), context, vote,
+                                                         isPlaceholder, true, move(selectionNonce));
+
+        if (encrypted == nullptr || encrypted->getProof() == nullptr) {
+            throw runtime_error("encryptSelection:: Error constructing encrypted selection");
+        }
+        return encrypted;
+    }
+
     /// <summary>
     /// Encrypts a specific selection in a contest in realtime.
     ///
@@ -416,31 +565,28 @@ namespace electionguard
                      const ElementModQ &descriptionHash, const CiphertextElectionContext &context,
                      unique_ptr<ElementModQ> selectionNonce, bool isPlaceholder)
     {
-        Log::trace("encryptSelection: for " + objectId + " hash: ", descriptionHash.toHex());
+        EG_LOG_TRACE("encryptSelection: for " + objectId + " hash: ", descriptionHash.toHex());
 
         // standard encryption in real-time
         auto ciphertext = elgamalEncrypt(vote, *selectionNonce, *context.getElGamalPublicKey());
-        if (ciphertext == nullptr) {
-            throw runtime_error("encryptSelection:: Error generating ciphertext");
-        }
-
-        auto encrypted = CiphertextBallotSelection::make(objectId, sequenceOrder, descriptionHash,
-                                                         move(ciphertext), context, vote,
-                                                         isPlaceholder, true, move(selectionNonce));
-
-        if (encrypted == nullptr || encrypted->getProof() == nullptr) {
-            throw runtime_error("encryptSelection:: Error constructing encrypted selection");
-        }
-        return encrypted;
+        return encryptSelection(objectId, sequenceOrder, vote, descriptionHash, context,
+                                move(ciphertext), move(selectionNonce), isPlaceholder);
     }
 
-    unique_ptr<CiphertextBallotSelection>
+    /// <summary>
+    /// Encrypt a selection using the selection nonce when it is provided,
+    /// otherwise derive the selection nonce from the nonce seed if it is needed
+    /// </summary>
+    static unique_ptr<CiphertextBallotSelection>
     encryptSelection(const PlaintextBallotSelection &selection,
                      const SelectionDescription &description,
                      const CiphertextElectionContext &context, const ElementModQ &nonceSeed,
-                     bool isPlaceholder /* = false */, bool verifyProofs /* = true */,
-                     bool usePrecompute /* = true */)
+                     unique_ptr<ElementModQ> selectionNonce, bool isPlaceholder,
+                     bool verifyProofs, PrecomputeBuffer *precomputeBuffer,
+                     unique_ptr<ElGamalCiphertext> ciphertext = nullptr)
     {
+        EG_TRACE_SPAN("encryptSelection");
+
         // Validate Input
         if (!selection.isValid(description.getObjectId())) {
             // todo: include plaintext data in log output
@@ -453,16 +599,11 @@ namespace electionguard
         // Configure the crypto input values
         auto descriptionHash = description.crypto_hash();
 
-        auto precomputePublicKey = PrecomputeBufferContext::getPublicKey();
-
-        // check if we should use precomputed values
-        // TODO: issue #216 ensure that the PrecomputeBufferContext is the correct context
-        // associated with the elgamalPublicKey of this election and we can remove this
-        // equality check.
-        if (usePrecompute && precomputePublicKey != nullptr &&
-            *precomputePublicKey == *context.getElGamalPublicKey()) {
-            Log::trace("encryptSelection: using precomputed values");
-            auto precomputedValues = PrecomputeBufferContext::popPrecomputedSelection();
+        // the caller resolves the buffer for the election public key,
+        // so there is no need to compare the keys for every selection
+        if (precomputeBuffer != nullptr) {
+            EG_LOG_TRACE("encryptSelection: using precomputed values");
+            auto precomputedValues = precomputeBuffer->popPrecomputedSelection();
             if (precomputedValues != nullptr && precomputedValues.has_value()) {
                 encrypted = encryptSelection(selection.getObjectId(), sequenceOrder,
                                              selection.getVote(), *descriptionHash, context,
@@ -472,12 +613,21 @@ namespace electionguard
 
         // if we didn't use precomputed values then we need to generate values in realtime
         if (encrypted == nullptr) {
-            Log::trace("encryptSelection: generating values in realtime");
-            auto selectionNonce = hash_elems({nonceSeed, description.getSequenceOrder()});
+            EG_LOG_TRACE("encryptSelection: generating values in realtime");
+            if (selectionNonce == nullptr) {
+                selectionNonce = hash_elems({nonceSeed, description.getSequenceOrder()});
+            }
 
-            encrypted =
-              encryptSelection(selection.getObjectId(), sequenceOrder, selection.getVote(),
-                               *descriptionHash, context, move(selectionNonce), isPlaceholder);
+            if (ciphertext != nullptr) {
+                encrypted = encryptSelection(selection.getObjectId(), sequenceOrder,
+                                             selection.getVote(), *descriptionHash, context,
+                                             move(ciphertext), move(selectionNonce),
+                                             isPlaceholder);
+            } else {
+                encrypted =
+                  encryptSelection(selection.getObjectId(), sequenceOrder, selection.getVote(),
+                                   *descriptionHash, context, move(selectionNonce), isPlaceholder);
+            }
         }
 
         // optionally, skip the verification step
@@ -486,6 +636,7 @@ namespace electionguard
         }
 
         // verify the selection.
+        EG_TRACE_SPAN("encryptSelection::verify");
         if (encrypted->isValidEncryption(*descriptionHash, *context.getElGamalPublicKey(),
                                          *context.getCryptoExtendedBaseHash())) {
             return encrypted;
@@ -493,6 +644,20 @@ namespace electionguard
         throw runtime_error("encryptSelection failed validity check");
     }
 
+    unique_ptr<CiphertextBallotSelection>
+    encryptSelection(const PlaintextBallotSelection &selection,
+                     const SelectionDescription &description,
+                     const CiphertextElectionContext &context, const ElementModQ &nonceSeed,
+                     bool isPlaceholder /* = false */, bool verifyProofs /* = true */,
+                     bool usePrecompute /* = true */)
+    {
+        auto precomputeBuffer =
+          usePrecompute ? PrecomputeBufferContext::getBuffer(*context.getElGamalPublicKey())
+                        : nullptr;
+        return encryptSelection(selection, description, context, nonceSeed, nullptr,
+                                isPlaceholder, verifyProofs, precomputeBuffer.get());
+    }
+
     unique_ptr<CiphertextBallotContest>
     encryptContest(const PlaintextBallotContest &contest, const InternalManifest &internalManifest,
                    const ContestDescriptionWithPlaceholders &description,
@@ -501,6 +666,8 @@ namespace electionguard
                    bool allowOvervotes /* = true */)
 
     {
+        EG_TRACE_SPAN("encryptContest");
+
         // Validate Input
         auto validationResult = contest.isValid(
           description.getObjectId(), description.getSelections().size(),
@@ -520,61 +687,107 @@ namespace electionguard
 
         // normalize contest selections
         unique_ptr<PlaintextBallotContest> normalizedContest;
-        if (validationResult == OVERVOTE) {
-            // if the is an overvote then we need to make all the selection votes 0
-            normalizedContest = emplaceAllZeroes(description);
-        } else {
-            // iterate over the actual selections for each contest description
-            // and apply the selected value if it exists.  If it does not, an explicit
-            // false is entered instead and the selection_count is not incremented
-            // this allows consumers to only pass in the relevant selections made by a voter
-            normalizedContest = emplaceMissingValues(contest, description);
+        {
+            EG_TRACE_SPAN("encryptContest::normalize");
+            if (validationResult == OVERVOTE) {
+                // if the is an overvote then we need to make all the selection votes 0
+                normalizedContest = emplaceAllZeroes(description);
+            } else {
+                // iterate over the actual selections for each contest description
+                // and apply the selected value if it exists.  If it does not, an explicit
+                // false is entered instead and the selection_count is not incremented
+                // this allows consumers to only pass in the relevant selections made by a voter
+                normalizedContest = emplaceMissingValues(contest, description);
+            }
         }
 
-        // encrypt selections
-        uint64_t selectionCount = 0;
-        vector<unique_ptr<CiphertextBallotSelection>> encryptedSelections;
+        // the selection nonces and the extended data nonce are independent hashes
+        // of the contest nonce, so derive them together in one batch
+        auto selectionDescriptions = description.getSelections();
+        vector<vector<CryptoHashableType>> nonceInputs;
+        nonceInputs.reserve(selectionDescriptions.size() + 1);
+        for (const auto &selectionDescription : selectionDescriptions) {
+            nonceInputs.push_back(
+              {sharedNonce.get(), selectionDescription.get().getSequenceOrder()});
+        }
+        nonceInputs.push_back({sharedNonce.get(), "contest-data"});
+        auto nonces = hash_elems_batch(nonceInputs);
+
+        // look up the precompute buffer of the election once for every selection
+        auto precomputeBuffer =
+          usePrecompute ? PrecomputeBufferContext::getBuffer(*context.getElGamalPublicKey())
+                        : nullptr;
+
+        // match each selection description with its normalized selection
         auto normalizedSelections = normalizedContest->getSelections();
-        for (const auto &selectionDescription : description.getSelections()) {
+        vector<const PlaintextBallotSelection *> matchedSelections;
+        matchedSelections.reserve(selectionDescriptions.size());
+        for (const auto &selectionDescription : selectionDescriptions) {
             auto description_id = selectionDescription.get().getObjectId();
-            if (auto selection =
-                  std::find_if(normalizedSelections.begin(), normalizedSelections.end(),
-                               [description_id](const PlaintextBallotSelection &item) {
-                                   return item.getObjectId() == description_id;
-                               });
-                selection != normalizedSelections.end()) {
-
-                // always false for E.G. 2.0 encryptions
-                auto isPlaceholder = false;
-
-                // track the selection count for the range proof
-                auto selection_ptr = &selection->get();
-                selectionCount += selection_ptr->getVote();
-
-                // explicitly do not verify proofs when creating the encrypted selections
-                // since we may verify the proofs on the entire contest
-                encryptedSelections.push_back(
-                  encryptSelection(*selection_ptr, selectionDescription.get(), context,
-                                   *sharedNonce.get(), isPlaceholder, verifyProofs, usePrecompute));
-            } else {
+            auto selection = std::find_if(normalizedSelections.begin(), normalizedSelections.end(),
+                                          [description_id](const PlaintextBallotSelection &item) {
+                                              return item.getObjectId() == description_id;
+                                          });
+            if (selection == normalizedSelections.end()) {
                 // Should never happen since the contest is normalized by emplaceMissingValues
                 throw runtime_error("Error constructing encrypted selection. Missing selection.");
             }
+            matchedSelections.push_back(&selection->get());
+        }
+
+        // without precomputed values, encrypt every selection of the contest in one batch
+        // so the fixed base table walks of the selections are interleaved
+        unique_ptr<ElGamalCiphertextBatch> ciphertexts;
+        if (precomputeBuffer == nullptr) {
+            EG_TRACE_SPAN("encryptContest::encryptBatch");
+            vector<uint64_t> votes;
+            vector<reference_wrapper<const ElementModQ>> selectionNonces;
+            votes.reserve(matchedSelections.size());
+            selectionNonces.reserve(matchedSelections.size());
+            for (size_t i = 0; i < matchedSelections.size(); i++) {
+                votes.push_back(matchedSelections[i]->getVote());
+                selectionNonces.push_back(*nonces[i]);
+            }
+            ciphertexts = make_unique<ElGamalCiphertextBatch>(
+              elgamalEncryptBatch(votes, selectionNonces, *context.getElGamalPublicKey()));
+        }
+
+        // encrypt selections
+        uint64_t selectionCount = 0;
+        vector<unique_ptr<CiphertextBallotSelection>> encryptedSelections;
+        for (size_t i = 0; i < selectionDescriptions.size(); i++) {
+            // always false for E.G. 2.0 encryptions
+            auto isPlaceholder = false;
+
+            // track the selection count for the range proof
+            auto selection_ptr = matchedSelections[i];
+            selectionCount += selection_ptr->getVote();
+
+            // explicitly do not verify proofs when creating the encrypted selections
+            // since we may verify the proofs on the entire contest
+            encryptedSelections.push_back(encryptSelection(
+              *selection_ptr, selectionDescriptions[i].get(), context, *sharedNonce.get(),
+              move(nonces[i]), isPlaceholder, verifyProofs, precomputeBuffer.get(),
+              ciphertexts != nullptr ? ciphertexts->getCiphertext(i) : nullptr));
         }
 
         // Encrypt ExtendedData
-        auto extendedData = encodeExtendedData(contest, internalManifest, validationResult);
+        unique_ptr<HashedElGamalCiphertext> hashedElGamal;
+        {
+            EG_TRACE_SPAN("encryptContest::extendedData");
+            auto extendedData = encodeExtendedData(contest, internalManifest, validationResult);
 
-        // Derive the extendedDataNonce from the contest nonce and a constant
-        auto extendedDataNonce = hash_elems({sharedNonce->clone().get(), "contest-data"});
+            // The extendedDataNonce is derived from the contest nonce and a constant
+            auto extendedDataNonce = move(nonces.back());
 
-        vector<uint8_t> extendedData_plaintext(extendedData.begin(), extendedData.end());
+            vector<uint8_t> extendedData_plaintext(extendedData.begin(), extendedData.end());
 
-        // Perform HashedElGamalCiphertext calculation
-        unique_ptr<HashedElGamalCiphertext> hashedElGamal = hashedElgamalEncrypt(
-          extendedData_plaintext, *extendedDataNonce, HashPrefix::get_prefix_contest_data_secret(),
-          *context.getElGamalPublicKey(), *context.getCryptoExtendedBaseHash(), BYTES_512, true,
-          usePrecompute);
+            // Perform HashedElGamalCiphertext calculation
+            hashedElGamal = hashedElgamalEncrypt(
+              extendedData_plaintext, *extendedDataNonce,
+              HashPrefix::get_prefix_contest_data_secret(), *context.getElGamalPublicKey(),
+              *context.getCryptoExtendedBaseHash(), BYTES_512, true, usePrecompute);
+        }
 
         // Create the CiphertextBallotContest return object
         auto encryptedContest = CiphertextBallotContest::make(
@@ -593,6 +806,7 @@ namespace electionguard
         }
 
         // verify the contest.
+        EG_TRACE_SPAN("encryptContest::verify");
         if (encryptedContest->isValidEncryption(*descriptionHash, *context.getElGamalPublicKey(),
                                                 *context.getCryptoExtendedBaseHash())) {
             return encryptedContest;
@@ -609,7 +823,11 @@ namespace electionguard
     {
         auto *style = internalManifest.getBallotStyle(ballot.getStyleId());
         vector<unique_ptr<CiphertextBallotContest>> encryptedContests;
-        auto normalizedBallot = emplaceMissingValues(ballot, internalManifest);
+        unique_ptr<PlaintextBallot> normalizedBallot;
+        {
+            EG_TRACE_SPAN("encryptContests::normalize");
+            normalizedBallot = emplaceMissingValues(ballot, internalManifest);
+        }
 
         // TODO: Issue #217: implement async multithreading
 
@@ -636,14 +854,15 @@ namespace electionguard
         return encryptedContests;
     }
 
-    unique_ptr<CiphertextBallot>
-    encryptBallot(const PlaintextBallot &ballot, const InternalManifest &manifest,
-                  const CiphertextElectionContext &context, const ElementModQ &ballotCodeSeed,
-                  unique_ptr<ElementModQ> nonce /* = nullptr */, uint64_t timestamp /* = 0 */,
-                  bool verifyProofs /* = true */, bool usePrecompute /* = false */,
-                  bool allowOvervotes /* = true */)
+    BallotContestsEncryption encryptBallotContests(const PlaintextBallot &ballot,
+                                                   const InternalManifest &manifest,
+                                                   const CiphertextElectionContext &context,
+                                                   unique_ptr<ElementModQ> nonce,
+                                                   bool verifyProofs, bool usePrecompute,
+                                                   bool allowOvervotes /* = true */)
     {
-        Log::trace("encryptBallot:: encrypting");
+        EG_TRACE_SPAN("encryptBallotContests");
+        EG_LOG_TRACE("encryptBallot:: encrypting");
         auto *style = manifest.getBallotStyle(ballot.getStyleId());
 
         // Validate Input
@@ -668,13 +887,23 @@ namespace electionguard
         auto nonceSeed =
           CiphertextBallot::nonceSeed(*manifest.getManifestHash(), ballot.getObjectId(), *nonce);
 
-        Log::trace("manifestHash   :", manifest.getManifestHash()->toHex());
-        Log::trace("encryptionSeed :", ballotCodeSeed.toHex());
-        Log::trace("timestamp       :", to_string(timestamp));
+        EG_LOG_TRACE("manifestHash   :", manifest.getManifestHash()->toHex());
 
         // encrypt contests
         auto encryptedContests = encryptContests(ballot, manifest, context, *nonceSeed,
                                                  verifyProofs, usePrecompute, allowOvervotes);
+        return {move(nonce), move(encryptedContests)};
+    }
+
+    unique_ptr<CiphertextBallot> chainBallot(const PlaintextBallot &ballot,
+                                             const InternalManifest &manifest,
+                                             const CiphertextElectionContext &context,
+                                             const ElementModQ &ballotCodeSeed,
+                                             BallotContestsEncryption contests, uint64_t timestamp)
+    {
+        EG_TRACE_SPAN("chainBallot");
+        EG_LOG_TRACE("encryptionSeed :", ballotCodeSeed.toHex());
+        EG_LOG_TRACE("timestamp       :", to_string(timestamp));
 
         // Get the system time
         if (timestamp == 0) {
@@ -684,30 +913,53 @@ namespace electionguard
         // make the Ciphertext Ballot object
         auto encryptedBallot = CiphertextBallot::make(
           ballot.getObjectId(), ballot.getStyleId(), *manifest.getManifestHash(), context,
-          move(encryptedContests), move(nonce), timestamp, make_unique<ElementModQ>(ballotCodeSeed),
-          nullptr);
+          move(contests.contests), move(contests.nonce), timestamp,
+          make_unique<ElementModQ>(ballotCodeSeed), nullptr);
 
-        //Log::info("ballot      :", encryptedBallot->toJson(true));
+        //EG_LOG_INFO("ballot      :", encryptedBallot->toJson(true));
         if (!encryptedBallot) {
             throw runtime_error("encryptedBallot:: Error constructing encrypted ballot");
         }
+        return encryptedBallot;
+    }
 
-        if (!verifyProofs) {
-            Log::trace("encryptBallot:: bypass proof verification");
-            return encryptedBallot;
-        }
-
-        // verify the ballot.
+    unique_ptr<CiphertextBallot> verifyBallot(unique_ptr<CiphertextBallot> encryptedBallot,
+                                              const InternalManifest &manifest,
+                                              const CiphertextElectionContext &context)
+    {
+        EG_TRACE_SPAN("verifyBallot");
         if (encryptedBallot->isValidEncryption(*manifest.getManifestHash(),
                                                *context.getElGamalPublicKey(),
                                                *context.getCryptoExtendedBaseHash())) {
-            Log::trace("encryptBallot:: proof verification success");
+            EG_LOG_TRACE("encryptBallot:: proof verification success");
             return encryptedBallot;
         }
 
         throw runtime_error("encryptBallot: failed validity check");
     }
 
+    unique_ptr<CiphertextBallot>
+    encryptBallot(const PlaintextBallot &ballot, const InternalManifest &manifest,
+                  const CiphertextElectionContext &context, const ElementModQ &ballotCodeSeed,
+                  unique_ptr<ElementModQ> nonce /* = nullptr */, uint64_t timestamp /* = 0 */,
+                  bool verifyProofs /* = true */, bool usePrecompute /* = false */,
+                  bool allowOvervotes /* = true */)
+    {
+        EG_TRACE_SPAN("encryptBallot");
+        auto contests = encryptBallotContests(ballot, manifest, context, move(nonce),
+                                              verifyProofs, usePrecompute, allowOvervotes);
+        auto encryptedBallot =
+          chainBallot(ballot, manifest, context, ballotCodeSeed, move(contests), timestamp);
+
+        if (!verifyProofs) {
+            EG_LOG_TRACE("encryptBallot:: bypass proof verification");
+            return encryptedBallot;
+        }
+
+        // verify the ballot.
+        return verifyBallot(move(encryptedBallot), manifest, context);
+    }
+
     unique_ptr<CompactCiphertextBallot>
     encryptCompactBallot(const PlaintextBallot &ballot, const InternalManifest &manifest,
                          const CiphertextElectionContext &context,
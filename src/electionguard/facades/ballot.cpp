@@ -1271,6 +1271,57 @@ eg_ciphertext_ballot_to_msgpack_with_nonces(eg_ciphertext_ballot_t *handle, uint
     }
 }
 
+eg_electionguard_status_t eg_ciphertext_ballot_from_binary(uint8_t *in_data, uint64_t in_length,
+                                                           eg_ciphertext_ballot_t **out_handle)
+{
+    try {
+        auto result = CiphertextBallot::fromBinary(in_data, in_length);
+
+        *out_handle = AS_TYPE(eg_ciphertext_ballot_t, result.release());
+        return ELECTIONGUARD_STATUS_SUCCESS;
+    } catch (const exception &e) {
+        Log::error(":eg_ciphertext_ballot_from_binary", e);
+        return ELECTIONGUARD_STATUS_ERROR_BAD_ALLOC;
+    }
+}
+
+eg_electionguard_status_t eg_ciphertext_ballot_to_binary(eg_ciphertext_ballot_t *handle,
+                                                         uint8_t **out_data, uint64_t *out_size)
+{
+    try {
+        auto *domain_type = AS_TYPE(CiphertextBallot, handle);
+        auto result = domain_type->toBinary(false);
+
+        size_t size = 0;
+        *out_data = dynamicCopy(result, &size);
+        *out_size = (uint64_t)size;
+
+        return ELECTIONGUARD_STATUS_SUCCESS;
+    } catch (const exception &e) {
+        Log::error(":eg_ciphertext_ballot_to_binary", e);
+        return ELECTIONGUARD_STATUS_ERROR_BAD_ALLOC;
+    }
+}
+
+eg_electionguard_status_t eg_ciphertext_ballot_to_binary_with_nonces(eg_ciphertext_ballot_t *handle,
+                                                                     uint8_t **out_data,
+                                                                     uint64_t *out_size)
+{
+    try {
+        auto *domain_type = AS_TYPE(CiphertextBallot, handle);
+        auto result = domain_type->toBinary(true);
+
+        size_t size = 0;
+        *out_data = dynamicCopy(result, &size);
+        *out_size = (uint64_t)size;
+
+        return ELECTIONGUARD_STATUS_SUCCESS;
+    } catch (const exception &e) {
+        Log::error(":eg_ciphertext_ballot_to_binary_with_nonces", e);
+        return ELECTIONGUARD_STATUS_ERROR_BAD_ALLOC;
+    }
+}
+
 #pragma endregion
 
 #pragma region SubmittedBallot
@@ -1411,4 +1462,36 @@ eg_electionguard_status_t eg_submitted_ballot_to_msgpack(eg_submitted_ballot_t *
     }
 }
 
+eg_electionguard_status_t eg_submitted_ballot_from_binary(uint8_t *in_data, uint64_t in_length,
+                                                          eg_submitted_ballot_t **out_handle)
+{
+    try {
+        auto result = SubmittedBallot::fromBinary(in_data, in_length);
+
+        *out_handle = AS_TYPE(eg_submitted_ballot_t, result.release());
+        return ELECTIONGUARD_STATUS_SUCCESS;
+    } catch (const exception &e) {
+        Log::error(":eg_submitted_ballot_from_binary", e);
+        return ELECTIONGUARD_STATUS_ERROR_BAD_ALLOC;
+    }
+}
+
+eg_electionguard_status_t eg_submitted_ballot_to_binary(eg_submitted_ballot_t *handle,
+                                                        uint8_t **out_data, uint64_t *out_size)
+{
+    try {
+        auto *domain_type = AS_TYPE(SubmittedBallot, handle);
+        auto result = domain_type->toBinary();
+
+        size_t size = 0;
+        *out_data = dynamicCopy(result, &size);
+        *out_size = (uint64_t)size;
+
+        return ELECTIONGUARD_STATUS_SUCCESS;
+    } catch (const exception &e) {
+        Log::error(":eg_submitted_ballot_to_binary", e);
+        return ELECTIONGUARD_STATUS_ERROR_BAD_ALLOC;
+    }
+}
+
 #pragma endregion
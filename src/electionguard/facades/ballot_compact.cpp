@@ -133,6 +133,40 @@ eg_compact_ciphertext_ballot_to_msgpack(eg_compact_ciphertext_ballot_t *handle,
     }
 }
 
+eg_electionguard_status_t
+eg_compact_ciphertext_ballot_from_binary(uint8_t *in_data, uint64_t in_length,
+                                         eg_compact_ciphertext_ballot_t **out_handle)
+{
+    try {
+        auto result = CompactCiphertextBallot::fromBinary(in_data, in_length);
+
+        *out_handle = AS_TYPE(eg_compact_ciphertext_ballot_t, result.release());
+        return ELECTIONGUARD_STATUS_SUCCESS;
+    } catch (const exception &e) {
+        Log::error(":eg_compact_ciphertext_ballot_from_binary", e);
+        return ELECTIONGUARD_STATUS_ERROR_BAD_ALLOC;
+    }
+}
+
+eg_electionguard_status_t
+eg_compact_ciphertext_ballot_to_binary(eg_compact_ciphertext_ballot_t *handle, uint8_t **out_data,
+                                       uint64_t *out_size)
+{
+    try {
+        auto *domain_type = AS_TYPE(CompactCiphertextBallot, handle);
+        auto result = domain_type->toBinary();
+
+        size_t size = 0;
+        *out_data = dynamicCopy(result, &size);
+        *out_size = (uint64_t)size;
+
+        return ELECTIONGUARD_STATUS_SUCCESS;
+    } catch (const exception &e) {
+        Log::error(":eg_compact_ciphertext_ballot_to_binary", e);
+        return ELECTIONGUARD_STATUS_ERROR_BAD_ALLOC;
+    }
+}
+
 #pragma endregion
 
 #pragma region Memory
@@ -8,6 +8,7 @@
 #include <electionguard/constants.h>
 #include <memory>
 #include <variant>
+#include <vector>
 
 using std::get;
 using std::make_unique;
@@ -22,12 +23,70 @@ namespace electionguard::facades
     bool Bignum4096::use32BitMath = false;
 #endif
 
+    Bignum4096Backend Bignum4096::backend = detectBignum4096Backend();
+
+    // window size of the vector backend exponentiation, 2^5 table entries of 512 bytes
+    constexpr uint32_t MOD_EXP_WINDOW_BITS = 5;
+    constexpr uint32_t MOD_EXP_TABLE_SIZE = 1U << MOD_EXP_WINDOW_BITS;
+
+    /// <summary>
+    /// Get the bits of the exponent window starting at the bit offset
+    /// </summary>
+    static uint32_t getWindow(const uint64_t *b, uint32_t bBits, uint32_t offset)
+    {
+        auto bLen = (bBits + 63) / 64;
+        auto word = offset / 64;
+        auto shift = offset % 64;
+        auto window = b[word] >> shift;
+        if (shift > 64 - MOD_EXP_WINDOW_BITS && word + 1 < bLen) {
+            window |= b[word + 1] << (64 - shift);
+        }
+        auto width = bBits - offset < MOD_EXP_WINDOW_BITS ? bBits - offset : MOD_EXP_WINDOW_BITS;
+        return static_cast<uint32_t>(window & ((1ULL << width) - 1));
+    }
+
+    /// <summary>
+    /// Variable time fixed window exponentiation using the montgomery multiplication of a
+    /// vector backend. The hacl context converts the base and result in and out of
+    /// montgomery form since both share the same representation.
+    /// </summary>
+    static void modExpWithKernel(const hacl::Bignum4096 &context, const Bignum4096Kernel &kernel,
+                                 uint64_t *a, uint32_t bBits, const uint64_t *b, uint64_t *res)
+    {
+        uint64_t table[MOD_EXP_TABLE_SIZE][MAX_P_LEN];
+        uint64_t one[MAX_P_LEN] = {1};
+        context.to_montgomery_form(static_cast<uint64_t *>(one), table[0]);
+        context.to_montgomery_form(a, table[1]);
+        for (uint32_t i = 2; i < MOD_EXP_TABLE_SIZE; i++) {
+            kernel.montgomeryMul(table[i - 1], table[1], table[i]);
+        }
+
+        uint64_t acc[MAX_P_LEN];
+        memcpy(acc, table[0], sizeof(acc));
+        auto windows = (bBits + MOD_EXP_WINDOW_BITS - 1) / MOD_EXP_WINDOW_BITS;
+        for (auto w = windows; w > 0; w--) {
+            auto offset = (w - 1) * MOD_EXP_WINDOW_BITS;
+            if (w != windows) {
+                for (uint32_t i = 0; i < MOD_EXP_WINDOW_BITS; i++) {
+                    kernel.montgomeryMul(acc, acc, acc);
+                }
+            }
+            auto window = getWindow(b, bBits, offset);
+            if (window != 0) {
+                kernel.montgomeryMul(acc, table[window], acc);
+            }
+        }
+
+        context.from_montgomery_form(static_cast<uint64_t *>(acc), res);
+    }
+
     using HaclBignumType =
       std::variant<unique_ptr<hacl::Bignum4096>, unique_ptr<hacl::Bignum4096_32>>;
 
     struct Bignum4096::Impl {
         HaclBignumType element;
         bool prefer32BitMath = false;
+        unique_ptr<Bignum4096Kernel> kernel;
 
         Impl(const uint32_t *elem)
         {
@@ -63,8 +122,20 @@ namespace electionguard::facades
                 memcpy(data, elem, hacl::Bignum4096::size * sizeof(uint64_t));
 
                 element = make_unique<hacl::Bignum4096>(move(data));
+                kernel = Bignum4096Kernel::make(Bignum4096Backend::avx512ifma, elem);
             }
         }
+
+        /// <summary>
+        /// Get the kernel for the selected backend, or nullptr to use hacl
+        /// </summary>
+        const Bignum4096Kernel *getKernel() const
+        {
+            if (kernel != nullptr && kernel->getBackend() == Bignum4096::backend) {
+                return kernel.get();
+            }
+            return nullptr;
+        }
     };
 
     Bignum4096::Bignum4096(const uint32_t *elem) : pimpl(new Impl(elem)) {}
@@ -236,8 +307,55 @@ namespace electionguard::facades
             return;
         }
 
-        std::get<unique_ptr<hacl::Bignum4096>>(pimpl->element)
-          ->modExp(a, bBits, b, res, useConstTime);
+        auto &context = std::get<unique_ptr<hacl::Bignum4096>>(pimpl->element);
+        const auto *kernel = pimpl->getKernel();
+        if (kernel != nullptr && !useConstTime && bBits > 0) {
+            modExpWithKernel(*context, *kernel, a, bBits, b, res);
+            return;
+        }
+        context->modExp(a, bBits, b, res, useConstTime);
+    }
+
+    void Bignum4096::modExpMulti(const uint64_t *const *a, const uint64_t *const *b,
+                                 size_t count, uint32_t bBits, uint64_t *res) const
+    {
+        // a table of the window powers of each base in montgomery form
+        std::vector<uint64_t> tables(count * MOD_EXP_TABLE_SIZE * MAX_P_LEN);
+        auto entry = [&](size_t term, uint32_t power) {
+            return tables.data() + (term * MOD_EXP_TABLE_SIZE + power) * MAX_P_LEN;
+        };
+
+        uint64_t one[MAX_P_LEN] = {1};
+        uint64_t acc[MAX_P_LEN];
+        to_montgomery_form(static_cast<uint64_t *>(one), static_cast<uint64_t *>(acc));
+        for (size_t term = 0; term < count; term++) {
+            memcpy(entry(term, 0), acc, sizeof(acc));
+            uint64_t base[MAX_P_LEN];
+            memcpy(base, a[term], sizeof(base));
+            to_montgomery_form(static_cast<uint64_t *>(base), entry(term, 1));
+            for (uint32_t i = 2; i < MOD_EXP_TABLE_SIZE; i++) {
+                montgomery_mod_mul_stay_in_mont_form(entry(term, i - 1), entry(term, 1),
+                                                     entry(term, i));
+            }
+        }
+
+        auto windows = (bBits + MOD_EXP_WINDOW_BITS - 1) / MOD_EXP_WINDOW_BITS;
+        for (auto w = windows; w > 0; w--) {
+            auto offset = (w - 1) * MOD_EXP_WINDOW_BITS;
+            if (w != windows) {
+                for (uint32_t i = 0; i < MOD_EXP_WINDOW_BITS; i++) {
+                    montgomery_mod_mul_stay_in_mont_form(acc, acc, acc);
+                }
+            }
+            for (size_t term = 0; term < count; term++) {
+                auto window = getWindow(b[term], bBits, offset);
+                if (window != 0) {
+                    montgomery_mod_mul_stay_in_mont_form(acc, entry(term, window), acc);
+                }
+            }
+        }
+
+        from_montgomery_form(static_cast<uint64_t *>(acc), res);
     }
 
     // ModInv
@@ -277,7 +395,7 @@ namespace electionguard::facades
           ->montgomery_mod_mul_stay_in_mont_form(aM, bM, cM);
     }
     void Bignum4096::montgomery_mod_mul_stay_in_mont_form(uint64_t *aM, uint64_t *bM,
-                                                          uint64_t *cM) const
+                                                          uint64_t *cM, bool useConstTime) const
     {
         if (pimpl->prefer32BitMath) {
             montgomery_mod_mul_stay_in_mont_form(reinterpret_cast<uint32_t *>(aM),
@@ -285,6 +403,11 @@ namespace electionguard::facades
                                                  reinterpret_cast<uint32_t *>(cM));
             return;
         }
+        const auto *kernel = pimpl->getKernel();
+        if (kernel != nullptr && !useConstTime) {
+            kernel->montgomeryMul(aM, bM, cM);
+            return;
+        }
         std::get<unique_ptr<hacl::Bignum4096>>(pimpl->element)
           ->montgomery_mod_mul_stay_in_mont_form(aM, bM, cM);
     }
@@ -1,6 +1,7 @@
 #ifndef __ELECTIONGUARD_FACADES_BIGNUM4096_HPP_INCLUDED__
 #define __ELECTIONGUARD_FACADES_BIGNUM4096_HPP_INCLUDED__
 
+#include "bignum4096_backend.hpp"
 #include "electionguard/export.h"
 
 #include <cstdint>
@@ -19,6 +20,9 @@ namespace electionguard::facades
     ///
     /// Instantiating this class creates a montgomery context
     /// that can be cached and reused to improve performance of mod and modexp functions.
+    ///
+    /// Instances using 64-bit math dispatch montgomery multiplication and variable time
+    /// exponentiation to a vector backend when the cpu supports one (see `backend`).
     /// </summary>
     class EG_INTERNAL_API Bignum4096
     {
@@ -35,6 +39,15 @@ namespace electionguard::facades
 
         static bool use32BitMath;
 
+        /// <summary>
+        /// The backend used by instances for montgomery multiplication
+        /// and variable time exponentiation.
+        ///
+        /// Detected at startup. Can be changed at runtime, for instance to compare backends;
+        /// selecting a backend the machine does not support falls back to the portable routines.
+        /// </summary>
+        static Bignum4096Backend backend;
+
         static uint32_t add(uint32_t *a, uint32_t *b, uint32_t *res);
         static uint64_t add(uint64_t *a, uint64_t *b, uint64_t *res);
 
@@ -72,6 +85,14 @@ namespace electionguard::facades
         void modExp(uint64_t *a, uint32_t bBits, uint64_t *b, uint64_t *res,
                     bool useConstTime = false) const;
 
+        /// <summary>
+        /// Calculate res = a[0]^b[0] * a[1]^b[1] * ... mod n for count variable time terms.
+        /// The terms share one chain of squarings, so each extra term costs a window
+        /// multiplication per window rather than a whole exponentiation.
+        /// </summary>
+        void modExpMulti(const uint64_t *const *a, const uint64_t *const *b, size_t count,
+                         uint32_t bBits, uint64_t *res) const;
+
         void modInvPrime(uint32_t *a, uint32_t *res) const;
         void modInvPrime(uint64_t *a, uint64_t *res) const;
 
@@ -82,7 +103,13 @@ namespace electionguard::facades
         void from_montgomery_form(uint64_t *aM, uint64_t *a) const;
 
         void montgomery_mod_mul_stay_in_mont_form(uint32_t *aM, uint32_t *bM, uint32_t *cM) const;
-        void montgomery_mod_mul_stay_in_mont_form(uint64_t *aM, uint64_t *bM, uint64_t *cM) const;
+
+        /// <summary>
+        /// Calculate cM = aM * bM in montgomery form. Constant time callers always use
+        /// the hacl routines, whichever backend is selected.
+        /// </summary>
+        void montgomery_mod_mul_stay_in_mont_form(uint64_t *aM, uint64_t *bM, uint64_t *cM,
+                                                  bool useConstTime = false) const;
 
       private:
         struct Impl;
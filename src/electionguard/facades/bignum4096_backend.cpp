@@ -0,0 +1,50 @@
+#include "bignum4096_backend.hpp"
+
+#include "../cpu_features.hpp"
+
+using std::unique_ptr;
+
+namespace electionguard::facades
+{
+#pragma region Backend Detection
+
+    bool isBignum4096BackendSupported(Bignum4096Backend backend)
+    {
+        switch (backend) {
+            case Bignum4096Backend::portable:
+                return true;
+            case Bignum4096Backend::avx512ifma: {
+#ifndef USE_32BIT_MATH
+                return CpuFeatures::hasAvx512Ifma();
+#else
+                return false;
+#endif
+            }
+        }
+        return false;
+    }
+
+    Bignum4096Backend detectBignum4096Backend()
+    {
+        if (isBignum4096BackendSupported(Bignum4096Backend::avx512ifma)) {
+            return Bignum4096Backend::avx512ifma;
+        }
+        return Bignum4096Backend::portable;
+    }
+
+#pragma endregion
+
+    unique_ptr<Bignum4096Kernel> Bignum4096Kernel::make(Bignum4096Backend backend,
+                                                        const uint64_t *n)
+    {
+        if (!isBignum4096BackendSupported(backend)) {
+            return nullptr;
+        }
+        switch (backend) {
+            case Bignum4096Backend::avx512ifma:
+                return makeBignum4096IfmaKernel(n);
+            default:
+                return nullptr;
+        }
+    }
+} // namespace electionguard::facades
@@ -0,0 +1,71 @@
+#ifndef __ELECTIONGUARD_FACADES_BIGNUM4096_BACKEND_HPP_INCLUDED__
+#define __ELECTIONGUARD_FACADES_BIGNUM4096_BACKEND_HPP_INCLUDED__
+
+#include "electionguard/export.h"
+
+#include <cstdint>
+#include <memory>
+
+namespace electionguard::facades
+{
+    /// <summary>
+    /// The implementations available for 4096-bit montgomery arithmetic.
+    ///
+    /// The portable backend uses the hacl routines and is always available.
+    /// Vector backends are selected at startup when the cpu and operating system support them.
+    /// </summary>
+    enum class Bignum4096Backend {
+        /// <summary>
+        /// The portable hacl 64-bit (or 32-bit) routines
+        /// </summary>
+        portable = 0,
+        /// <summary>
+        /// Montgomery multiplication over 52-bit limbs using AVX-512 IFMA
+        /// </summary>
+        avx512ifma = 1,
+    };
+
+    /// <summary>
+    /// Montgomery multiplication for a fixed odd 4096-bit modulus using a vector backend.
+    ///
+    /// Values use the same montgomery form as hacl (R = 2^4096), so a kernel can replace
+    /// the hacl multiplication without changing how values are converted in and out of that form.
+    /// </summary>
+    class EG_INTERNAL_API Bignum4096Kernel
+    {
+      public:
+        virtual ~Bignum4096Kernel() = default;
+
+        virtual Bignum4096Backend getBackend() const = 0;
+
+        /// <summary>
+        /// Calculate cM = aM * bM / R mod n where aM and bM are less than n
+        /// </summary>
+        virtual void montgomeryMul(const uint64_t *aM, const uint64_t *bM, uint64_t *cM) const = 0;
+
+        /// <summary>
+        /// Make a kernel for the modulus using the specified backend.
+        /// Returns nullptr for the portable backend or when the backend is not supported.
+        /// </summary>
+        static std::unique_ptr<Bignum4096Kernel> make(Bignum4096Backend backend,
+                                                      const uint64_t *n);
+    };
+
+    /// <summary>
+    /// Check whether the cpu and the operating system support a backend
+    /// </summary>
+    EG_INTERNAL_API bool isBignum4096BackendSupported(Bignum4096Backend backend);
+
+    /// <summary>
+    /// Get the fastest backend supported by this machine
+    /// </summary>
+    EG_INTERNAL_API Bignum4096Backend detectBignum4096Backend();
+
+    /// <summary>
+    /// Make an AVX-512 IFMA kernel. Callers must check the backend is supported first.
+    /// </summary>
+    std::unique_ptr<Bignum4096Kernel> makeBignum4096IfmaKernel(const uint64_t *n);
+
+} // namespace electionguard::facades
+
+#endif /* __ELECTIONGUARD_FACADES_BIGNUM4096_BACKEND_HPP_INCLUDED__ */
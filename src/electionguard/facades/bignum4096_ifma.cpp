@@ -0,0 +1,272 @@
+#include "bignum4096_backend.hpp"
+
+#include <cstdint>
+#include <electionguard/constants.h>
+#include <memory>
+#include <utility>
+
+#if (defined(__x86_64__) || defined(_M_X64)) && !defined(USE_32BIT_MATH)
+#    define BIGNUM4096_IFMA_ENABLED
+#    include <immintrin.h>
+#    if defined(_MSC_VER) && !defined(__clang__)
+#        include <intrin.h>
+#        define IFMA_TARGET
+#    else
+#        define IFMA_TARGET __attribute__((target("avx512f,avx512ifma")))
+#    endif
+#endif
+
+using std::index_sequence;
+using std::make_index_sequence;
+using std::make_unique;
+using std::unique_ptr;
+
+namespace electionguard::facades
+{
+#ifdef BIGNUM4096_IFMA_ENABLED
+
+    // the kernel works on 52-bit limbs so each vector lane can hold a full product half
+    constexpr uint32_t LIMB_BITS = 52;
+    constexpr uint64_t LIMB_MASK = (1ULL << LIMB_BITS) - 1;
+    // 79 limbs cover 4096 bits, padded to a whole number of 8 lane vectors
+    constexpr uint32_t LIMB_COUNT = 80;
+    constexpr uint32_t VECTOR_COUNT = LIMB_COUNT / 8;
+    // 78 full rounds reduce 4056 bits, the remaining 40 bits are reduced in a scalar round
+    constexpr uint32_t FULL_ROUNDS = 78;
+    constexpr uint32_t LAST_ROUND_BITS = MAX_P_LEN * 64 - FULL_ROUNDS * LIMB_BITS;
+    constexpr uint64_t LAST_ROUND_MASK = (1ULL << LAST_ROUND_BITS) - 1;
+    // the reduced value is less than 2n so it needs one extra word before the final subtraction
+    constexpr uint32_t WIDE_LEN = MAX_P_LEN + 1;
+
+    /// <summary>
+    /// Calculate a * b + c + carry, returning the low word and updating carry with the high word
+    /// </summary>
+    static inline uint64_t mulAdd(uint64_t a, uint64_t b, uint64_t c, uint64_t &carry)
+    {
+#    if defined(_MSC_VER) && !defined(__clang__)
+        uint64_t high = 0;
+        uint64_t low = _umul128(a, b, &high);
+        high += _addcarry_u64(0, low, c, &low);
+        high += _addcarry_u64(0, low, carry, &low);
+        carry = high;
+        return low;
+#    else
+        auto product = static_cast<unsigned __int128>(a) * b + c + carry;
+        carry = static_cast<uint64_t>(product >> 64);
+        return static_cast<uint64_t>(product);
+#    endif
+    }
+
+    /// <summary>
+    /// Split 64-bit limbs into 52-bit limbs
+    /// </summary>
+    static void toLimbs52(const uint64_t *in, uint64_t *out)
+    {
+        for (uint32_t i = 0; i < LIMB_COUNT; i++) {
+            auto bit = i * LIMB_BITS;
+            auto word = bit / 64;
+            auto shift = bit % 64;
+            uint64_t value = 0;
+            if (word < MAX_P_LEN) {
+                value = in[word] >> shift;
+                if (shift > 64 - LIMB_BITS && word + 1 < MAX_P_LEN) {
+                    value |= in[word + 1] << (64 - shift);
+                }
+            }
+            out[i] = value & LIMB_MASK;
+        }
+    }
+
+    /// <summary>
+    /// Join normalized 52-bit limbs into 64-bit limbs
+    /// </summary>
+    static void fromLimbs52(const uint64_t *in, uint64_t *out, uint32_t outLen)
+    {
+        for (uint32_t i = 0; i < outLen; i++) {
+            out[i] = 0;
+        }
+        for (uint32_t i = 0; i < LIMB_COUNT; i++) {
+            auto bit = i * LIMB_BITS;
+            auto word = bit / 64;
+            auto shift = bit % 64;
+            if (word < outLen) {
+                out[word] |= in[i] << shift;
+            }
+            if (shift > 64 - LIMB_BITS && word + 1 < outLen) {
+                out[word + 1] |= in[i] >> (64 - shift);
+            }
+        }
+    }
+
+    // the accumulator helpers expand over every vector at compile time
+    // so the accumulator stays in registers for the whole multiplication
+    using VectorIndices = make_index_sequence<VECTOR_COUNT>;
+
+    /// <summary>
+    /// acc += lo52(x * y) for every vector
+    /// </summary>
+    template <size_t... I>
+    IFMA_TARGET static inline void madd52lo(__m512i *acc, __m512i x, const uint64_t *y,
+                                            index_sequence<I...>)
+    {
+        ((acc[I] = _mm512_madd52lo_epu64(acc[I], x, _mm512_load_si512(&y[I * 8]))), ...);
+    }
+
+    /// <summary>
+    /// acc += hi52(x * y) for every vector
+    /// </summary>
+    template <size_t... I>
+    IFMA_TARGET static inline void madd52hi(__m512i *acc, __m512i x, const uint64_t *y,
+                                            index_sequence<I...>)
+    {
+        ((acc[I] = _mm512_madd52hi_epu64(acc[I], x, _mm512_load_si512(&y[I * 8]))), ...);
+    }
+
+    /// <summary>
+    /// Shift the accumulator down one limb, discarding the lowest limb
+    /// </summary>
+    template <size_t... I>
+    IFMA_TARGET static inline void shiftLimb(__m512i *acc, index_sequence<I...>)
+    {
+        ((acc[I] = _mm512_alignr_epi64(I + 1 < VECTOR_COUNT ? acc[I + 1] : _mm512_setzero_si512(),
+                                       acc[I], 1)),
+         ...);
+    }
+
+    /// <summary>
+    /// Montgomery multiplication using AVX-512 IFMA.
+    ///
+    /// The operands are split into 52-bit limbs held in ten 8 lane vectors.
+    /// Each round multiplies one limb of a into the accumulator, cancels the lowest
+    /// accumulator limb with a multiple of n and shifts the accumulator down one limb.
+    /// Limbs are left unnormalized between rounds since 78 rounds of 52-bit products
+    /// cannot overflow a 64-bit lane. The last 40 bits of R are reduced in 64-bit scalar
+    /// arithmetic so the result matches the hacl montgomery form exactly.
+    /// </summary>
+    class EG_INTERNAL_API Bignum4096IfmaKernel : public Bignum4096Kernel
+    {
+      public:
+        explicit Bignum4096IfmaKernel(const uint64_t *n)
+        {
+            for (uint32_t i = 0; i < MAX_P_LEN; i++) {
+                n64[i] = n[i];
+            }
+            toLimbs52(n, n52);
+
+            // newton iteration for n^-1 mod 2^64, each step doubles the correct bits
+            uint64_t inverse = n[0];
+            for (uint32_t i = 0; i < 5; i++) {
+                inverse *= 2 - n[0] * inverse;
+            }
+            k0 = 0 - inverse;
+        }
+
+        Bignum4096Backend getBackend() const override { return Bignum4096Backend::avx512ifma; }
+
+        IFMA_TARGET void montgomeryMul(const uint64_t *aM, const uint64_t *bM,
+                                       uint64_t *cM) const override
+        {
+            alignas(64) uint64_t a[LIMB_COUNT];
+            alignas(64) uint64_t b[LIMB_COUNT];
+            toLimbs52(aM, a);
+            toLimbs52(bM, b);
+
+            __m512i acc[VECTOR_COUNT];
+            for (uint32_t v = 0; v < VECTOR_COUNT; v++) {
+                acc[v] = _mm512_setzero_si512();
+            }
+
+            for (uint32_t i = 0; i < FULL_ROUNDS; i++) {
+                const __m512i ai = _mm512_set1_epi64(static_cast<int64_t>(a[i]));
+                madd52lo(acc, ai, b, VectorIndices{});
+
+                // choose m so the lowest limb becomes a multiple of 2^52
+                auto low = static_cast<uint64_t>(_mm_cvtsi128_si64(_mm512_castsi512_si128(acc[0])));
+                auto m = (low * k0) & LIMB_MASK;
+                const __m512i mi = _mm512_set1_epi64(static_cast<int64_t>(m));
+                madd52lo(acc, mi, n52, VectorIndices{});
+                auto carry = (low + ((m * n52[0]) & LIMB_MASK)) >> LIMB_BITS;
+
+                // drop the cancelled limb and carry its high bits into the next one
+                shiftLimb(acc, VectorIndices{});
+                acc[0] = _mm512_mask_add_epi64(acc[0], 1, acc[0],
+                                               _mm512_set1_epi64(static_cast<int64_t>(carry)));
+
+                // the high halves of the products belong one limb up, which is now this limb
+                madd52hi(acc, ai, b, VectorIndices{});
+                madd52hi(acc, mi, n52, VectorIndices{});
+            }
+
+            alignas(64) uint64_t t[LIMB_COUNT];
+            for (uint32_t v = 0; v < VECTOR_COUNT; v++) {
+                _mm512_store_si512(&t[v * 8], acc[v]);
+            }
+            uint64_t carry = 0;
+            for (uint32_t i = 0; i < LIMB_COUNT; i++) {
+                auto limb = t[i] + carry;
+                t[i] = limb & LIMB_MASK;
+                carry = limb >> LIMB_BITS;
+            }
+
+            uint64_t x[WIDE_LEN];
+            fromLimbs52(t, x, WIDE_LEN);
+            finalRound(a[FULL_ROUNDS], bM, x, cM);
+        }
+
+      private:
+        /// <summary>
+        /// Reduce the remaining bits of R in scalar arithmetic and bring the result below n
+        /// </summary>
+        void finalRound(uint64_t aLast, const uint64_t *bM, uint64_t *x, uint64_t *cM) const
+        {
+            uint64_t carry = 0;
+            for (uint32_t i = 0; i < MAX_P_LEN; i++) {
+                x[i] = mulAdd(aLast, bM[i], x[i], carry);
+            }
+            x[MAX_P_LEN] += carry;
+
+            auto m = (x[0] * k0) & LAST_ROUND_MASK;
+            carry = 0;
+            for (uint32_t i = 0; i < MAX_P_LEN; i++) {
+                x[i] = mulAdd(m, n64[i], x[i], carry);
+            }
+            x[MAX_P_LEN] += carry;
+
+            for (uint32_t i = 0; i < MAX_P_LEN; i++) {
+                cM[i] = (x[i] >> LAST_ROUND_BITS) | (x[i + 1] << (64 - LAST_ROUND_BITS));
+            }
+            auto overflow = x[MAX_P_LEN] >> LAST_ROUND_BITS;
+
+            // the result is less than 2n so at most one subtraction is needed. the
+            // difference is selected with a mask since the operands may be secret
+            uint64_t difference[MAX_P_LEN];
+            uint64_t borrow = 0;
+            for (uint32_t i = 0; i < MAX_P_LEN; i++) {
+                auto subtrahend = n64[i] + borrow;
+                auto overflowed = static_cast<uint64_t>(subtrahend < borrow);
+                difference[i] = cM[i] - subtrahend;
+                borrow = overflowed | static_cast<uint64_t>(cM[i] < subtrahend);
+            }
+            auto overflowed = (overflow | (0 - overflow)) >> 63;
+            auto mask = 0 - (overflowed | (borrow ^ 1));
+            for (uint32_t i = 0; i < MAX_P_LEN; i++) {
+                cM[i] = (difference[i] & mask) | (cM[i] & ~mask);
+            }
+        }
+
+        alignas(64) uint64_t n52[LIMB_COUNT];
+        uint64_t n64[MAX_P_LEN];
+        uint64_t k0;
+    };
+
+    unique_ptr<Bignum4096Kernel> makeBignum4096IfmaKernel(const uint64_t *n)
+    {
+        return make_unique<Bignum4096IfmaKernel>(n);
+    }
+
+#else
+
+    unique_ptr<Bignum4096Kernel> makeBignum4096IfmaKernel(const uint64_t *n) { return nullptr; }
+
+#endif
+} // namespace electionguard::facades
@@ -0,0 +1,124 @@
+#include "electionguard/decrypt.hpp"
+
+#include "../log.hpp"
+#include "convert.hpp"
+#include "electionguard/elgamal.hpp"
+#include "electionguard/group.hpp"
+#include "electionguard/status.h"
+#include "variant_cast.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+extern "C" {
+#include "electionguard/decrypt.h"
+}
+
+using electionguard::combineDecryptionShares;
+using electionguard::computeDecryptionShares;
+using electionguard::ElementModP;
+using electionguard::ElementModQ;
+using electionguard::ElGamalCiphertextBatch;
+using electionguard::Log;
+using electionguard::uint64_to_size;
+using std::copy;
+using std::invalid_argument;
+using std::reference_wrapper;
+using std::vector;
+
+#pragma region DecryptionShares
+
+eg_electionguard_status_t eg_decryption_shares_compute(
+  const uint64_t *in_ciphertexts, uint64_t in_ciphertexts_size, eg_element_mod_q_t *in_secret_key,
+  eg_element_mod_q_t *in_extended_base_hash, eg_element_mod_q_t *in_nonce_seed,
+  uint64_t in_concurrency, uint64_t *out_shares, uint64_t *out_commitments,
+  uint64_t *out_challenges, uint64_t *out_responses)
+{
+    if (in_secret_key == nullptr || in_extended_base_hash == nullptr || in_nonce_seed == nullptr) {
+        return ELECTIONGUARD_STATUS_ERROR_INVALID_ARGUMENT;
+    }
+    if (in_ciphertexts_size > 0 &&
+        (in_ciphertexts == nullptr || out_shares == nullptr || out_commitments == nullptr ||
+         out_challenges == nullptr || out_responses == nullptr)) {
+        return ELECTIONGUARD_STATUS_ERROR_INVALID_ARGUMENT;
+    }
+
+    try {
+        auto count = uint64_to_size(in_ciphertexts_size);
+        auto *secretKey = AS_TYPE(ElementModQ, in_secret_key);
+        auto *extendedBaseHash = AS_TYPE(ElementModQ, in_extended_base_hash);
+        auto *nonceSeed = AS_TYPE(ElementModQ, in_nonce_seed);
+
+        ElGamalCiphertextBatch ciphertexts(count);
+        if (count > 0) {
+            copy(in_ciphertexts, in_ciphertexts + 2 * count * MAX_P_LEN, ciphertexts.getPad(0));
+        }
+
+        auto shares = computeDecryptionShares(ciphertexts, *secretKey, *extendedBaseHash,
+                                              *nonceSeed, uint64_to_size(in_concurrency));
+        if (count > 0) {
+            copy(shares.getShare(0), shares.getShare(0) + count * MAX_P_LEN, out_shares);
+            copy(shares.getCommitmentPad(0), shares.getCommitmentPad(0) + 2 * count * MAX_P_LEN,
+                 out_commitments);
+            copy(shares.getChallenge(0), shares.getChallenge(0) + count * MAX_Q_LEN,
+                 out_challenges);
+            copy(shares.getResponse(0), shares.getResponse(0) + count * MAX_Q_LEN, out_responses);
+        }
+        return ELECTIONGUARD_STATUS_SUCCESS;
+    } catch (const invalid_argument &e) {
+        Log::error(__func__, e);
+        return ELECTIONGUARD_STATUS_ERROR_INVALID_ARGUMENT;
+    } catch (const exception &e) {
+        Log::error(__func__, e);
+        return ELECTIONGUARD_STATUS_ERROR_RUNTIME_ERROR;
+    }
+}
+
+eg_electionguard_status_t eg_decryption_shares_combine(
+  const uint64_t *in_ciphertexts, uint64_t in_ciphertexts_size, const uint64_t *in_shares,
+  eg_element_mod_q_t *in_coefficients[], uint64_t in_guardians_size, eg_element_mod_p_t *in_base,
+  uint64_t in_concurrency, uint64_t *out_plaintexts)
+{
+    if (in_base == nullptr || (in_guardians_size > 0 && in_coefficients == nullptr)) {
+        return ELECTIONGUARD_STATUS_ERROR_INVALID_ARGUMENT;
+    }
+    if (in_ciphertexts_size > 0 &&
+        (in_ciphertexts == nullptr || out_plaintexts == nullptr ||
+         (in_guardians_size > 0 && in_shares == nullptr))) {
+        return ELECTIONGUARD_STATUS_ERROR_INVALID_ARGUMENT;
+    }
+
+    try {
+        auto count = uint64_to_size(in_ciphertexts_size);
+        auto guardians = uint64_to_size(in_guardians_size);
+        auto *base = AS_TYPE(ElementModP, in_base);
+
+        vector<const uint64_t *> shares;
+        vector<reference_wrapper<const ElementModQ>> coefficients;
+        shares.reserve(guardians);
+        coefficients.reserve(guardians);
+        for (size_t i = 0; i < guardians; i++) {
+            if (in_coefficients[i] == nullptr) {
+                return ELECTIONGUARD_STATUS_ERROR_INVALID_ARGUMENT;
+            }
+            shares.push_back(in_shares + i * count * MAX_P_LEN);
+            coefficients.push_back(*AS_TYPE(ElementModQ, in_coefficients[i]));
+        }
+
+        ElGamalCiphertextBatch ciphertexts(count);
+        if (count > 0) {
+            copy(in_ciphertexts, in_ciphertexts + 2 * count * MAX_P_LEN, ciphertexts.getPad(0));
+        }
+
+        auto plaintexts = combineDecryptionShares(ciphertexts, shares, coefficients, *base,
+                                                  uint64_to_size(in_concurrency));
+        copy(plaintexts.begin(), plaintexts.end(), out_plaintexts);
+        return ELECTIONGUARD_STATUS_SUCCESS;
+    } catch (const exception &e) {
+        Log::error(__func__, e);
+        return ELECTIONGUARD_STATUS_ERROR_RUNTIME_ERROR;
+    }
+}
+
+#pragma endregion
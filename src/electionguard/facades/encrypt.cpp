@@ -1,12 +1,18 @@
 #include "electionguard/encrypt.hpp"
 
 #include "../log.hpp"
+#include "electionguard/async.hpp"
 #include "convert.hpp"
 #include "variant_cast.hpp"
 
+#include <algorithm>
 #include <cerrno>
 #include <exception>
+#include <functional>
+#include <nlohmann/json.hpp>
 #include <stdexcept>
+#include <string>
+#include <vector>
 
 extern "C" {
 #include "electionguard/encrypt.h"
@@ -27,6 +33,7 @@ using electionguard::EncryptionDevice;
 using electionguard::EncryptionMediator;
 using electionguard::InternalManifest;
 using electionguard::Log;
+using electionguard::map_async;
 using electionguard::PlaintextBallot;
 using electionguard::PlaintextBallotContest;
 using electionguard::PlaintextBallotSelection;
@@ -34,8 +41,11 @@ using electionguard::SelectionDescription;
 
 using std::invalid_argument;
 using std::make_unique;
+using std::reference_wrapper;
 using std::runtime_error;
+using std::string;
 using std::unique_ptr;
+using std::vector;
 
 #pragma region EncryptionDevice
 
@@ -296,6 +306,122 @@ eg_electionguard_status_t eg_encryption_mediator_encrypt_ballot_verify_proofs(
     }
 }
 
+static unique_ptr<PlaintextBallot> plaintextFrom(const uint8_t *data, uint64_t size,
+                                                 eg_ballot_serialization_t format)
+{
+    // a malformed plaintext is the caller's input, not a failure of the library
+    try {
+        switch (format) {
+            case ELECTIONGUARD_BALLOT_SERIALIZATION_JSON:
+                return PlaintextBallot::fromJson(
+                  string(reinterpret_cast<const char *>(data), size));
+            case ELECTIONGUARD_BALLOT_SERIALIZATION_BSON:
+                return PlaintextBallot::fromBson(vector<uint8_t>(data, data + size));
+            case ELECTIONGUARD_BALLOT_SERIALIZATION_MSGPACK:
+                return PlaintextBallot::fromMsgPack(vector<uint8_t>(data, data + size));
+            default:
+                throw invalid_argument(
+                  "plaintext ballots are serialized as JSON, BSON or MessagePack");
+        }
+    } catch (const nlohmann::json::exception &e) {
+        throw invalid_argument(e.what());
+    }
+}
+
+static vector<uint8_t> ciphertextTo(const CiphertextBallot &ballot,
+                                    eg_ballot_serialization_t format)
+{
+    switch (format) {
+        case ELECTIONGUARD_BALLOT_SERIALIZATION_JSON: {
+            auto json = ballot.toJson();
+            return vector<uint8_t>(json.begin(), json.end());
+        }
+        case ELECTIONGUARD_BALLOT_SERIALIZATION_BSON:
+            return ballot.toBson();
+        case ELECTIONGUARD_BALLOT_SERIALIZATION_MSGPACK:
+            return ballot.toMsgPack();
+        default:
+            return ballot.toBinary();
+    }
+}
+
+eg_electionguard_status_t eg_encryption_mediator_encrypt_ballots(
+  eg_encryption_mediator_t *handle, const uint8_t *in_plaintexts,
+  const uint64_t *in_plaintext_offsets, uint64_t in_count,
+  eg_ballot_serialization_t in_plaintext_format, eg_ballot_serialization_t in_ciphertext_format,
+  bool in_should_verify_proofs, bool in_use_precomputed_values, uint32_t in_concurrency,
+  uint8_t *out_arena, uint64_t in_arena_size, uint64_t *out_offsets, uint64_t *out_required_size)
+{
+    if (handle == nullptr || in_plaintext_offsets == nullptr || out_offsets == nullptr ||
+        out_required_size == nullptr || (in_count > 0 && in_plaintexts == nullptr)) {
+        return ELECTIONGUARD_STATUS_ERROR_INVALID_ARGUMENT;
+    }
+
+    try {
+        if (in_ciphertext_format > ELECTIONGUARD_BALLOT_SERIALIZATION_BINARY) {
+            throw invalid_argument("unknown ciphertext ballot serialization");
+        }
+        for (uint64_t i = 0; i < in_count; i++) {
+            if (in_plaintext_offsets[i + 1] < in_plaintext_offsets[i]) {
+                throw invalid_argument("plaintext ballot offsets must not decrease");
+            }
+        }
+
+        auto *mediator = AS_TYPE(EncryptionMediator, handle);
+        auto plaintexts =
+          map_async<unique_ptr<PlaintextBallot>>(in_count, in_concurrency, [&](size_t i) {
+              return plaintextFrom(in_plaintexts + in_plaintext_offsets[i],
+                                   in_plaintext_offsets[i + 1] - in_plaintext_offsets[i],
+                                   in_plaintext_format);
+          });
+        vector<reference_wrapper<const PlaintextBallot>> ballots;
+        ballots.reserve(plaintexts.size());
+        for (const auto &plaintext : plaintexts) {
+            ballots.push_back(*plaintext);
+        }
+
+        // ballots that are not handed back to the caller must not stay in the chain
+        auto ballotCodeSeed = mediator->getBallotCodeSeed();
+        vector<vector<uint8_t>> ciphertexts;
+        try {
+            auto encrypted = mediator->encryptBatch(ballots, in_should_verify_proofs,
+                                                    in_use_precomputed_values, in_concurrency);
+            ciphertexts = map_async<vector<uint8_t>>(in_count, in_concurrency, [&](size_t i) {
+                return ciphertextTo(*encrypted[i], in_ciphertext_format);
+            });
+        } catch (...) {
+            mediator->setBallotCodeSeed(*ballotCodeSeed);
+            throw;
+        }
+
+        uint64_t size = 0;
+        for (uint64_t i = 0; i < in_count; i++) {
+            out_offsets[i] = size;
+            size += ciphertexts[i].size();
+        }
+        out_offsets[in_count] = size;
+        *out_required_size = size;
+        if (size > in_arena_size || (size > 0 && out_arena == nullptr)) {
+            mediator->setBallotCodeSeed(*ballotCodeSeed);
+            return ELECTIONGUARD_STATUS_ERROR_OUT_OF_RANGE;
+        }
+
+        for (uint64_t i = 0; i < in_count; i++) {
+            std::copy(ciphertexts[i].begin(), ciphertexts[i].end(), out_arena + out_offsets[i]);
+        }
+        return ELECTIONGUARD_STATUS_SUCCESS;
+    } catch (const invalid_argument &e) {
+        Log::error(":eg_encryption_mediator_encrypt_ballots", e);
+        return ELECTIONGUARD_STATUS_ERROR_INVALID_ARGUMENT;
+    } catch (const runtime_error &e) {
+        Log::error(":eg_encryption_mediator_encrypt_ballots", e);
+        return ELECTIONGUARD_STATUS_ERROR_RUNTIME_ERROR;
+    } catch (const exception &e) {
+        Log::error(":eg_encryption_mediator_encrypt_ballots", e);
+        return ELECTIONGUARD_STATUS_ERROR_BAD_ALLOC;
+    }
+}
+
 #pragma endregion
 
 #pragma region EncryptSelection
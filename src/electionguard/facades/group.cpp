@@ -11,6 +11,8 @@ extern "C" {
 #include "serialize.hpp"
 
 #include <cstring>
+#include <functional>
+#include <vector>
 
 using electionguard::bytes_to_p;
 using electionguard::bytes_to_q;
@@ -19,6 +21,7 @@ using electionguard::ElementModP;
 using electionguard::ElementModQ;
 using electionguard::G;
 using electionguard::hash_elems;
+using electionguard::is_valid_residue_batch;
 using electionguard::Log;
 using electionguard::ONE_MOD_P;
 using electionguard::ONE_MOD_Q;
@@ -34,7 +37,10 @@ using electionguard::ZERO_MOD_P;
 using electionguard::ZERO_MOD_Q;
 
 using std::make_unique;
+using std::reference_wrapper;
 using std::string;
+using std::unique_ptr;
+using std::vector;
 
 using ConstantsSerializer = electionguard::Serialize::Constants;
 
@@ -88,6 +94,42 @@ EG_API eg_electionguard_status_t eg_element_mod_p_new_bytes(uint8_t *in_data, ui
     }
 }
 
+eg_electionguard_status_t eg_element_mod_p_borrow(const uint64_t *in_data,
+                                                  eg_element_mod_p_t **out_handle)
+{
+    if (in_data == nullptr) {
+        return ELECTIONGUARD_STATUS_ERROR_INVALID_ARGUMENT;
+    }
+
+    try {
+        auto element = ElementModP::borrow(in_data);
+        *out_handle = AS_TYPE(eg_element_mod_p_t, element.release());
+
+        return ELECTIONGUARD_STATUS_SUCCESS;
+    } catch (const exception &e) {
+        Log::error(__func__, e);
+        return ELECTIONGUARD_STATUS_ERROR_BAD_ALLOC;
+    }
+}
+
+eg_electionguard_status_t eg_element_mod_p_borrow_unchecked(const uint64_t *in_data,
+                                                            eg_element_mod_p_t **out_handle)
+{
+    if (in_data == nullptr) {
+        return ELECTIONGUARD_STATUS_ERROR_INVALID_ARGUMENT;
+    }
+
+    try {
+        auto element = ElementModP::borrow(in_data, true);
+        *out_handle = AS_TYPE(eg_element_mod_p_t, element.release());
+
+        return ELECTIONGUARD_STATUS_SUCCESS;
+    } catch (const exception &e) {
+        Log::error(__func__, e);
+        return ELECTIONGUARD_STATUS_ERROR_BAD_ALLOC;
+    }
+}
+
 eg_electionguard_status_t eg_element_mod_p_free(eg_element_mod_p_t *handle)
 {
     if (handle == nullptr) {
@@ -253,6 +295,42 @@ EG_API eg_electionguard_status_t eg_element_mod_q_new_bytes(uint8_t *in_data, ui
     }
 }
 
+eg_electionguard_status_t eg_element_mod_q_borrow(const uint64_t *in_data,
+                                                  eg_element_mod_q_t **out_handle)
+{
+    if (in_data == nullptr) {
+        return ELECTIONGUARD_STATUS_ERROR_INVALID_ARGUMENT;
+    }
+
+    try {
+        auto element = ElementModQ::borrow(in_data);
+        *out_handle = AS_TYPE(eg_element_mod_q_t, element.release());
+
+        return ELECTIONGUARD_STATUS_SUCCESS;
+    } catch (const exception &e) {
+        Log::error(__func__, e);
+        return ELECTIONGUARD_STATUS_ERROR_BAD_ALLOC;
+    }
+}
+
+eg_electionguard_status_t eg_element_mod_q_borrow_unchecked(const uint64_t *in_data,
+                                                            eg_element_mod_q_t **out_handle)
+{
+    if (in_data == nullptr) {
+        return ELECTIONGUARD_STATUS_ERROR_INVALID_ARGUMENT;
+    }
+
+    try {
+        auto element = ElementModQ::borrow(in_data, true);
+        *out_handle = AS_TYPE(eg_element_mod_q_t, element.release());
+
+        return ELECTIONGUARD_STATUS_SUCCESS;
+    } catch (const exception &e) {
+        Log::error(__func__, e);
+        return ELECTIONGUARD_STATUS_ERROR_BAD_ALLOC;
+    }
+}
+
 eg_electionguard_status_t eg_element_mod_q_free(eg_element_mod_q_t *handle)
 {
     if (handle == nullptr) {
@@ -594,6 +672,36 @@ eg_electionguard_status_t eg_element_mod_q_pow_mod_p(eg_element_mod_p_t *base,
     }
 }
 
+eg_electionguard_status_t eg_element_mod_p_is_valid_residue_batch(const uint64_t *in_data,
+                                                                  uint64_t in_count,
+                                                                  bool *out_values)
+{
+    if ((in_data == nullptr || out_values == nullptr) && in_count > 0) {
+        return ELECTIONGUARD_STATUS_ERROR_INVALID_ARGUMENT;
+    }
+
+    try {
+        // the elements only borrow the caller's limbs, so none of them is copied
+        vector<unique_ptr<ElementModP>> elements;
+        vector<reference_wrapper<const ElementModP>> elementRefs;
+        elements.reserve(in_count);
+        elementRefs.reserve(in_count);
+        for (uint64_t i = 0; i < in_count; i++) {
+            elements.push_back(ElementModP::borrow(in_data + i * MAX_P_LEN, true));
+            elementRefs.push_back(*elements.back());
+        }
+
+        auto results = is_valid_residue_batch(elementRefs);
+        for (uint64_t i = 0; i < in_count; i++) {
+            out_values[i] = results[i];
+        }
+        return ELECTIONGUARD_STATUS_SUCCESS;
+    } catch (const exception &e) {
+        Log::error(__func__, e);
+        return ELECTIONGUARD_STATUS_ERROR_BAD_ALLOC;
+    }
+}
+
 #pragma endregion
 
 #pragma region ElementModQ Group Math Functions
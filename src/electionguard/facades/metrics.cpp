@@ -0,0 +1,73 @@
+#include "electionguard/metrics.hpp"
+
+#include "../log.hpp"
+#include "electionguard/status.h"
+
+extern "C" {
+#include "electionguard/metrics.h"
+}
+
+using electionguard::Log;
+using electionguard::Metric;
+using electionguard::Metrics;
+
+#pragma region Metrics
+
+uint64_t eg_metrics_get_count() { return Metrics::COUNT; }
+
+const char *eg_metrics_get_name(eg_metric_t in_metric)
+{
+    if (static_cast<uint64_t>(in_metric) >= Metrics::COUNT) {
+        return nullptr;
+    }
+    return Metrics::getName(static_cast<Metric>(in_metric));
+}
+
+eg_electionguard_status_t eg_metrics_get(eg_metric_t in_metric, uint64_t *out_value)
+{
+    if (out_value == nullptr || static_cast<uint64_t>(in_metric) >= Metrics::COUNT) {
+        return ELECTIONGUARD_STATUS_ERROR_INVALID_ARGUMENT;
+    }
+
+    try {
+        *out_value = Metrics::get(static_cast<Metric>(in_metric));
+        return ELECTIONGUARD_STATUS_SUCCESS;
+    } catch (const exception &e) {
+        Log::error(__func__, e);
+        return ELECTIONGUARD_STATUS_ERROR_BAD_ALLOC;
+    }
+}
+
+eg_electionguard_status_t eg_metrics_snapshot(uint64_t *out_values, uint64_t in_capacity,
+                                              uint64_t *out_count)
+{
+    if (out_values == nullptr || out_count == nullptr) {
+        return ELECTIONGUARD_STATUS_ERROR_INVALID_ARGUMENT;
+    }
+
+    try {
+        auto snapshot = Metrics::snapshot();
+        auto count = in_capacity < Metrics::COUNT ? in_capacity : Metrics::COUNT;
+        for (uint64_t i = 0; i < count; i++) {
+            out_values[i] = snapshot[i];
+        }
+        *out_count = count;
+        return ELECTIONGUARD_STATUS_SUCCESS;
+    } catch (const exception &e) {
+        Log::error(__func__, e);
+        return ELECTIONGUARD_STATUS_ERROR_BAD_ALLOC;
+    }
+}
+
+eg_electionguard_status_t eg_metrics_reset()
+{
+    try {
+        Metrics::reset();
+        return ELECTIONGUARD_STATUS_SUCCESS;
+    } catch (const exception &e) {
+        Log::error(__func__, e);
+        return ELECTIONGUARD_STATUS_ERROR_BAD_ALLOC;
+    }
+}
+
+#pragma endregion
@@ -1,3 +1,4 @@
+#include "electionguard/manifest.hpp"
 #include "electionguard/precompute_buffers.hpp"
 
 #include "../log.hpp"
@@ -14,7 +15,10 @@ extern "C" {
 
 using electionguard::ElementModP;
 using electionguard::ElementModQ;
+using electionguard::InternalManifest;
 using electionguard::PrecomputeBufferContext;
+using electionguard::PrecomputeProfile;
+using electionguard::PrecomputeQueueStatus;
 
 #pragma region Precompute
 
@@ -66,6 +70,54 @@ eg_electionguard_status_t eg_precompute_buffer_context_stop()
     }
 }
 
+eg_electionguard_status_t eg_precompute_buffer_context_add(eg_element_mod_p_t *in_public_key,
+                                                           uint32_t max_buffers)
+{
+    if (in_public_key == nullptr) {
+        return ELECTIONGUARD_STATUS_ERROR_INVALID_ARGUMENT;
+    }
+
+    try {
+        auto *public_key = AS_TYPE(ElementModP, in_public_key);
+        PrecomputeBufferContext::add(*public_key, max_buffers);
+        return ELECTIONGUARD_STATUS_SUCCESS;
+    } catch (const std::exception &e) {
+        Log::error(":eg_precompute_add", e);
+        return ELECTIONGUARD_STATUS_ERROR_RUNTIME_ERROR;
+    }
+}
+
+eg_electionguard_status_t eg_precompute_buffer_context_remove(eg_element_mod_p_t *in_public_key)
+{
+    if (in_public_key == nullptr) {
+        return ELECTIONGUARD_STATUS_ERROR_INVALID_ARGUMENT;
+    }
+
+    try {
+        auto *public_key = AS_TYPE(ElementModP, in_public_key);
+        PrecomputeBufferContext::remove(*public_key);
+        return ELECTIONGUARD_STATUS_SUCCESS;
+    } catch (const std::exception &e) {
+        Log::error(":eg_precompute_remove", e);
+        return ELECTIONGUARD_STATUS_ERROR_RUNTIME_ERROR;
+    }
+}
+
+eg_electionguard_status_t eg_precompute_buffer_context_set_memory_budget(uint64_t in_bytes)
+{
+    PrecomputeBufferContext::setMemoryBudget(in_bytes);
+    return ELECTIONGUARD_STATUS_SUCCESS;
+}
+
+eg_electionguard_status_t eg_precompute_buffer_context_get_memory_usage(uint64_t *out_bytes)
+{
+    if (out_bytes == nullptr) {
+        return ELECTIONGUARD_STATUS_ERROR_INVALID_ARGUMENT;
+    }
+    *out_bytes = PrecomputeBufferContext::getMemoryUsage();
+    return ELECTIONGUARD_STATUS_SUCCESS;
+}
+
 eg_electionguard_status_t eg_precompute_buffer_context_status(uint32_t *out_count,
                                                               uint32_t *out_queue_size)
 {
@@ -79,4 +131,56 @@ eg_electionguard_status_t eg_precompute_buffer_context_status(uint32_t *out_coun
     }
 }
 
+eg_electionguard_status_t
+eg_precompute_buffer_context_set_profile(eg_internal_manifest_t *in_manifest)
+{
+    if (in_manifest == nullptr) {
+        return ELECTIONGUARD_STATUS_ERROR_INVALID_ARGUMENT;
+    }
+
+    try {
+        auto *manifest = AS_TYPE(InternalManifest, in_manifest);
+        PrecomputeBufferContext::setProfile(PrecomputeProfile::fromManifest(*manifest));
+        return ELECTIONGUARD_STATUS_SUCCESS;
+    } catch (const std::exception &e) {
+        Log::error(":eg_precompute_set_profile", e);
+        return ELECTIONGUARD_STATUS_ERROR_RUNTIME_ERROR;
+    }
+}
+
+eg_electionguard_status_t eg_precompute_buffer_context_queue_status(eg_precompute_queue_t in_queue,
+                                                                    uint32_t *out_count,
+                                                                    uint32_t *out_target,
+                                                                    uint64_t *out_hits,
+                                                                    uint64_t *out_misses)
+{
+    if (out_count == nullptr || out_target == nullptr || out_hits == nullptr ||
+        out_misses == nullptr) {
+        return ELECTIONGUARD_STATUS_ERROR_INVALID_ARGUMENT;
+    }
+
+    try {
+        auto status = PrecomputeBufferContext::getStatus();
+        PrecomputeQueueStatus queue;
+        switch (in_queue) {
+            case ELECTIONGUARD_PRECOMPUTE_QUEUE_SELECTIONS:
+                queue = status.selections;
+                break;
+            case ELECTIONGUARD_PRECOMPUTE_QUEUE_ENCRYPTIONS:
+                queue = status.encryptions;
+                break;
+            default:
+                return ELECTIONGUARD_STATUS_ERROR_INVALID_ARGUMENT;
+        }
+        *out_count = queue.size;
+        *out_target = queue.target;
+        *out_hits = queue.hits;
+        *out_misses = queue.misses;
+        return ELECTIONGUARD_STATUS_SUCCESS;
+    } catch (const std::exception &e) {
+        Log::error(":eg_precompute_queue_status", e);
+        return ELECTIONGUARD_STATUS_ERROR_RUNTIME_ERROR;
+    }
+}
+
 #pragma endregion
@@ -0,0 +1,61 @@
+#include "electionguard/tracing.hpp"
+
+#include "../log.hpp"
+#include "convert.hpp"
+#include "electionguard/status.h"
+
+extern "C" {
+#include "electionguard/tracing.h"
+}
+
+using electionguard::dynamicCopy;
+using electionguard::Log;
+using electionguard::Tracing;
+
+#pragma region Tracing
+
+bool eg_tracing_is_compiled_in() { return Tracing::isCompiledIn(); }
+
+eg_electionguard_status_t eg_tracing_set_enabled(bool in_enabled)
+{
+    try {
+        Tracing::setEnabled(in_enabled);
+        return ELECTIONGUARD_STATUS_SUCCESS;
+    } catch (const exception &e) {
+        Log::error(__func__, e);
+        return ELECTIONGUARD_STATUS_ERROR_BAD_ALLOC;
+    }
+}
+
+eg_electionguard_status_t eg_tracing_clear()
+{
+    try {
+        Tracing::clear();
+        return ELECTIONGUARD_STATUS_SUCCESS;
+    } catch (const exception &e) {
+        Log::error(__func__, e);
+        return ELECTIONGUARD_STATUS_ERROR_BAD_ALLOC;
+    }
+}
+
+eg_electionguard_status_t eg_tracing_to_chrome_json(char **out_data, uint64_t *out_size)
+{
+    if (out_data == nullptr || out_size == nullptr) {
+        return ELECTIONGUARD_STATUS_ERROR_INVALID_ARGUMENT;
+    }
+
+    try {
+        auto result = Tracing::toChromeTraceJson();
+
+        size_t size = 0;
+        *out_data = dynamicCopy(result, &size);
+        *out_size = (uint64_t)size;
+
+        return ELECTIONGUARD_STATUS_SUCCESS;
+    } catch (const exception &e) {
+        Log::error(__func__, e);
+        return ELECTIONGUARD_STATUS_ERROR_BAD_ALLOC;
+    }
+}
+
+#pragma endregion
@@ -3,6 +3,7 @@
 #include "../../libs/hacl/Hacl_Bignum256.hpp"
 #include "../../libs/hacl/Lib.hpp"
 #include "convert.hpp"
+#include "electionguard/metrics.hpp"
 #include "facades/bignum256.hpp"
 #include "facades/bignum4096.hpp"
 #include "krml/lowstar_endianness.h"
@@ -11,10 +12,14 @@
 #include "random.hpp"
 #include "utils.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <cstring>
 #include <cstdint>
 #include <iomanip>
 #include <iostream>
+#include <mutex>
 #include <random>
 #include <sstream>
 #include <stdexcept>
@@ -25,6 +30,10 @@ using electionguard::facades::CONTEXT_P;
 using electionguard::facades::CONTEXT_Q;
 using hacl::Bignum256;
 using hacl::Lib;
+using std::all_of;
+using std::atomic;
+using std::atomic_load;
+using std::atomic_store;
 using std::begin;
 using std::copy;
 using std::end;
@@ -37,6 +46,7 @@ using std::out_of_range;
 using std::overflow_error;
 using std::reference_wrapper;
 using std::runtime_error;
+using std::shared_ptr;
 using std::to_string;
 using std::unique_ptr;
 
@@ -45,111 +55,219 @@ namespace electionguard
 
 #pragma region Constants
 
+    /// <summary>
+    /// Constants are hashed and serialized throughout an election,
+    /// so their representations are cached
+    /// </summary>
+    template <typename T> static T makeConstant(T element)
+    {
+        element.setIsCacheable(true);
+        return element;
+    }
+
     const ElementModP &R()
     {
-        static ElementModP instance{R_ARRAY_REVERSE, true};
+        static ElementModP instance = makeConstant(ElementModP{R_ARRAY_REVERSE, true});
         return instance;
     }
 
     const ElementModP &G()
     {
-        static ElementModP instance{G_ARRAY_REVERSE, true, true};
+        static ElementModP instance = makeConstant(ElementModP{G_ARRAY_REVERSE, true, true});
         return instance;
     }
 
     const ElementModP &P()
     {
-        static ElementModP instance{P_ARRAY_REVERSE, true};
+        static ElementModP instance = makeConstant(ElementModP{P_ARRAY_REVERSE, true});
         return instance;
     }
 
     const ElementModP &ZERO_MOD_P()
     {
-        static ElementModP instance{ZERO_MOD_P_ARRAY, true};
+        static ElementModP instance = makeConstant(ElementModP{ZERO_MOD_P_ARRAY, true});
         return instance;
     }
 
     const ElementModP &ONE_MOD_P()
     {
-        static ElementModP instance{ONE_MOD_P_ARRAY, true};
+        static ElementModP instance = makeConstant(ElementModP{ONE_MOD_P_ARRAY, true});
         return instance;
     }
 
     const ElementModP &TWO_MOD_P()
     {
-        static ElementModP instance{TWO_MOD_P_ARRAY, true};
+        static ElementModP instance = makeConstant(ElementModP{TWO_MOD_P_ARRAY, true});
         return instance;
     }
 
     const ElementModQ &Q()
     {
-        static ElementModQ instance{Q_ARRAY_REVERSE, true};
+        static ElementModQ instance = makeConstant(ElementModQ{Q_ARRAY_REVERSE, true});
         return instance;
     }
 
     const ElementModQ &ZERO_MOD_Q()
     {
-        static ElementModQ instance{ZERO_MOD_Q_ARRAY, true};
+        static ElementModQ instance = makeConstant(ElementModQ{ZERO_MOD_Q_ARRAY, true});
         return instance;
     }
 
     const ElementModQ &ONE_MOD_Q()
     {
 
-        static ElementModQ instance{ONE_MOD_Q_ARRAY, true};
+        static ElementModQ instance = makeConstant(ElementModQ{ONE_MOD_Q_ARRAY, true});
         return instance;
     }
 
     const ElementModQ &TWO_MOD_Q()
     {
-        static ElementModQ instance{TWO_MOD_Q_ARRAY, true};
+        static ElementModQ instance = makeConstant(ElementModQ{TWO_MOD_Q_ARRAY, true});
         return instance;
     }
 
 #pragma endregion
 
+#pragma region Representation Cache
+
+    /// <summary>
+    /// The hex and bytes representations of an element, computed on first use.
+    /// The slots are swapped atomically so shared constants can be encoded from any thread.
+    /// </summary>
+    struct RepresentationCache {
+        bool isCacheable = false;
+        bool isSecret = false;
+
+        [[nodiscard]] shared_ptr<const string> getHex() const
+        {
+            return isPopulated.load(std::memory_order_acquire) ? atomic_load(&hex) : nullptr;
+        }
+
+        [[nodiscard]] shared_ptr<const vector<uint8_t>> getBytes() const
+        {
+            return isPopulated.load(std::memory_order_acquire) ? atomic_load(&bytes) : nullptr;
+        }
+
+        void setHex(const string &value)
+        {
+            atomic_store(&hex, std::make_shared<const string>(value));
+            isPopulated.store(true, std::memory_order_release);
+        }
+
+        void setBytes(const vector<uint8_t> &value)
+        {
+            atomic_store(&bytes, std::make_shared<const vector<uint8_t>>(value));
+            isPopulated.store(true, std::memory_order_release);
+        }
+
+        void clear()
+        {
+            if (isPopulated.exchange(false, std::memory_order_acq_rel)) {
+                atomic_store(&hex, shared_ptr<const string>());
+                atomic_store(&bytes, shared_ptr<const vector<uint8_t>>());
+            }
+        }
+
+      private:
+        atomic<bool> isPopulated{false};
+        shared_ptr<const string> hex;
+        shared_ptr<const vector<uint8_t>> bytes;
+    };
+
+    // the limbs of an element that are owned by the caller
+    struct BorrowedLimbs {
+        const uint64_t *limbs;
+    };
+
+#pragma endregion
+
 #pragma region ElementModP
 
     struct ElementModP::Impl {
 
         bool isFixedBase = false;
         uint64_t data[MAX_P_LEN] = {};
-        string hexRepresentation;
+        // a borrowed element reads the caller's limbs in place
+        // until it is first mutated, when they are copied into the element.
+        // the copy is published through the pointer, since threads may still be
+        // reading a shared borrowed element while one of them asks for mutable access
+        std::atomic<const uint64_t *> borrowed{nullptr};
+        std::once_flag materialized;
+        RepresentationCache cache;
 
         Impl(const vector<uint64_t> &elem, bool unchecked, bool fixedBase)
         {
             uint64_t array[MAX_P_LEN] = {};
             copy(elem.begin(), elem.end(), static_cast<uint64_t *>(array));
-            if (!unchecked && Bignum4096::lessThan(const_cast<uint64_t *>(P().get()),
+            if (!unchecked && Bignum4096::lessThan(const_cast<uint64_t *>(P().cget()),
                                                    static_cast<uint64_t *>(array)) > 0) {
                 throw out_of_range("Value for ElementModP is greater than allowed");
             }
             isFixedBase = fixedBase;
             copy(begin(array), end(array), begin(data));
+            Metrics::increment(Metric::elementAllocations);
         };
 
         Impl(const uint64_t (&elem)[MAX_P_LEN], bool unchecked, bool fixedBase)
         {
-            if (!unchecked && Bignum4096::lessThan(const_cast<uint64_t *>(P().get()),
+            if (!unchecked && Bignum4096::lessThan(const_cast<uint64_t *>(P().cget()),
                                                    const_cast<uint64_t *>(elem)) > 0) {
                 throw out_of_range("Value for ElementModP is greater than allowed");
             }
             isFixedBase = fixedBase;
             copy(begin(elem), end(elem), begin(data));
+            Metrics::increment(Metric::elementAllocations);
+        };
+
+        Impl(BorrowedLimbs elem, bool unchecked) : borrowed{elem.limbs}
+        {
+            if (!unchecked && Bignum4096::lessThan(const_cast<uint64_t *>(P().cget()),
+                                                   const_cast<uint64_t *>(elem.limbs)) > 0) {
+                throw out_of_range("Value for ElementModP is greater than allowed");
+            }
+            Metrics::increment(Metric::elementAllocations);
         };
 
         ~Impl() { hacl::Lib::memZero(static_cast<uint64_t *>(data), MAX_P_LEN); };
 
+        [[nodiscard]] const uint64_t (&values() const)[MAX_P_LEN]
+        {
+            if (const auto *limbs = borrowed.load(std::memory_order_acquire)) {
+                return *reinterpret_cast<const uint64_t(*)[MAX_P_LEN]>(limbs);
+            }
+            return data;
+        }
+
+        uint64_t (&mutableValues())[MAX_P_LEN]
+        {
+            if (borrowed.load(std::memory_order_acquire) != nullptr) {
+                std::call_once(materialized, [this] {
+                    const auto *limbs = borrowed.load(std::memory_order_relaxed);
+                    copy(limbs, limbs + MAX_P_LEN, begin(data));
+                    borrowed.store(nullptr, std::memory_order_release);
+                });
+            }
+            return data;
+        }
+
         [[nodiscard]] unique_ptr<ElementModP::Impl> clone() const
         {
-            return make_unique<ElementModP::Impl>(data, true, isFixedBase);
+            auto result = make_unique<ElementModP::Impl>(values(), true, isFixedBase);
+            result->cache.isCacheable = cache.isCacheable;
+            result->cache.isSecret = cache.isSecret;
+            return result;
+        }
+
+        [[nodiscard]] bool shouldCache() const
+        {
+            return (cache.isCacheable || isFixedBase) && !cache.isSecret;
         }
 
         bool operator==(const Impl &other)
         {
             for (uint8_t i = 0; i < MAX_P_LEN; i++) {
-                auto l = data[i];
-                auto r = other.data[i];
+                auto l = values()[i];
+                auto r = other.values()[i];
                 if (l != r) {
                     return false;
                 }
@@ -159,9 +277,8 @@ namespace electionguard
 
         bool operator<(const Impl &other)
         {
-            auto other_ = other;
-            return Bignum4096::lessThan(static_cast<uint64_t *>(data),
-                                        static_cast<uint64_t *>(other_.data)) > 0;
+            return Bignum4096::lessThan(const_cast<uint64_t *>(values()),
+                                        const_cast<uint64_t *>(other.values())) > 0;
         }
     };
 
@@ -183,6 +300,8 @@ namespace electionguard
     {
     }
 
+    ElementModP::ElementModP(Impl *impl) : pimpl(impl) {}
+
     ElementModP::~ElementModP() = default;
 
     // Operator Overloads
@@ -207,14 +326,35 @@ namespace electionguard
 
     // Property Getters
 
-    uint64_t *ElementModP::get() const { return static_cast<uint64_t *>(pimpl->data); }
+    uint64_t *ElementModP::get() const
+    {
+        pimpl->cache.clear();
+        return static_cast<uint64_t *>(pimpl->mutableValues());
+    }
+
+    uint64_t (&ElementModP::ref() const)[MAX_P_LEN]
+    {
+        pimpl->cache.clear();
+        return pimpl->mutableValues();
+    }
 
-    uint64_t (&ElementModP::ref() const)[MAX_P_LEN] { return pimpl->data; }
+    const uint64_t *ElementModP::cget() const
+    {
+        return static_cast<const uint64_t *>(pimpl->values());
+    }
+
+    const uint64_t (&ElementModP::cref() const)[MAX_P_LEN] { return pimpl->values(); }
+
+    bool ElementModP::isBorrowed() const { return pimpl->borrowed != nullptr; }
 
     uint64_t ElementModP::length() const { return MAX_P_LEN; }
 
     bool ElementModP::isFixedBase() const { return pimpl->isFixedBase; }
 
+    bool ElementModP::isCacheable() const { return pimpl->shouldCache(); }
+
+    bool ElementModP::isSecret() const { return pimpl->cache.isSecret; }
+
     bool ElementModP::isInBounds() const
     {
         return (const_cast<ElementModP &>(ZERO_MOD_P()) < *this) &&
@@ -228,45 +368,72 @@ namespace electionguard
 
     vector<uint8_t> ElementModP::toBytes() const
     {
+        if (auto cached = pimpl->cache.getBytes()) {
+            return *cached;
+        }
+
         uint8_t byteResult[MAX_P_SIZE] = {};
         // Use Hacl to convert the bignum to byte array
-        Bignum4096::toBytes(static_cast<uint64_t *>(pimpl->data),
+        Bignum4096::toBytes(const_cast<uint64_t *>(cget()),
                             static_cast<uint8_t *>(byteResult));
-        return vector<uint8_t>(begin(byteResult), end(byteResult));
+        vector<uint8_t> result(begin(byteResult), end(byteResult));
+        if (pimpl->shouldCache()) {
+            pimpl->cache.setBytes(result);
+        }
+        return result;
     }
 
     string ElementModP::toHex() const
     {
-        if (!pimpl->hexRepresentation.empty()) {
-            return pimpl->hexRepresentation;
+        if (auto cached = pimpl->cache.getHex()) {
+            return *cached;
         }
 
-        // Returned bytes array from Hacl needs to be pre-allocated to 512 bytes
-        uint8_t byteResult[MAX_P_SIZE] = {};
-        // Use Hacl to convert the bignum to byte array
-        Bignum4096::toBytes(static_cast<uint64_t *>(pimpl->data),
-                            static_cast<uint8_t *>(byteResult));
-        pimpl->hexRepresentation = bytes_to_hex(byteResult);
-        return pimpl->hexRepresentation;
+        char hex[MAX_P_SIZE * 2];
+        auto length = limbs_to_hex(const_cast<uint64_t *>(cget()), MAX_P_LEN,
+                                   static_cast<char *>(hex));
+        string result(static_cast<char *>(hex), length);
+        if (pimpl->shouldCache()) {
+            pimpl->cache.setHex(result);
+        }
+        return result;
     }
 
     std::unique_ptr<ElementModP> ElementModP::clone() const
     {
-        return make_unique<ElementModP>(pimpl->data, true, pimpl->isFixedBase);
+        auto result = make_unique<ElementModP>(cref(), true, pimpl->isFixedBase);
+        result->setIsCacheable(pimpl->cache.isCacheable);
+        result->setIsSecret(pimpl->cache.isSecret);
+        return result;
     }
 
     void ElementModP::setIsFixedBase(bool fixedBase) const { pimpl->isFixedBase = fixedBase; }
 
+    void ElementModP::setIsCacheable(bool cacheable) const
+    {
+        pimpl->cache.isCacheable = cacheable;
+        if (!pimpl->shouldCache()) {
+            pimpl->cache.clear();
+        }
+    }
+
+    void ElementModP::setIsSecret(bool secret) const
+    {
+        pimpl->cache.isSecret = secret;
+        if (secret) {
+            pimpl->cache.clear();
+        }
+    }
+
     // Static Methods
 
     unique_ptr<ElementModP> ElementModP::fromHex(const string &representation,
                                                  bool unchecked /* = false */)
     {
-        auto sanitized = sanitize_hex_string(representation);
-        auto bytes = hex_to_bytes(sanitized);
-        auto element = bytes_to_p(bytes, unchecked);
-        release(bytes);
-        return element;
+        uint64_t element[MAX_P_LEN] = {};
+        hex_to_limbs(representation.data(), representation.size(),
+                     static_cast<uint64_t *>(element), MAX_P_LEN);
+        return make_unique<ElementModP>(element, unchecked);
     }
 
     unique_ptr<ElementModP> ElementModP::fromUint64(uint64_t representation,
@@ -277,6 +444,11 @@ namespace electionguard
         return bytes_to_p(reinterpret_cast<uint8_t *>(&bigEndian), bitWidth, unchecked);
     }
 
+    unique_ptr<ElementModP> ElementModP::borrow(const uint64_t *limbs, bool unchecked /* = false */)
+    {
+        return unique_ptr<ElementModP>(new ElementModP(new Impl(BorrowedLimbs{limbs}, unchecked)));
+    }
+
 #pragma endregion
 
 #pragma region ElementModQ
@@ -284,39 +456,82 @@ namespace electionguard
     struct ElementModQ::Impl {
 
         uint64_t data[MAX_Q_LEN] = {};
+        // a borrowed element reads the caller's limbs in place
+        // until it is first mutated, when they are copied into the element.
+        // the copy is published through the pointer, since threads may still be
+        // reading a shared borrowed element while one of them asks for mutable access
+        std::atomic<const uint64_t *> borrowed{nullptr};
+        std::once_flag materialized;
+        RepresentationCache cache;
 
         Impl(const vector<uint64_t> &elem, bool unchecked)
         {
             uint64_t array[MAX_Q_LEN] = {};
             copy(elem.begin(), elem.end(), static_cast<uint64_t *>(array));
-            if (!unchecked && Bignum256::lessThan(const_cast<uint64_t *>(Q().get()),
+            if (!unchecked && Bignum256::lessThan(const_cast<uint64_t *>(Q().cget()),
                                                   static_cast<uint64_t *>(array)) > 0) {
                 throw out_of_range("Value for ElementModQ is greater than allowed");
             }
             copy(begin(array), end(array), begin(data));
+            Metrics::increment(Metric::elementAllocations);
         };
 
         Impl(const uint64_t (&elem)[MAX_Q_LEN], bool unchecked)
         {
-            if (!unchecked && Bignum256::lessThan(const_cast<uint64_t *>(Q().get()),
+            if (!unchecked && Bignum256::lessThan(const_cast<uint64_t *>(Q().cget()),
                                                   const_cast<uint64_t *>(elem)) > 0) {
                 throw out_of_range("Value for ElementModQ is greater than allowed");
             }
             copy(begin(elem), end(elem), begin(data));
+            Metrics::increment(Metric::elementAllocations);
+        };
+
+        Impl(BorrowedLimbs elem, bool unchecked) : borrowed{elem.limbs}
+        {
+            if (!unchecked && Bignum256::lessThan(const_cast<uint64_t *>(Q().cget()),
+                                                  const_cast<uint64_t *>(elem.limbs)) > 0) {
+                throw out_of_range("Value for ElementModQ is greater than allowed");
+            }
+            Metrics::increment(Metric::elementAllocations);
         };
 
         ~Impl() { hacl::Lib::memZero(static_cast<uint64_t *>(data), MAX_Q_LEN); };
 
+        [[nodiscard]] const uint64_t (&values() const)[MAX_Q_LEN]
+        {
+            if (const auto *limbs = borrowed.load(std::memory_order_acquire)) {
+                return *reinterpret_cast<const uint64_t(*)[MAX_Q_LEN]>(limbs);
+            }
+            return data;
+        }
+
+        uint64_t (&mutableValues())[MAX_Q_LEN]
+        {
+            if (borrowed.load(std::memory_order_acquire) != nullptr) {
+                std::call_once(materialized, [this] {
+                    const auto *limbs = borrowed.load(std::memory_order_relaxed);
+                    copy(limbs, limbs + MAX_Q_LEN, begin(data));
+                    borrowed.store(nullptr, std::memory_order_release);
+                });
+            }
+            return data;
+        }
+
         [[nodiscard]] unique_ptr<ElementModQ::Impl> clone() const
         {
-            return make_unique<ElementModQ::Impl>(data, true);
+            auto result = make_unique<ElementModQ::Impl>(values(), true);
+            result->cache.isCacheable = cache.isCacheable;
+            result->cache.isSecret = cache.isSecret;
+            return result;
         }
 
+        [[nodiscard]] bool shouldCache() const { return cache.isCacheable && !cache.isSecret; }
+
         bool operator==(const Impl &other)
         {
             for (uint8_t i = 0; i < MAX_Q_LEN; i++) {
-                auto l = data[i];
-                auto r = other.data[i];
+                auto l = values()[i];
+                auto r = other.values()[i];
                 if (l != r) {
                     return false;
                 }
@@ -326,9 +541,8 @@ namespace electionguard
 
         bool operator<(const Impl &other)
         {
-            auto other_ = other;
-            return Bignum256::lessThan(static_cast<uint64_t *>(data),
-                                       static_cast<uint64_t *>(other_.data)) > 0;
+            return Bignum256::lessThan(const_cast<uint64_t *>(values()),
+                                       const_cast<uint64_t *>(other.values())) > 0;
         }
     };
 
@@ -347,6 +561,9 @@ namespace electionguard
         : pimpl(new Impl(elem, unchecked))
     {
     }
+
+    ElementModQ::ElementModQ(Impl *impl) : pimpl(impl) {}
+
     ElementModQ::~ElementModQ() = default;
 
     // Operator Overloads
@@ -371,9 +588,26 @@ namespace electionguard
 
     // Property Getters
 
-    uint64_t *ElementModQ::get() const { return static_cast<uint64_t *>(pimpl->data); }
+    uint64_t *ElementModQ::get() const
+    {
+        pimpl->cache.clear();
+        return static_cast<uint64_t *>(pimpl->mutableValues());
+    }
 
-    uint64_t (&ElementModQ::ref() const)[MAX_Q_LEN] { return pimpl->data; }
+    uint64_t (&ElementModQ::ref() const)[MAX_Q_LEN]
+    {
+        pimpl->cache.clear();
+        return pimpl->mutableValues();
+    }
+
+    const uint64_t *ElementModQ::cget() const
+    {
+        return static_cast<const uint64_t *>(pimpl->values());
+    }
+
+    const uint64_t (&ElementModQ::cref() const)[MAX_Q_LEN] { return pimpl->values(); }
+
+    bool ElementModQ::isBorrowed() const { return pimpl->borrowed != nullptr; }
 
     uint64_t ElementModQ::length() const { return MAX_Q_LEN; }
 
@@ -383,23 +617,57 @@ namespace electionguard
                (const_cast<ElementModQ &>(*this) < Q());
     }
 
+    bool ElementModQ::isCacheable() const { return pimpl->shouldCache(); }
+
+    bool ElementModQ::isSecret() const { return pimpl->cache.isSecret; }
+
     vector<uint8_t> ElementModQ::toBytes() const
     {
+        if (auto cached = pimpl->cache.getBytes()) {
+            return *cached;
+        }
+
         uint8_t byteResult[MAX_Q_SIZE] = {};
         // Use Hacl to convert the bignum to byte array
-        Bignum256::toBytes(static_cast<uint64_t *>(pimpl->data),
+        Bignum256::toBytes(const_cast<uint64_t *>(cget()),
                            static_cast<uint8_t *>(byteResult));
-        return vector<uint8_t>(begin(byteResult), end(byteResult));
+        vector<uint8_t> result(begin(byteResult), end(byteResult));
+        if (pimpl->shouldCache()) {
+            pimpl->cache.setBytes(result);
+        }
+        return result;
     }
 
     string ElementModQ::toHex() const
     {
-        // Returned bytes array from Hacl needs to be pre-allocated to 32 bytes
-        uint8_t byteResult[MAX_Q_SIZE] = {};
-        // Use Hacl to convert the bignum to byte array
-        Bignum256::toBytes(static_cast<uint64_t *>(pimpl->data),
-                           static_cast<uint8_t *>(byteResult));
-        return bytes_to_hex(byteResult);
+        if (auto cached = pimpl->cache.getHex()) {
+            return *cached;
+        }
+
+        char hex[MAX_Q_SIZE * 2];
+        auto length = limbs_to_hex(const_cast<uint64_t *>(cget()), MAX_Q_LEN,
+                                   static_cast<char *>(hex));
+        string result(static_cast<char *>(hex), length);
+        if (pimpl->shouldCache()) {
+            pimpl->cache.setHex(result);
+        }
+        return result;
+    }
+
+    void ElementModQ::setIsCacheable(bool cacheable) const
+    {
+        pimpl->cache.isCacheable = cacheable;
+        if (!pimpl->shouldCache()) {
+            pimpl->cache.clear();
+        }
+    }
+
+    void ElementModQ::setIsSecret(bool secret) const
+    {
+        pimpl->cache.isSecret = secret;
+        if (secret) {
+            pimpl->cache.clear();
+        }
     }
 
     // Static Methods
@@ -407,11 +675,10 @@ namespace electionguard
     unique_ptr<ElementModQ> ElementModQ::fromHex(const string &representation,
                                                  bool unchecked /* = false */)
     {
-        auto sanitized = sanitize_hex_string(representation);
-        auto bytes = hex_to_bytes(sanitized);
-        auto element = bytes_to_q(bytes, unchecked);
-        release(bytes);
-        return element;
+        uint64_t element[MAX_Q_LEN] = {};
+        hex_to_limbs(representation.data(), representation.size(),
+                     static_cast<uint64_t *>(element), MAX_Q_LEN);
+        return make_unique<ElementModQ>(element, unchecked);
     }
 
     unique_ptr<ElementModQ> ElementModQ::fromUint64(uint64_t representation,
@@ -422,18 +689,26 @@ namespace electionguard
         return bytes_to_q(reinterpret_cast<uint8_t *>(&bigEndian), bitWidth, unchecked);
     }
 
+    unique_ptr<ElementModQ> ElementModQ::borrow(const uint64_t *limbs, bool unchecked /* = false */)
+    {
+        return unique_ptr<ElementModQ>(new ElementModQ(new Impl(BorrowedLimbs{limbs}, unchecked)));
+    }
+
     // Public Methods
 
     unique_ptr<ElementModP> ElementModQ::toElementModP() const
     {
         uint64_t p4096[MAX_P_LEN] = {};
-        memcpy(static_cast<uint64_t *>(p4096), static_cast<uint64_t *>(pimpl->data), MAX_Q_SIZE);
+        memcpy(static_cast<uint64_t *>(p4096), cget(), MAX_Q_SIZE);
         return make_unique<ElementModP>(p4096, true);
     }
 
     std::unique_ptr<ElementModQ> ElementModQ::clone() const
     {
-        return make_unique<ElementModQ>(pimpl->data);
+        auto result = make_unique<ElementModQ>(cref());
+        result->setIsCacheable(pimpl->cache.isCacheable);
+        result->setIsSecret(pimpl->cache.isSecret);
+        return result;
     }
 
 #pragma endregion
@@ -539,8 +814,8 @@ namespace electionguard
         const auto &p = P();
         uint64_t addResult[MAX_P_LEN_DOUBLE] = {};
         uint64_t carry =
-          Bignum4096::add(const_cast<ElementModP &>(lhs).get(),
-                          const_cast<ElementModP &>(rhs).get(), static_cast<uint64_t *>(addResult));
+          Bignum4096::add(const_cast<uint64_t *>(lhs.cget()),
+                          const_cast<uint64_t *>(rhs.cget()), static_cast<uint64_t *>(addResult));
 
         // handle the specific case where the the sum == MAX_4096
         // but the carry value is not set.  We still need to offset.
@@ -590,7 +865,7 @@ namespace electionguard
     std::unique_ptr<ElementModP> mod_p(const ElementModP &element)
     {
         uint64_t modResult[MAX_P_LEN] = {};
-        CONTEXT_P().mod(element.get(), static_cast<uint64_t *>(modResult));
+        CONTEXT_P().mod(const_cast<uint64_t *>(element.cget()), static_cast<uint64_t *>(modResult));
         return make_unique<ElementModP>(modResult, true);
     }
 
@@ -598,7 +873,7 @@ namespace electionguard
     {
         const auto &p = P();
         uint64_t mulResult[MAX_P_LEN_DOUBLE] = {};
-        Bignum4096::mul(const_cast<ElementModP &>(lhs).get(), const_cast<ElementModP &>(rhs).get(),
+        Bignum4096::mul(const_cast<uint64_t *>(lhs.cget()), const_cast<uint64_t *>(rhs.cget()),
                         static_cast<uint64_t *>(mulResult));
         uint64_t modResult[MAX_P_LEN] = {};
         CONTEXT_P().mod(static_cast<uint64_t *>(mulResult), static_cast<uint64_t *>(modResult));
@@ -629,24 +904,123 @@ namespace electionguard
     {
         const auto &p = P();
         uint64_t divisor[MAX_P_LEN] = {};
-        Bignum4096::modInvPrime(p.get(), const_cast<ElementModP &>(denominator).get(),
+        Bignum4096::modInvPrime(const_cast<uint64_t *>(p.cget()),
+                                const_cast<uint64_t *>(denominator.cget()),
                                 static_cast<uint64_t *>(divisor));
         auto inverse = make_unique<ElementModP>(divisor, true);
         return mul_mod_p(numerator, *inverse);
     }
 
+    // lhs * rhs mod p over raw limbs
+    static void mul_mod_p(const uint64_t *lhs, const uint64_t *rhs, uint64_t *result)
+    {
+        uint64_t mulResult[MAX_P_LEN_DOUBLE] = {};
+        Bignum4096::mul(const_cast<uint64_t *>(lhs), const_cast<uint64_t *>(rhs),
+                        static_cast<uint64_t *>(mulResult));
+        CONTEXT_P().mod(static_cast<uint64_t *>(mulResult), result);
+    }
+
+    void div_mod_p_batch(const uint64_t *numerators, const uint64_t *denominators, size_t count,
+                         uint64_t *results)
+    {
+        if (count == 0) {
+            return;
+        }
+
+        // Montgomery's trick: invert the product of every denominator once,
+        // then peel each inverse off of the running products
+        vector<uint64_t> products(count * MAX_P_LEN);
+        for (size_t i = 0; i < count; i++) {
+            const auto *denominator = denominators + i * MAX_P_LEN;
+            if (all_of(denominator, denominator + MAX_P_LEN, [](uint64_t x) { return x == 0; })) {
+                throw invalid_argument("div_mod_p_batch requires non-zero denominators");
+            }
+            if (i == 0) {
+                copy(denominator, denominator + MAX_P_LEN, products.data());
+            } else {
+                mul_mod_p(products.data() + (i - 1) * MAX_P_LEN, denominator,
+                          products.data() + i * MAX_P_LEN);
+            }
+        }
+
+        uint64_t inverse[MAX_P_LEN] = {};
+        if (!Bignum4096::modInvPrime(const_cast<uint64_t *>(P().cget()),
+                                     products.data() + (count - 1) * MAX_P_LEN,
+                                     static_cast<uint64_t *>(inverse))) {
+            throw runtime_error("div_mod_p_batch could not invert the denominators");
+        }
+
+        uint64_t denominatorInverse[MAX_P_LEN] = {};
+        uint64_t next[MAX_P_LEN] = {};
+        for (auto i = count; i-- > 0;) {
+            if (i > 0) {
+                // 1/d_i = 1/(d_0...d_i) * (d_0...d_i-1)
+                mul_mod_p(static_cast<uint64_t *>(inverse), products.data() + (i - 1) * MAX_P_LEN,
+                          static_cast<uint64_t *>(denominatorInverse));
+                // 1/(d_0...d_i-1) = 1/(d_0...d_i) * d_i
+                mul_mod_p(static_cast<uint64_t *>(inverse), denominators + i * MAX_P_LEN,
+                          static_cast<uint64_t *>(next));
+                copy(next, next + MAX_P_LEN, inverse);
+            } else {
+                copy(inverse, inverse + MAX_P_LEN, denominatorInverse);
+            }
+            mul_mod_p(numerators + i * MAX_P_LEN, static_cast<uint64_t *>(denominatorInverse),
+                      results + i * MAX_P_LEN);
+        }
+    }
+
     unique_ptr<ElementModP> pow_mod_p(const ElementModP &base, const ElementModP &exponent)
     {
         // HACL's input constraints require the exponent to be greater than zero
         if (const_cast<ElementModP &>(exponent) == ZERO_MOD_P()) {
             return ElementModP::fromUint64(1UL);
         }
+        Metrics::increment(Metric::powModPFull);
         uint64_t result[MAX_P_LEN] = {};
-        CONTEXT_P().modExp(base.get(), MAX_P_SIZE, exponent.get(), static_cast<uint64_t *>(result));
+        CONTEXT_P().modExp(const_cast<uint64_t *>(base.cget()), MAX_P_SIZE,
+                           const_cast<uint64_t *>(exponent.cget()),
+                           static_cast<uint64_t *>(result));
         return make_unique<ElementModP>(result, true);
     }
 
-    unique_ptr<ElementModP> pow_mod_p(const ElementModP &base, const ElementModQ &exponent)
+    // the key of the lookup table of a base flagged as a fixed base or registered as one
+    static bool fixedBaseKey(const ElementModP &base, string &key)
+    {
+        if (base.isFixedBase()) {
+            key = base.toHex();
+            return true;
+        }
+        return LookupTableContext::findFixedBase(base.cref(), key);
+    }
+
+    void register_fixed_base(const ElementModP &base)
+    {
+        LookupTableContext::registerFixedBase(base.cref(), base.toHex());
+    }
+
+    bool is_fixed_base(const ElementModP &base)
+    {
+        string key;
+        return fixedBaseKey(base, key);
+    }
+
+    void set_constant_time_fixed_base(bool enabled)
+    {
+        LookupTableContext::setConstantTime(enabled);
+    }
+
+    bool is_constant_time_fixed_base() { return LookupTableContext::getConstantTime(); }
+
+    static bool isConstantTime(FixedBaseTiming timing)
+    {
+        if (timing == FixedBaseTiming::configured) {
+            return LookupTableContext::getConstantTime();
+        }
+        return timing == FixedBaseTiming::constantTime;
+    }
+
+    unique_ptr<ElementModP> pow_mod_p(const ElementModP &base, const ElementModQ &exponent,
+                                      FixedBaseTiming timing)
     {
         // HACL's input constraints require the exponent to be greater than zero
         if (const_cast<ElementModQ &>(exponent) == ZERO_MOD_Q()) {
@@ -654,11 +1028,13 @@ namespace electionguard
         }
 
         // check if we have a lookup table initialized for this element
-        if (base.isFixedBase()) {
+        string hex;
+        if (fixedBaseKey(base, hex)) {
             // TODO: use a smaller key
-            auto hex = base.toHex();
-            auto exp_ptr = exponent.get();
-            auto result = LookupTableContext::pow_mod_p(hex, base.ref(), exponent.ref());
+            Metrics::increment(Metric::powModPTable);
+            auto result = LookupTableContext::pow_mod_p(
+              hex, const_cast<uint64_t(&)[MAX_P_LEN]>(base.cref()),
+              const_cast<uint64_t(&)[MAX_Q_LEN]>(exponent.cref()), isConstantTime(timing));
             return make_unique<ElementModP>(result, true);
         }
         // if none exists, execute the modular exponentiation directly
@@ -671,14 +1047,209 @@ namespace electionguard
         return pow_mod_p(base, *exp);
     }
 
+    void pow_mod_p_batch(const ElementModP &base,
+                         const vector<reference_wrapper<const ElementModQ>> &exponents,
+                         uint64_t *results, FixedBaseTiming timing)
+    {
+        string hex;
+        if (fixedBaseKey(base, hex)) {
+            Metrics::increment(Metric::powModPTable, exponents.size());
+            vector<const uint64_t *> limbs;
+            limbs.reserve(exponents.size());
+            for (const auto &exponent : exponents) {
+                limbs.push_back(exponent.get().cget());
+            }
+            LookupTableContext::pow_mod_p_batch(hex,
+                                                const_cast<uint64_t(&)[MAX_P_LEN]>(base.cref()),
+                                                limbs.data(), limbs.size(), results,
+                                                isConstantTime(timing));
+            return;
+        }
+
+        for (size_t i = 0; i < exponents.size(); i++) {
+            auto result = pow_mod_p(base, exponents[i].get(), timing);
+            copy(result->cget(), result->cget() + MAX_P_LEN, results + i * MAX_P_LEN);
+        }
+    }
+
+    unique_ptr<ElementModP>
+    pow_mod_p_multi(const vector<reference_wrapper<const ElementModP>> &bases,
+                    const vector<reference_wrapper<const ElementModQ>> &exponents)
+    {
+        if (bases.size() != exponents.size()) {
+            throw invalid_argument("pow_mod_p_multi requires an exponent for each base");
+        }
+        if (bases.empty()) {
+            return ElementModP::fromUint64(1UL);
+        }
+
+        Metrics::increment(Metric::powModPFull, bases.size());
+        vector<const uint64_t *> baseLimbs;
+        vector<const uint64_t *> exponentLimbs;
+        baseLimbs.reserve(bases.size());
+        exponentLimbs.reserve(exponents.size());
+        for (size_t i = 0; i < bases.size(); i++) {
+            baseLimbs.push_back(bases[i].get().cget());
+            exponentLimbs.push_back(exponents[i].get().cget());
+        }
+        uint64_t result[MAX_P_LEN] = {};
+        CONTEXT_P().modExpMulti(baseLimbs.data(), exponentLimbs.data(), bases.size(),
+                                MAX_Q_LEN * 64, static_cast<uint64_t *>(result));
+        return make_unique<ElementModP>(result, true);
+    }
+
+    // the number of random weights drawn for each call to the random source
+    constexpr size_t RESIDUE_WEIGHTS_PER_DRAW = SHA512 / sizeof(uint64_t);
+
+    // the number of limbs of the value, ignoring the leading zero limbs
+    static size_t limbLength(const uint64_t *value, size_t length)
+    {
+        while (length > 0 && value[length - 1] == 0) {
+            length--;
+        }
+        return length;
+    }
+
+    // shift the value right by the number of bits
+    static void shiftRight(uint64_t *value, size_t &length, uint64_t bits)
+    {
+        auto limbs = static_cast<size_t>(bits / 64);
+        auto shift = bits % 64;
+        for (size_t i = 0; i + limbs < length; i++) {
+            auto low = value[i + limbs] >> shift;
+            auto high =
+              (shift != 0 && i + limbs + 1 < length) ? value[i + limbs + 1] << (64 - shift) : 0;
+            value[i] = low | high;
+        }
+        for (auto i = length - limbs; i < length; i++) {
+            value[i] = 0;
+        }
+        length = limbLength(value, length - limbs);
+    }
+
+    static bool isLessThan(const uint64_t *x, size_t xLength, const uint64_t *y, size_t yLength)
+    {
+        if (xLength != yLength) {
+            return xLength < yLength;
+        }
+        for (auto i = xLength; i-- > 0;) {
+            if (x[i] != y[i]) {
+                return x[i] < y[i];
+            }
+        }
+        return false;
+    }
+
+    // the jacobi symbol (a/n) of a and an odd n using the binary algorithm.
+    // it runs in quadratic time in the number of bits, far less than an exponentiation.
+    static int jacobi(const uint64_t *a, const uint64_t *n)
+    {
+        uint64_t bufferA[MAX_P_LEN];
+        uint64_t bufferN[MAX_P_LEN];
+        copy(a, a + MAX_P_LEN, bufferA);
+        copy(n, n + MAX_P_LEN, bufferN);
+        uint64_t *x = bufferA;
+        uint64_t *y = bufferN;
+        auto xLength = limbLength(x, MAX_P_LEN);
+        auto yLength = limbLength(y, MAX_P_LEN);
+
+        int result = 1;
+        while (xLength > 0) {
+            // (2/y) = -1 when y = 3 or 5 mod 8
+            uint64_t zeros = 0;
+            while (((x[zeros / 64] >> (zeros % 64)) & 1) == 0) {
+                zeros++;
+            }
+            shiftRight(x, xLength, zeros);
+            if ((zeros & 1) == 1 && ((y[0] & 7) == 3 || (y[0] & 7) == 5)) {
+                result = -result;
+            }
+
+            // (x/y) = -(y/x) when both are 3 mod 4
+            if (isLessThan(x, xLength, y, yLength)) {
+                std::swap(x, y);
+                std::swap(xLength, yLength);
+                if ((x[0] & 3) == 3 && (y[0] & 3) == 3) {
+                    result = -result;
+                }
+            }
+
+            // (x/y) = ((x - y)/y)
+            uint64_t borrow = 0;
+            for (size_t i = 0; i < xLength; i++) {
+                auto subtrahend = i < yLength ? y[i] : 0;
+                auto difference = x[i] - subtrahend - borrow;
+                borrow = (x[i] < subtrahend || (x[i] == subtrahend && borrow == 1)) ? 1 : 0;
+                x[i] = difference;
+            }
+            xLength = limbLength(x, xLength);
+        }
+        return (yLength == 1 && y[0] == 1) ? result : 0;
+    }
+
+    vector<bool>
+    is_valid_residue_batch(const vector<reference_wrapper<const ElementModP>> &elements)
+    {
+        vector<bool> results(elements.size(), true);
+
+        // the bounds and the order two component are checked for each element
+        vector<size_t> candidates;
+        candidates.reserve(elements.size());
+        for (size_t i = 0; i < elements.size(); i++) {
+            const auto &element = elements[i].get();
+            if (!element.isInBounds() || jacobi(element.cget(), P().cget()) != 1) {
+                results[i] = false;
+            } else {
+                candidates.push_back(i);
+            }
+        }
+        if (candidates.empty()) {
+            return results;
+        }
+
+        // (∏ x_i^w_i)^q mod p with odd random weights, so no element drops out of the product
+        vector<uint64_t> weights;
+        weights.reserve(candidates.size());
+        while (weights.size() < candidates.size()) {
+            auto bytes = Random::getBytes(SHA512);
+            for (size_t i = 0; i < RESIDUE_WEIGHTS_PER_DRAW && weights.size() < candidates.size();
+                 i++) {
+                uint64_t weight = 0;
+                memcpy(&weight, bytes.data() + i * sizeof(uint64_t), sizeof(uint64_t));
+                weights.push_back(weight | 1);
+            }
+        }
+        vector<const uint64_t *> bases;
+        vector<const uint64_t *> exponents;
+        bases.reserve(candidates.size());
+        exponents.reserve(candidates.size());
+        for (size_t i = 0; i < candidates.size(); i++) {
+            bases.push_back(elements[candidates[i]].get().cget());
+            exponents.push_back(&weights[i]);
+        }
+        uint64_t product[MAX_P_LEN] = {};
+        CONTEXT_P().modExpMulti(bases.data(), exponents.data(), bases.size(), 64,
+                                static_cast<uint64_t *>(product));
+        auto productElement = make_unique<ElementModP>(product, true);
+        if (*pow_mod_p(*productElement, Q()) == const_cast<ElementModP &>(ONE_MOD_P())) {
+            return results;
+        }
+
+        // fall back to checking every element on its own to find the invalid ones
+        for (auto i : candidates) {
+            results[i] = elements[i].get().isValidResidue();
+        }
+        return results;
+    }
+
     unique_ptr<ElementModP> g_pow_p(const ElementModP &exponent)
     {
         return pow_mod_p(G(), exponent);
     }
 
-    unique_ptr<ElementModP> g_pow_p(const ElementModQ &exponent)
+    unique_ptr<ElementModP> g_pow_p(const ElementModQ &exponent, FixedBaseTiming timing)
     {
-        return pow_mod_p(G(), exponent);
+        return pow_mod_p(G(), exponent, timing);
     }
 
 #pragma endregion
@@ -690,7 +1261,7 @@ namespace electionguard
         const auto &q = Q();
         uint64_t addResult[MAX_Q_LEN_DOUBLE] = {};
         uint64_t carry =
-          Bignum256::add(const_cast<ElementModQ &>(lhs).get(), const_cast<ElementModQ &>(rhs).get(),
+          Bignum256::add(const_cast<uint64_t *>(lhs.cget()), const_cast<uint64_t *>(rhs.cget()),
                          static_cast<uint64_t *>(addResult));
 
         // handle the specific case where the the sum == MAX_256
@@ -758,7 +1329,7 @@ namespace electionguard
         const auto &q = Q();
         uint64_t subResult[MAX_Q_LEN_DOUBLE] = {};
         uint64_t carry =
-          Bignum256::sub(const_cast<ElementModQ &>(a).get(), const_cast<ElementModQ &>(b).get(),
+          Bignum256::sub(const_cast<uint64_t *>(a.cget()), const_cast<uint64_t *>(b.cget()),
                          static_cast<uint64_t *>(subResult));
 
         if (carry > 0) {
@@ -802,7 +1373,7 @@ namespace electionguard
     {
         const auto &p = Q();
         uint64_t mulResult[MAX_Q_LEN_DOUBLE] = {};
-        Bignum256::mul(const_cast<ElementModQ &>(lhs).get(), const_cast<ElementModQ &>(rhs).get(),
+        Bignum256::mul(const_cast<uint64_t *>(lhs.cget()), const_cast<uint64_t *>(rhs.cget()),
                        static_cast<uint64_t *>(mulResult));
         uint64_t modResult[MAX_Q_LEN] = {};
         CONTEXT_Q().mod(static_cast<uint64_t *>(mulResult), static_cast<uint64_t *>(modResult));
@@ -825,7 +1396,8 @@ namespace electionguard
     {
         const auto &q = Q();
         uint64_t result[MAX_Q_LEN] = {};
-        Bignum256::modInvPrime(q.get(), const_cast<ElementModQ &>(denominator).get(),
+        Bignum256::modInvPrime(const_cast<uint64_t *>(q.cget()),
+                               const_cast<uint64_t *>(denominator.cget()),
                                static_cast<uint64_t *>(result));
         auto inverse = make_unique<ElementModQ>(result, true);
         return mul_mod_q(numerator, *inverse);
@@ -839,15 +1411,18 @@ namespace electionguard
             return ElementModQ::fromUint64(1UL);
         }
 
+        Metrics::increment(Metric::powModQ);
         uint64_t result[MAX_Q_LEN] = {};
-        CONTEXT_Q().modExp(base.get(), MAX_Q_SIZE, exponent.get(), static_cast<uint64_t *>(result));
+        CONTEXT_Q().modExp(const_cast<uint64_t *>(base.cget()), MAX_Q_SIZE,
+                           const_cast<uint64_t *>(exponent.cget()),
+                           static_cast<uint64_t *>(result));
         return make_unique<ElementModQ>(result, true);
     }
 
     unique_ptr<ElementModQ> sub_from_q(const ElementModQ &a)
     {
         uint64_t result[MAX_Q_LEN] = {};
-        Bignum256::sub(const_cast<ElementModQ &>(Q()).get(), const_cast<ElementModQ &>(a).get(),
+        Bignum256::sub(const_cast<uint64_t *>(Q().cget()), const_cast<uint64_t *>(a.cget()),
                        static_cast<uint64_t *>(result));
         // TODO: python version doesn't perform % Q on results,
         // but we still need to handle the overflow values between (Q, MAX_256]
@@ -859,23 +1434,23 @@ namespace electionguard
     {
         // multiply b * c and the result will be twice Q in size
         uint64_t bc[MAX_Q_LEN_DOUBLE] = {};
-        Bignum256::mul(const_cast<ElementModQ &>(b).get(), const_cast<ElementModQ &>(c).get(), bc);
+        Bignum256::mul(const_cast<uint64_t *>(b.cget()), const_cast<uint64_t *>(c.cget()), bc);
 
         // perform the mod operation on bc
         uint64_t bc_mod_q[MAX_Q_LEN] = {};
         const auto &q = Q();
-        bool modSuccess = Bignum256::mod(q.get(), bc, bc_mod_q);
+        bool modSuccess = Bignum256::mod(const_cast<uint64_t *>(q.cget()), bc, bc_mod_q);
         if (!modSuccess) {
             throw runtime_error("a_plus_bc_mod_q mod operation failed");
         }
 
         uint64_t a_plus_bc[MAX_Q_LEN_DOUBLE] = {};
-        uint64_t carry = Bignum256::add(const_cast<ElementModQ &>(a).get(), bc_mod_q, a_plus_bc);
+        uint64_t carry = Bignum256::add(const_cast<uint64_t *>(a.cget()), bc_mod_q, a_plus_bc);
         // put the carry in
         a_plus_bc[MAX_Q_LEN] = carry;
 
         uint64_t res[MAX_Q_LEN] = {};
-        modSuccess = Bignum256::mod(q.get(), a_plus_bc, res);
+        modSuccess = Bignum256::mod(const_cast<uint64_t *>(q.cget()), a_plus_bc, res);
         if (!modSuccess) {
             throw runtime_error("a_plus_bc_mod_q mod operation failed");
         }
@@ -924,6 +1499,7 @@ namespace electionguard
         free(bigNum);
 
         auto random_q = make_unique<ElementModQ>(element, true);
+        random_q->setIsSecret(true);
         return random_q;
     }
 
@@ -1,21 +1,18 @@
 #include "electionguard/hash.hpp"
 
-#include "../../libs/hacl/Hacl_Bignum256.hpp"
-#include "../../libs/hacl/Hacl_Streaming_SHA2.hpp"
+#include "convert.hpp"
+#include "electionguard/metrics.hpp"
 #include "log.hpp"
+#include "sha256.hpp"
 
 #include <cstring>
 #include <iomanip>
 #include <iostream>
 
-using hacl::Bignum256;
-using hacl::StreamingSHA2;
-using hacl::StreamingSHA2Mode;
 using std::get;
 using std::make_unique;
 using std::move;
 using std::nullptr_t;
-using std::out_of_range;
 using std::reference_wrapper;
 using std::string;
 using std::to_string;
@@ -25,10 +22,12 @@ using std::vector;
 namespace electionguard
 {
     string get_hash_string(CryptoHashableType a);
+    size_t get_element_hex(const CryptoHashableType &a, char *out);
     template <typename T> string hash_inner_vector(vector<T> inner_vector);
-    void push_hash_update(StreamingSHA2 *p, CryptoHashableType a);
-    unique_ptr<StreamingSHA2> hash_open();
-    unique_ptr<ElementModQ> hash_close(StreamingSHA2 *p);
+    void append_hash_input(string &input, const CryptoHashableType &a);
+    string get_hash_input(const vector<CryptoHashableType> &a);
+    void count_hash_input(const string &input);
+    unique_ptr<ElementModQ> digest_to_q(const uint8_t *digest);
 
     enum CryptoHashableTypeEnum {
         NULL_PTR = 0,
@@ -60,57 +59,94 @@ namespace electionguard
     const char delimiter_char = '|';
     const string null_string = "null";
 
-    uint8_t delimiter[1] = {delimiter_char};
-
     unique_ptr<ElementModQ> hash_elems(const vector<CryptoHashableType> &a)
     {
-        uint8_t output[MAX_Q_SIZE] = {};
-        unique_ptr<StreamingSHA2> p = hash_open();
-
-        if (a.empty()) {
-            push_hash_update(p.get(), nullptr);
-        } else {
-            for (const CryptoHashableType &item : a) {
-                push_hash_update(p.get(), item);
-            }
-        }
-        return hash_close(p.get());
+        auto input = get_hash_input(a);
+        count_hash_input(input);
+        uint8_t digest[Sha256::DIGEST_SIZE] = {};
+        Sha256::hash(reinterpret_cast<const uint8_t *>(input.data()), input.size(),
+                     static_cast<uint8_t *>(digest));
+        return digest_to_q(static_cast<uint8_t *>(digest));
     }
 
     unique_ptr<ElementModQ> hash_elems(CryptoHashableType a)
     {
-        unique_ptr<StreamingSHA2> p = hash_open();
-        push_hash_update(p.get(), a);
-        return hash_close(p.get());
+        string input(1, delimiter_char);
+        append_hash_input(input, a);
+        count_hash_input(input);
+        uint8_t digest[Sha256::DIGEST_SIZE] = {};
+        Sha256::hash(reinterpret_cast<const uint8_t *>(input.data()), input.size(),
+                     static_cast<uint8_t *>(digest));
+        return digest_to_q(static_cast<uint8_t *>(digest));
     }
 
-    unique_ptr<StreamingSHA2> hash_open()
+    vector<unique_ptr<ElementModQ>> hash_elems_batch(const vector<vector<CryptoHashableType>> &a)
     {
-        auto p = make_unique<StreamingSHA2>(StreamingSHA2Mode::SHA2_256);
-        p->update(static_cast<uint8_t *>(delimiter), sizeof(delimiter));
-        return move(p);
+        // without parallel lanes there is nothing to gain from holding every input at once
+        if (!Sha256::isBatchParallel()) {
+            vector<unique_ptr<ElementModQ>> result;
+            result.reserve(a.size());
+            for (const auto &elems : a) {
+                result.push_back(hash_elems(elems));
+            }
+            return result;
+        }
+
+        vector<string> inputs;
+        inputs.reserve(a.size());
+        for (const auto &elems : a) {
+            inputs.push_back(get_hash_input(elems));
+            count_hash_input(inputs.back());
+        }
+
+        vector<uint8_t> digests(inputs.size() * Sha256::DIGEST_SIZE);
+        Sha256::hashMany(inputs, digests.data());
+
+        vector<unique_ptr<ElementModQ>> result;
+        result.reserve(inputs.size());
+        for (size_t i = 0; i < inputs.size(); i++) {
+            result.push_back(digest_to_q(&digests[i * Sha256::DIGEST_SIZE]));
+        }
+        return result;
     }
 
-    unique_ptr<ElementModQ> hash_close(StreamingSHA2 *p)
+    /// <summary>
+    /// Build the delimited message that is hashed for the elements
+    /// </summary>
+    string get_hash_input(const vector<CryptoHashableType> &a)
     {
-        uint8_t output[MAX_Q_SIZE] = {};
-        p->finish(static_cast<uint8_t *>(output));
-
-        auto *bigNum = Bignum256::fromBytes(sizeof(output), static_cast<uint8_t *>(output));
-        if (bigNum == nullptr) {
-            throw out_of_range("bytes_to_p could not allocate");
+        string input(1, delimiter_char);
+        if (a.empty()) {
+            append_hash_input(input, nullptr);
+        } else {
+            for (const CryptoHashableType &item : a) {
+                append_hash_input(input, item);
+            }
         }
+        return input;
+    }
 
-        // The ElementModQ constructor expects the bignum
-        // to be a certain size, but there's no guarantee
-        // that constraint is satisfied by new_bn_from_bytes_be
-        // so copy it into a new element that is the correct size
-        // and free the allocated resources
+    void count_hash_input(const string &input)
+    {
+        Metrics::increment(Metric::hashInvocations);
+        Metrics::increment(Metric::hashBytes, input.size());
+    }
+
+    unique_ptr<ElementModQ> digest_to_q(const uint8_t *digest)
+    {
+        // read the big endian digest directly into little endian limbs
         uint64_t normalized[MAX_Q_LEN] = {};
-        memcpy(static_cast<uint64_t *>(normalized), bigNum, sizeof(output));
-        free(bigNum);
+        for (size_t i = 0; i < MAX_Q_LEN; i++) {
+            const auto *bytes = digest + (MAX_Q_LEN - 1 - i) * sizeof(uint64_t);
+            for (size_t j = 0; j < sizeof(uint64_t); j++) {
+                normalized[i] = (normalized[i] << 8) | bytes[j];
+            }
+        }
 
         auto element = make_unique<ElementModQ>(normalized, true);
+        if (*element < Q()) {
+            return element;
+        }
 
         // TODO: take the result mod Q - 1
         // to produce a result that is [0,q-1]
@@ -249,11 +285,50 @@ namespace electionguard
         return null_string;
     }
 
-    void push_hash_update(StreamingSHA2 *p, CryptoHashableType a)
+    /// <summary>
+    /// Encode an element on the stack unless it opted in to caching,
+    /// in which case zero is returned so the cached representation is hashed instead
+    /// </summary>
+    template <typename T> size_t get_uncached_hex(const T &element, size_t length, char *out)
+    {
+        return element.isCacheable() ? 0 : limbs_to_hex(element.cget(), length, out);
+    }
+
+    size_t get_element_hex(const CryptoHashableType &a, char *out)
     {
-        string input_string = get_hash_string(a);
-        const auto *input = reinterpret_cast<const uint8_t *>(input_string.c_str());
-        p->update(const_cast<uint8_t *>(input), input_string.size());
-        p->update(static_cast<uint8_t *>(delimiter), sizeof(delimiter));
+        switch (a.index()) {
+            case ELEMENTMODP_PTR:
+                return get_uncached_hex(*get<ElementModP *>(a), MAX_P_LEN, out);
+            case ELEMENTMODQ_PTR:
+                return get_uncached_hex(*get<ElementModQ *>(a), MAX_Q_LEN, out);
+            case ELEMENTMODP_REF:
+                return get_uncached_hex(get<reference_wrapper<ElementModP>>(a).get(), MAX_P_LEN,
+                                        out);
+            case ELEMENTMODQ_REF:
+                return get_uncached_hex(get<reference_wrapper<ElementModQ>>(a).get(), MAX_Q_LEN,
+                                        out);
+            case ELEMENTMODP_CONST_REF:
+                return get_uncached_hex(get<reference_wrapper<const ElementModP>>(a).get(),
+                                        MAX_P_LEN, out);
+            case ELEMENTMODQ_CONST_REF:
+                return get_uncached_hex(get<reference_wrapper<const ElementModQ>>(a).get(),
+                                        MAX_Q_LEN, out);
+            default:
+                return 0;
+        }
+    }
+
+    void append_hash_input(string &input, const CryptoHashableType &a)
+    {
+        // elements are the most common input, so encode them on the stack
+        // instead of allocating an intermediate string unless a cached one exists
+        char hex[MAX_P_SIZE * 2];
+        auto length = get_element_hex(a, static_cast<char *>(hex));
+        if (length > 0) {
+            input.append(static_cast<char *>(hex), length);
+        } else {
+            input.append(get_hash_string(a));
+        }
+        input.push_back(delimiter_char);
     }
 } // namespace electionguard
@@ -97,13 +97,7 @@ namespace electionguard
                 return _instance;
 
             auto console = spdlog::stdout_logger_mt("console");
-#if LOG_DEBUG
-            console->set_level(spdlog::level::debug);
-#elif LOG_TRACE
-            console->set_level(spdlog::level::trace);
-#else
-            console->set_level(spdlog::level::info);
-#endif
+            console->set_level(static_cast<spdlog::level::level_enum>(EG_LOG_ACTIVE_LEVEL));
             spdlog::set_default_logger(console);
             spdlog::set_pattern("[%H:%M:%S:%e %z] [p: %P] [t: %t] [%l] :: %v");
             _instance.logger = console;
@@ -111,6 +105,11 @@ namespace electionguard
         }
     };
 
+    bool Log::isEnabled(LogLevel level)
+    {
+        return Impl::instance().logger->should_log(static_cast<spdlog::level::level_enum>(level));
+    }
+
     void Log::trace(string msg, const char *caller) { Impl::instance().logger->trace(msg); }
     void Log::trace(string msg, DomainLoggableType obj, const char *caller)
     {
@@ -16,8 +16,38 @@ using std::string;
 using std::stringstream;
 using std::vector;
 
+#define EG_LOG_LEVEL_TRACE 0
+#define EG_LOG_LEVEL_DEBUG 1
+#define EG_LOG_LEVEL_INFO 2
+#define EG_LOG_LEVEL_WARN 3
+#define EG_LOG_LEVEL_ERROR 4
+#define EG_LOG_LEVEL_OFF 6
+
+// the lowest level that is compiled in, following the same build flags as the logger
+#ifndef EG_LOG_ACTIVE_LEVEL
+#    if defined(LOG_DEBUG)
+#        define EG_LOG_ACTIVE_LEVEL EG_LOG_LEVEL_DEBUG
+#    elif defined(LOG_TRACE)
+#        define EG_LOG_ACTIVE_LEVEL EG_LOG_LEVEL_TRACE
+#    else
+#        define EG_LOG_ACTIVE_LEVEL EG_LOG_LEVEL_INFO
+#    endif
+#endif
+
 namespace electionguard
 {
+    /// <summary>
+    /// The severity of a log message
+    /// </summary>
+    enum class LogLevel {
+        trace = EG_LOG_LEVEL_TRACE,
+        debug = EG_LOG_LEVEL_DEBUG,
+        info = EG_LOG_LEVEL_INFO,
+        warn = EG_LOG_LEVEL_WARN,
+        error = EG_LOG_LEVEL_ERROR,
+        off = EG_LOG_LEVEL_OFF
+    };
+
     using DomainLoggableType =
       std::variant<std::nullptr_t, uint32_t, uint64_t, std::string, ElementModP *, ElementModQ *,
                    std::reference_wrapper<ElementModP>, std::reference_wrapper<ElementModQ>,
@@ -30,6 +60,14 @@ namespace electionguard
         Log(Log const &) = delete;
         void operator=(Log const &) = delete;
 
+        /// <summary>
+        /// Check whether messages at the level are written by the logger.
+        ///
+        /// Prefer the EG_LOG_* macros, which check the level before evaluating
+        /// their arguments and are removed entirely below EG_LOG_ACTIVE_LEVEL.
+        /// </summary>
+        static bool isEnabled(LogLevel level);
+
         static void trace(string msg, const char *caller = __builtin_FUNCTION());
         static void trace(string msg, DomainLoggableType obj,
                           const char *caller = __builtin_FUNCTION());
@@ -59,4 +97,43 @@ namespace electionguard
 
 } // namespace electionguard
 
+#pragma region Lazy Logging
+
+// Log through a Log method only when the level is enabled,
+// so formatting the arguments costs nothing when it is not
+#define EG_LOG_AT(level, method, ...)                                                              \
+    do {                                                                                           \
+        if (::electionguard::Log::isEnabled(::electionguard::LogLevel::level)) {                   \
+            ::electionguard::Log::method(__VA_ARGS__);                                             \
+        }                                                                                          \
+    } while (false)
+
+#define EG_LOG_DISABLED(...) static_cast<void>(0)
+
+#if EG_LOG_ACTIVE_LEVEL <= EG_LOG_LEVEL_TRACE
+#    define EG_LOG_TRACE(...) EG_LOG_AT(trace, trace, __VA_ARGS__)
+#else
+#    define EG_LOG_TRACE(...) EG_LOG_DISABLED(__VA_ARGS__)
+#endif
+
+#if EG_LOG_ACTIVE_LEVEL <= EG_LOG_LEVEL_DEBUG
+#    define EG_LOG_DEBUG(...) EG_LOG_AT(debug, debug, __VA_ARGS__)
+#else
+#    define EG_LOG_DEBUG(...) EG_LOG_DISABLED(__VA_ARGS__)
+#endif
+
+#if EG_LOG_ACTIVE_LEVEL <= EG_LOG_LEVEL_INFO
+#    define EG_LOG_INFO(...) EG_LOG_AT(info, info, __VA_ARGS__)
+#else
+#    define EG_LOG_INFO(...) EG_LOG_DISABLED(__VA_ARGS__)
+#endif
+
+#if EG_LOG_ACTIVE_LEVEL <= EG_LOG_LEVEL_WARN
+#    define EG_LOG_WARN(...) EG_LOG_AT(warn, warn, __VA_ARGS__)
+#else
+#    define EG_LOG_WARN(...) EG_LOG_DISABLED(__VA_ARGS__)
+#endif
+
+#pragma endregion
+
 #endif /* __ELECTIONGUARD_CPP_LOG_HPP_INCLUDED__ */
@@ -1,19 +1,28 @@
 #ifndef __ELECTIONGUARD_CPP_LOOKUP_TABLE_HPP_INCLUDED__
 #define __ELECTIONGUARD_CPP_LOOKUP_TABLE_HPP_INCLUDED__
 
-#include "facades/bignum256.hpp"
+#include "../../libs/hacl/Hacl_Bignum256.hpp"
 #include "facades/bignum4096.hpp"
+#include "table_memory.hpp"
 #include "utils.hpp"
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstdint>
 #include <electionguard/async.hpp>
 #include <electionguard/constants.h>
 #include <electionguard/export.h>
+#include <electionguard/metrics.hpp>
 #include <iomanip>
 #include <iostream>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 using electionguard::facades::Bignum4096;
 using electionguard::facades::CONTEXT_P;
@@ -25,6 +34,91 @@ using std::unique_ptr;
 
 namespace electionguard
 {
+    /// <summary>
+    /// The precomputed powers of a fixed base used to exponentiate it
+    /// </summary>
+    class EG_INTERNAL_API FixedBaseEngine
+    {
+      public:
+        virtual ~FixedBaseEngine() = default;
+
+        /// <summary>
+        /// calcuate pow_mod_p using the precomputed fixed base.
+        /// </summary>
+        virtual std::vector<uint64_t> pow_mod_p(uint64_t (&exponent)[MAX_Q_LEN]) const = 0;
+
+        /// <summary>
+        /// calcuate pow_mod_p for several exponents using the precomputed fixed base,
+        /// writing MAX_P_LEN limbs per exponent into results.
+        /// </summary>
+        virtual void pow_mod_p_batch(const uint64_t *const *exponents, uint64_t count,
+                                     uint64_t *results) const = 0;
+
+        /// <summary>
+        /// calcuate pow_mod_p with the same multiplications and the same table reads for
+        /// every exponent, writing MAX_P_LEN limbs into the result. used for secret exponents
+        /// such as nonces, at the cost of reading every entry of each row the walk visits.
+        /// </summary>
+        virtual void pow_mod_p_constant_time(const uint64_t *exponent, uint64_t *result) const = 0;
+
+        /// <summary>
+        /// copy the table into new storage placed on the NUMA node of the calling thread
+        /// </summary>
+        virtual std::unique_ptr<FixedBaseEngine> replicate(TableMemoryPolicy policy) const = 0;
+
+        /// <summary>
+        /// the policy applied to the table storage after any fallbacks
+        /// </summary>
+        virtual TableMemoryPolicy getMemoryPolicy() const = 0;
+
+      protected:
+        /// <summary>
+        /// all ones when the values are equal and zero otherwise, without branching
+        /// </summary>
+        static uint64_t equalMask(uint64_t lhs, uint64_t rhs)
+        {
+            auto difference = lhs ^ rhs;
+            return ((difference | (0 - difference)) >> 63) - 1;
+        }
+
+        /// <summary>
+        /// accumulate the entry at the index of a row into the selection by reading every
+        /// entry of the row, so the cache lines touched do not depend on the index
+        /// </summary>
+        static void selectEntry(const uint64_t *entries, uint64_t first, uint64_t count,
+                                uint64_t index, uint64_t (&selection)[MAX_P_LEN])
+        {
+            for (uint64_t i = first; i < count; i++) {
+                auto mask = equalMask(i, index);
+                const auto *entry = entries + i * MAX_P_LEN;
+                for (uint64_t limb = 0; limb < MAX_P_LEN; limb++) {
+                    selection[limb] |= entry[limb] & mask;
+                }
+            }
+        }
+
+        /// <summary>
+        /// multiply in montgomery form with the hacl routines, since the vector backends
+        /// are only variable time
+        /// </summary>
+        static void mul_mod_p_mont_const_time(uint64_t *lhs, uint64_t *rhs, uint64_t *res)
+        {
+            CONTEXT_P().montgomery_mod_mul_stay_in_mont_form(lhs, rhs, res, true);
+        }
+
+        /// <summary>
+        /// copy the value into the selection when the index is zero
+        /// </summary>
+        static void selectZero(const uint64_t *value, uint64_t index,
+                               uint64_t (&selection)[MAX_P_LEN])
+        {
+            auto mask = equalMask(0, index);
+            for (uint64_t limb = 0; limb < MAX_P_LEN; limb++) {
+                selection[limb] |= value[limb] & mask;
+            }
+        }
+    };
+
     /// <summary>
     /// A fixed-base lookup tables used to precompute components for exponentiation.
     ///
@@ -40,19 +134,53 @@ namespace electionguard
     /// m table length = 32
     ///
     /// any changes to these values may impact the internal operation of the functions.
+    ///
+    /// the table storage is allocated according to a TableMemoryPolicy, since the random
+    /// row lookups of a table backed by regular pages mostly miss the TLB.
     /// </summary>
     template <uint64_t WindowSize, uint64_t OrderBits, uint64_t TableLength>
-    class EG_INTERNAL_API LookupTable
+    class EG_INTERNAL_API LookupTable : public FixedBaseEngine
     {
         typedef std::array<std::array<uint64_t[MAX_P_LEN], OrderBits>, TableLength> FixedBaseTable;
 
       public:
-        explicit LookupTable(uint64_t *base) { generateTable(base, MAX_P_LEN); }
+        explicit LookupTable(uint64_t *base,
+                             TableMemoryPolicy policy = TableMemoryPolicy::transparentHugePages)
+            : _memory(new TableMemory(sizeof(FixedBaseTable), policy)),
+              _lookupTable(new (_memory->data()) FixedBaseTable)
+        {
+            generateTable(base, MAX_P_LEN);
+        }
+
+        /// <summary>
+        /// copy an existing table into new storage. the calling thread touches every page
+        /// first, so the copy is placed on the NUMA node the thread is running on.
+        /// </summary>
+        LookupTable(const LookupTable &other, TableMemoryPolicy policy)
+            : _memory(new TableMemory(sizeof(FixedBaseTable), policy)),
+              _lookupTable(new (_memory->data()) FixedBaseTable(*other._lookupTable))
+        {
+            copy(begin(other.one_in_montgomery_form), end(other.one_in_montgomery_form),
+                 begin(one_in_montgomery_form));
+        }
+
+        LookupTable(const LookupTable &) = delete;
+        LookupTable &operator=(const LookupTable &) = delete;
+
+        /// <summary>
+        /// the policy applied to the table storage after any fallbacks
+        /// </summary>
+        TableMemoryPolicy getMemoryPolicy() const override { return _memory->getPolicy(); }
+
+        std::unique_ptr<FixedBaseEngine> replicate(TableMemoryPolicy policy) const override
+        {
+            return std::make_unique<LookupTable>(*this, policy);
+        }
 
         /// <summary>
         /// calcuate pow_mod_p using the precomputed fixed base.
         /// </summary>
-        std::vector<uint64_t> pow_mod_p(uint64_t (&exponent)[MAX_Q_LEN]) const
+        std::vector<uint64_t> pow_mod_p(uint64_t (&exponent)[MAX_Q_LEN]) const override
         {
             uint64_t montgomery_result[MAX_P_LEN] = {};
             uint64_t result[MAX_P_LEN] = {};
@@ -71,7 +199,7 @@ namespace electionguard
 
             // iterate over rows-m slicing each segment of the exponent
             // and lookup the table values before executing a mul_mod_p operation
-            for (uint64_t i = 0; i < _lookupTable.size(); i++) {
+            for (uint64_t i = 0; i < TableLength; i++) {
                 auto slice = exponentBytes[i];
 
                 // skip zero bytes
@@ -79,7 +207,8 @@ namespace electionguard
                     continue;
                 }
 
-                mul_mod_p_mont(montgomery_result, const_cast<uint64_t *>(_lookupTable[i][slice]),
+                mul_mod_p_mont(montgomery_result,
+                               const_cast<uint64_t *>((*_lookupTable)[i][slice]),
                                montgomery_result);
             }
 
@@ -91,7 +220,105 @@ namespace electionguard
             return vec;
         }
 
+        /// <summary>
+        /// calcuate pow_mod_p for several exponents using the precomputed fixed base,
+        /// writing MAX_P_LEN limbs per exponent into results.
+        ///
+        /// the exponents are walked in groups of BATCH_LANES. each group advances through
+        /// the rows together and prefetches the entries of the next row before multiplying
+        /// the current one, so the table reads of one lane overlap the products of the others.
+        /// the accumulators stay in montgomery form until the walk completes.
+        /// </summary>
+        void pow_mod_p_batch(const uint64_t *const *exponents, uint64_t count,
+                             uint64_t *results) const override
+        {
+            for (uint64_t start = 0; start < count; start += BATCH_LANES) {
+                auto lanes = std::min<uint64_t>(BATCH_LANES, count - start);
+                uint64_t montgomery_results[BATCH_LANES][MAX_P_LEN] = {};
+                uint8_t exponentBytes[BATCH_LANES][MAX_Q_SIZE] = {};
+
+                for (uint64_t lane = 0; lane < lanes; lane++) {
+                    copy((uint64_t *)one_in_montgomery_form,
+                         (uint64_t *)one_in_montgomery_form + MAX_P_LEN,
+                         montgomery_results[lane]);
+                    Bignum256::toBytes(const_cast<uint64_t *>(exponents[start + lane]),
+                                       static_cast<uint8_t *>(exponentBytes[lane]));
+                    std::reverse(std::begin(exponentBytes[lane]), std::end(exponentBytes[lane]));
+                    prefetchEntry((*_lookupTable)[0][exponentBytes[lane][0]]);
+                }
+
+                for (uint64_t i = 0; i < TableLength; i++) {
+                    if (i + 1 < TableLength) {
+                        for (uint64_t lane = 0; lane < lanes; lane++) {
+                            prefetchEntry((*_lookupTable)[i + 1][exponentBytes[lane][i + 1]]);
+                        }
+                    }
+                    for (uint64_t lane = 0; lane < lanes; lane++) {
+                        auto slice = exponentBytes[lane][i];
+
+                        // skip zero bytes
+                        if (slice == 0) {
+                            continue;
+                        }
+
+                        mul_mod_p_mont(montgomery_results[lane],
+                                       const_cast<uint64_t *>((*_lookupTable)[i][slice]),
+                                       montgomery_results[lane]);
+                    }
+                }
+
+                for (uint64_t lane = 0; lane < lanes; lane++) {
+                    CONTEXT_P().from_montgomery_form(montgomery_results[lane],
+                                                     results + (start + lane) * MAX_P_LEN);
+                }
+            }
+        }
+
+        /// <summary>
+        /// calcuate pow_mod_p in constant time. every row is multiplied in, and the entry
+        /// of each row is gathered with a masked read of the whole row rather than indexed
+        /// by the exponent byte. the unused first entry of each row stands in for one.
+        /// </summary>
+        void pow_mod_p_constant_time(const uint64_t *exponent, uint64_t *result) const override
+        {
+            uint64_t montgomery_result[MAX_P_LEN] = {};
+            uint8_t exponentBytes[MAX_Q_SIZE] = {};
+            copy(begin(one_in_montgomery_form), end(one_in_montgomery_form),
+                 begin(montgomery_result));
+
+            Bignum256::toBytes(const_cast<uint64_t *>(exponent),
+                               static_cast<uint8_t *>(exponentBytes));
+            std::reverse(std::begin(exponentBytes), std::end(exponentBytes));
+
+            for (uint64_t i = 0; i < TableLength; i++) {
+                uint64_t entry[MAX_P_LEN] = {};
+                auto slice = exponentBytes[i];
+                selectZero(one_in_montgomery_form, slice, entry);
+                selectEntry((*_lookupTable)[i][0], 1, OrderBits, slice, entry);
+                mul_mod_p_mont_const_time(montgomery_result, entry, montgomery_result);
+            }
+
+            CONTEXT_P().from_montgomery_form(montgomery_result, result);
+        }
+
       protected:
+        /// <summary>
+        /// the number of exponentiations walked through the table together
+        /// </summary>
+        static constexpr uint64_t BATCH_LANES = 4;
+
+        static void prefetchEntry(const uint64_t *entry)
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            // one table entry spans several cache lines
+            for (uint64_t offset = 0; offset < MAX_P_LEN; offset += 8) {
+                __builtin_prefetch(entry + offset);
+            }
+#else
+            (void)entry;
+#endif
+        }
+
         void generateTable(uint64_t *base, uint64_t len)
         {
             // checking for power of two ensures the table is uniform
@@ -113,7 +340,7 @@ namespace electionguard
             for (uint64_t i = 0; i < TableLength; i++) {
                 // iterate over each b-bit and compute the table values
                 for (uint64_t j = 1; j < OrderBits; j++) {
-                    copy(begin(running_base), end(running_base), begin(_lookupTable[i][j]));
+                    copy(begin(running_base), end(running_base), begin((*_lookupTable)[i][j]));
                     mul_mod_p_mont(running_base, row_base, running_base);
                 }
                 copy(begin(running_base), end(running_base), begin(row_base));
@@ -131,14 +358,287 @@ namespace electionguard
         }
 
       private:
-        FixedBaseTable _lookupTable = {};
+        std::unique_ptr<TableMemory> _memory;
+        FixedBaseTable *_lookupTable;
         uint64_t one_in_montgomery_form[MAX_P_LEN] = {};
     };
 
     typedef LookupTable<LUT_WINDOW_SIZE, LUT_ORDER_BITS, LUT_TABLE_LENGTH> LookupTableType;
 
+    /// <summary>
+    /// A fixed-base Lim-Lee comb, which trades the memory of the table
+    /// against the number of operations of each exponentiation.
+    ///
+    /// The 256 bit exponent is laid out as `teeth` rows of a = ⌈256 / teeth⌉ bits, and the
+    /// columns are split into `tables` blocks of b = ⌈a / tables⌉ bits. For every combination
+    /// u of the rows, table j holds the product of g^(2^(i·a + j·b)) over the rows i set in u.
+    /// An exponentiation then takes b - 1 squarings and at most tables · b multiplications
+    /// from tables · 2^teeth entries of MAX_P_SIZE bytes.
+    ///
+    /// for example 8 teeth over 32 tables takes 32 multiplications from 4 MiB like the
+    /// byte table, 12 teeth over 4 tables takes 5 squarings and 24 multiplications from 8 MiB,
+    /// and 8 teeth over 4 tables takes 7 squarings and 32 multiplications from 512 KiB.
+    /// </summary>
+    class EG_INTERNAL_API CombTable : public FixedBaseEngine
+    {
+      public:
+        /// <summary>
+        /// the most teeth of a comb, for a table of 2^16 entries
+        /// </summary>
+        static constexpr uint32_t MAX_TEETH = 16;
+
+        CombTable(const uint64_t *base, uint32_t teeth, uint32_t tables,
+                  TableMemoryPolicy policy = TableMemoryPolicy::transparentHugePages)
+            : _teeth(teeth), _tables(tables), _rowBits(rowBits(teeth)),
+              _blockBits(blockBits(teeth, tables))
+        {
+            validate(teeth, tables);
+            _memory = std::make_unique<TableMemory>(size(), policy);
+            generateTable(base);
+        }
+
+        /// <summary>
+        /// copy an existing table into new storage. the calling thread touches every page
+        /// first, so the copy is placed on the NUMA node the thread is running on.
+        /// </summary>
+        CombTable(const CombTable &other, TableMemoryPolicy policy)
+            : _teeth(other._teeth), _tables(other._tables), _rowBits(other._rowBits),
+              _blockBits(other._blockBits),
+              _memory(std::make_unique<TableMemory>(other.size(), policy))
+        {
+            const auto *source = static_cast<const uint8_t *>(other._memory->data());
+            copy(source, source + size(), static_cast<uint8_t *>(_memory->data()));
+            copy(begin(other.one_in_montgomery_form), end(other.one_in_montgomery_form),
+                 begin(one_in_montgomery_form));
+        }
+
+        CombTable(const CombTable &) = delete;
+        CombTable &operator=(const CombTable &) = delete;
+
+        /// <summary>
+        /// throws when the comb can not be laid out over the 256 bits of an exponent
+        /// </summary>
+        static void validate(uint32_t teeth, uint32_t tables)
+        {
+            if (teeth == 0 || teeth > MAX_TEETH) {
+                throw std::invalid_argument("a comb has between 1 and 16 teeth");
+            }
+            if (tables == 0 || tables > rowBits(teeth)) {
+                throw std::invalid_argument("a comb has between 1 table and a table per column");
+            }
+        }
+
+        /// <summary>
+        /// the number of bytes of the table
+        /// </summary>
+        uint64_t size() const { return (uint64_t)_tables * entriesPerTable() * MAX_P_SIZE; }
+
+        /// <summary>
+        /// the squarings of each exponentiation
+        /// </summary>
+        uint64_t getSquarings() const { return _blockBits - 1; }
+
+        /// <summary>
+        /// the most multiplications of each exponentiation
+        /// </summary>
+        uint64_t getMultiplications() const { return (uint64_t)_tables * _blockBits; }
+
+        TableMemoryPolicy getMemoryPolicy() const override { return _memory->getPolicy(); }
+
+        std::unique_ptr<FixedBaseEngine> replicate(TableMemoryPolicy policy) const override
+        {
+            return std::make_unique<CombTable>(*this, policy);
+        }
+
+        std::vector<uint64_t> pow_mod_p(uint64_t (&exponent)[MAX_Q_LEN]) const override
+        {
+            std::vector<uint64_t> result(MAX_P_LEN);
+            pow_mod_p(static_cast<const uint64_t *>(exponent), result.data());
+            return result;
+        }
+
+        void pow_mod_p_batch(const uint64_t *const *exponents, uint64_t count,
+                             uint64_t *results) const override
+        {
+            for (uint64_t i = 0; i < count; i++) {
+                pow_mod_p(exponents[i], results + i * MAX_P_LEN);
+            }
+        }
+
+        /// <summary>
+        /// calcuate pow_mod_p in constant time. every column of every table is multiplied
+        /// in, and each entry is gathered with a masked read of the whole table, so a comb
+        /// with fewer teeth is considerably cheaper in this mode than the byte table.
+        /// </summary>
+        void pow_mod_p_constant_time(const uint64_t *exponent, uint64_t *result) const override
+        {
+            uint64_t montgomery_result[MAX_P_LEN] = {};
+            copy(begin(one_in_montgomery_form), end(one_in_montgomery_form),
+                 begin(montgomery_result));
+
+            for (uint64_t column = _blockBits; column-- > 0;) {
+                if (column + 1 < _blockBits) {
+                    mul_mod_p_mont_const_time(montgomery_result, montgomery_result,
+                                              montgomery_result);
+                }
+                for (uint64_t table = 0; table < _tables; table++) {
+                    // the layout is public, only the bits of the exponent are secret
+                    auto offset = table * _blockBits + column;
+                    if (offset >= _rowBits) {
+                        continue;
+                    }
+
+                    uint64_t index = 0;
+                    for (uint64_t row = 0; row < _teeth; row++) {
+                        index |= bit(exponent, row * _rowBits + offset) << row;
+                    }
+                    uint64_t selection[MAX_P_LEN] = {};
+                    selectEntry(entry(table, 0), 0, entriesPerTable(), index, selection);
+                    mul_mod_p_mont_const_time(montgomery_result, selection, montgomery_result);
+                }
+            }
+
+            CONTEXT_P().from_montgomery_form(montgomery_result, result);
+        }
+
+      private:
+        static uint64_t rowBits(uint32_t teeth)
+        {
+            return teeth == 0 ? 0 : (MAX_Q_LEN * 64 + teeth - 1) / teeth;
+        }
+
+        static uint64_t blockBits(uint32_t teeth, uint32_t tables)
+        {
+            return tables == 0 ? 0 : (rowBits(teeth) + tables - 1) / tables;
+        }
+
+        uint64_t entriesPerTable() const { return 1ULL << _teeth; }
+
+        uint64_t *entry(uint64_t table, uint64_t index) const
+        {
+            return static_cast<uint64_t *>(_memory->data()) +
+                   (table * entriesPerTable() + index) * MAX_P_LEN;
+        }
+
+        static uint64_t bit(const uint64_t *exponent, uint64_t position)
+        {
+            if (position >= MAX_Q_LEN * 64) {
+                return 0;
+            }
+            return (exponent[position / 64] >> (position % 64)) & 1;
+        }
+
+        void pow_mod_p(const uint64_t *exponent, uint64_t *result) const
+        {
+            uint64_t montgomery_result[MAX_P_LEN] = {};
+            copy(begin(one_in_montgomery_form), end(one_in_montgomery_form),
+                 begin(montgomery_result));
+
+            // walk the columns of every block from the most significant bit,
+            // reading one tooth from each row for the index into each table
+            for (uint64_t column = _blockBits; column-- > 0;) {
+                if (column + 1 < _blockBits) {
+                    mul_mod_p_mont(montgomery_result, montgomery_result, montgomery_result);
+                }
+                for (uint64_t table = 0; table < _tables; table++) {
+                    auto offset = table * _blockBits + column;
+                    if (offset >= _rowBits) {
+                        continue;
+                    }
+
+                    uint64_t index = 0;
+                    for (uint64_t row = 0; row < _teeth; row++) {
+                        index |= bit(exponent, row * _rowBits + offset) << row;
+                    }
+                    if (index != 0) {
+                        mul_mod_p_mont(montgomery_result, entry(table, index), montgomery_result);
+                    }
+                }
+            }
+
+            CONTEXT_P().from_montgomery_form(montgomery_result, result);
+        }
+
+        void generateTable(const uint64_t *base)
+        {
+            // g^(2^(i·a)) for each row i, advanced by b bits after each table
+            std::vector<uint64_t> rows(_teeth * MAX_P_LEN);
+            CONTEXT_P().to_montgomery_form(const_cast<uint64_t *>(base), rows.data());
+            for (uint64_t row = 1; row < _teeth; row++) {
+                auto *current = rows.data() + row * MAX_P_LEN;
+                copy(current - MAX_P_LEN, current, current);
+                square(current, _rowBits);
+            }
+
+            uint64_t one[MAX_P_LEN] = {1UL};
+            CONTEXT_P().to_montgomery_form(one, one_in_montgomery_form);
+
+            for (uint64_t table = 0; table < _tables; table++) {
+                copy(begin(one_in_montgomery_form), end(one_in_montgomery_form),
+                     entry(table, 0));
+
+                // each combination extends the combination without its lowest row
+                for (uint64_t index = 1; index < entriesPerTable(); index++) {
+                    uint64_t lowest = 0;
+                    while (((index >> lowest) & 1) == 0) {
+                        lowest++;
+                    }
+                    auto *row = rows.data() + lowest * MAX_P_LEN;
+                    auto rest = index & (index - 1);
+                    if (rest == 0) {
+                        copy(row, row + MAX_P_LEN, entry(table, index));
+                    } else {
+                        mul_mod_p_mont(entry(table, rest), row, entry(table, index));
+                    }
+                }
+
+                for (uint64_t row = 0; row < _teeth; row++) {
+                    square(rows.data() + row * MAX_P_LEN, _blockBits);
+                }
+            }
+        }
+
+        static void square(uint64_t *value, uint64_t times)
+        {
+            for (uint64_t i = 0; i < times; i++) {
+                mul_mod_p_mont(value, value, value);
+            }
+        }
+
+        static void mul_mod_p_mont(uint64_t *lhs, uint64_t *rhs, uint64_t *res)
+        {
+            CONTEXT_P().montgomery_mod_mul_stay_in_mont_form(lhs, rhs, res);
+        }
+
+        uint32_t _teeth;
+        uint32_t _tables;
+        uint64_t _rowBits;
+        uint64_t _blockBits;
+        std::unique_ptr<TableMemory> _memory;
+        uint64_t one_in_montgomery_form[MAX_P_LEN] = {};
+    };
+
+    /// <summary>
+    /// The layout of the table of a fixed base
+    /// </summary>
+    struct FixedBaseLayout {
+        /// <summary>
+        /// the teeth of a comb table, or zero for the byte table
+        /// </summary>
+        uint32_t combTeeth = 0;
+
+        /// <summary>
+        /// the tables of a comb table
+        /// </summary>
+        uint32_t combTables = 0;
+    };
+
     /// <summary>
     /// A singleton context for a collection of fixed base lookup tables.
+    ///
+    /// With NUMA replication enabled, each base keeps one copy of its table per NUMA node
+    /// and every thread reads the copy on its own node. The copy for a node is made by
+    /// the first thread that needs it there, so the pages land in that node's memory.
     /// </summary>
     class EG_INTERNAL_API LookupTableContext
     {
@@ -160,32 +660,208 @@ namespace electionguard
         }
 
         /// <summary>
-        /// calcuate pow_mod_p using the provided fixed base.
+        /// calcuate pow_mod_p using the provided fixed base, in constant time when
+        /// requested or, by default, when constant time is enabled for every call.
         /// </summary>
         static std::vector<uint64_t> pow_mod_p(std::string &key, uint64_t (&base)[MAX_P_LEN],
-                                               uint64_t (&exponent)[MAX_Q_LEN])
+                                               uint64_t (&exponent)[MAX_Q_LEN],
+                                               bool constantTime = getConstantTime())
         {
-            LookupTableType *public_key_table = NULL;
+            std::shared_ptr<FixedBaseEngine> public_key_table;
             {
-                getInstance().task_lock.wait();
+                // tables are shared by every thread encrypting against the same base
+                std::lock_guard<std::mutex> lock(getInstance().task_lock);
                 public_key_table = getInstance().getBaseLookupTable(key, base);
             }
+            if (constantTime) {
+                std::vector<uint64_t> result(MAX_P_LEN);
+                public_key_table->pow_mod_p_constant_time(exponent, result.data());
+                return result;
+            }
             return public_key_table->pow_mod_p(exponent);
         }
 
+        /// <summary>
+        /// calcuate pow_mod_p for several exponents using the provided fixed base.
+        /// </summary>
+        static void pow_mod_p_batch(std::string &key, uint64_t (&base)[MAX_P_LEN],
+                                    const uint64_t *const *exponents, uint64_t count,
+                                    uint64_t *results, bool constantTime = getConstantTime())
+        {
+            std::shared_ptr<FixedBaseEngine> public_key_table;
+            {
+                std::lock_guard<std::mutex> lock(getInstance().task_lock);
+                public_key_table = getInstance().getBaseLookupTable(key, base);
+            }
+            if (constantTime) {
+                // the interleaved walk skips zero windows, so each exponent is walked alone
+                for (uint64_t i = 0; i < count; i++) {
+                    public_key_table->pow_mod_p_constant_time(exponents[i],
+                                                              results + i * MAX_P_LEN);
+                }
+                return;
+            }
+            public_key_table->pow_mod_p_batch(exponents, count, results);
+        }
+
+        /// <summary>
+        /// set how the storage of tables built from now on is allocated
+        /// </summary>
+        static void setMemoryPolicy(TableMemoryPolicy policy) { getInstance().policy = policy; }
+
+        static TableMemoryPolicy getMemoryPolicy() { return getInstance().policy; }
+
+        /// <summary>
+        /// keep a replica of each table on every NUMA node that uses it
+        /// </summary>
+        static void setNumaReplication(bool enabled) { getInstance().replicate = enabled; }
+
+        static bool getNumaReplication() { return getInstance().replicate; }
+
+        /// <summary>
+        /// exponentiate every fixed base in constant time unless a call asks otherwise
+        /// </summary>
+        static void setConstantTime(bool enabled) { getInstance().constantTime = enabled; }
+
+        static bool getConstantTime() { return getInstance().constantTime; }
+
+        /// <summary>
+        /// select the layout of the table of the base stored under the key, such as a comb
+        /// that uses less memory for a base that is rarely exponentiated. a table already
+        /// built for the base is released once the calls still walking it return, and the
+        /// next exponentiation of the base builds the new layout.
+        /// </summary>
+        static void setLayout(const std::string &key, FixedBaseLayout layout)
+        {
+            if (layout.combTeeth > 0) {
+                CombTable::validate(layout.combTeeth, layout.combTables);
+            }
+
+            auto &instance = getInstance();
+            std::lock_guard<std::mutex> lock(instance.task_lock);
+            instance.layouts[key] = layout;
+            // calls walking the old tables hold their own reference to them
+            instance.key_map.erase(key);
+        }
+
+        static FixedBaseLayout getLayout(const std::string &key)
+        {
+            auto &instance = getInstance();
+            std::lock_guard<std::mutex> lock(instance.task_lock);
+            auto layout = instance.layouts.find(key);
+            return layout == instance.layouts.end() ? FixedBaseLayout() : layout->second;
+        }
+
+        /// <summary>
+        /// register a base so that it is exponentiated with its lookup table however the element
+        /// holding it was created. registered bases are recognized by a fingerprint of their value
+        /// and share the table of the base stored under the same key.
+        /// </summary>
+        static void registerFixedBase(const uint64_t (&base)[MAX_P_LEN], const std::string &key)
+        {
+            auto &instance = getInstance();
+            std::lock_guard<std::mutex> lock(instance.registry_lock);
+            std::string existing;
+            auto count = instance.registeredCount.load(std::memory_order_relaxed);
+            if (findFixedBase(base, existing) || count == MAX_REGISTERED_BASES) {
+                return;
+            }
+
+            auto &registered = instance.registered[count];
+            registered.fingerprint = fingerprint(base);
+            copy(begin(base), end(base), registered.limbs.begin());
+            registered.key = key;
+            instance.registeredCount.store(count + 1, std::memory_order_release);
+        }
+
+        /// <summary>
+        /// find the key of the table of a registered base
+        /// </summary>
+        /// <returns>false when the base is not registered</returns>
+        static bool findFixedBase(const uint64_t (&base)[MAX_P_LEN], std::string &key)
+        {
+            auto &instance = getInstance();
+            auto count = instance.registeredCount.load(std::memory_order_acquire);
+            if (count == 0) {
+                return false;
+            }
+
+            auto hash = fingerprint(base);
+            for (size_t i = 0; i < count; i++) {
+                const auto &registered = instance.registered[i];
+                if (registered.fingerprint == hash &&
+                    std::equal(registered.limbs.begin(), registered.limbs.end(), begin(base))) {
+                    key = registered.key;
+                    return true;
+                }
+            }
+            return false;
+        }
+
       private:
-        AsyncSemaphore task_lock;
-        std::map<std::string, std::unique_ptr<LookupTableType>> key_map;
+        // registered bases beyond this many still use a table when flagged as a fixed base
+        static constexpr size_t MAX_REGISTERED_BASES = 64;
 
-        LookupTableType *getBaseLookupTable(const std::string &key, uint64_t (&base)[MAX_P_LEN])
+        struct RegisteredBase {
+            uint64_t fingerprint = 0;
+            std::array<uint64_t, MAX_P_LEN> limbs = {};
+            std::string key;
+        };
+
+        std::mutex task_lock;
+        std::mutex registry_lock;
+        // entries are only appended and published by the count, so readers never take a lock
+        std::array<RegisteredBase, MAX_REGISTERED_BASES> registered;
+        std::atomic<size_t> registeredCount{0};
+        // the replicas of each table indexed by NUMA node
+        std::map<std::string, std::vector<std::shared_ptr<FixedBaseEngine>>> key_map;
+        std::map<std::string, FixedBaseLayout> layouts;
+        std::atomic<TableMemoryPolicy> policy{TableMemoryPolicy::transparentHugePages};
+        std::atomic<bool> replicate{false};
+        std::atomic<bool> constantTime{false};
+
+        static uint64_t fingerprint(const uint64_t (&base)[MAX_P_LEN])
         {
-            auto const iter = key_map.find(key);
-            if (iter != key_map.end()) {
-                return key_map[key].get();
+            // FNV-1a over the limbs, cheap next to any exponentiation
+            uint64_t hash = 0xcbf29ce484222325ULL;
+            for (auto limb : base) {
+                hash = (hash ^ limb) * 0x100000001b3ULL;
             }
+            return hash;
+        }
 
-            key_map.emplace(std::pair(key, new LookupTableType(static_cast<uint64_t *>(base))));
-            return key_map[key].get();
+        std::shared_ptr<FixedBaseEngine> getBaseLookupTable(const std::string &key,
+                                                            uint64_t (&base)[MAX_P_LEN])
+        {
+            auto &replicas = key_map[key];
+            if (replicas.empty()) {
+                replicas.resize(TableMemory::getNumaNodeCount());
+            }
+
+            auto node = replicate ? TableMemory::getCurrentNumaNode() % replicas.size() : 0;
+            if (replicas[node] != nullptr) {
+                return replicas[node];
+            }
+
+            // copying a replica from another node is far cheaper than building the table
+            for (const auto &replica : replicas) {
+                if (replica != nullptr) {
+                    replicas[node] = replica->replicate(policy);
+                    return replicas[node];
+                }
+            }
+
+            Metrics::increment(Metric::lookupTableBuilds);
+            auto layout = layouts.find(key);
+            if (layout != layouts.end() && layout->second.combTeeth > 0) {
+                replicas[node] = std::make_unique<CombTable>(
+                  static_cast<uint64_t *>(base), layout->second.combTeeth,
+                  layout->second.combTables, policy);
+            } else {
+                replicas[node] =
+                  std::make_unique<LookupTableType>(static_cast<uint64_t *>(base), policy);
+            }
+            return replicas[node];
         }
     };
 
@@ -0,0 +1,133 @@
+#include "electionguard/metrics.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+using std::atomic;
+using std::lock_guard;
+using std::memory_order_relaxed;
+using std::mutex;
+using std::out_of_range;
+using std::vector;
+
+namespace electionguard
+{
+    static const char *const metricNames[Metrics::COUNT] = {
+      "pow_mod_p_full",
+      "pow_mod_p_table",
+      "pow_mod_q",
+      "lookup_table_builds",
+      "precompute_hits",
+      "precompute_misses",
+      "discrete_log_cache_hits",
+      "discrete_log_cache_misses",
+      "hash_invocations",
+      "hash_bytes",
+      "element_allocations",
+    };
+
+    struct ThreadCounters;
+
+    struct Registry {
+        mutex lock;
+        vector<ThreadCounters *> threads;
+        // the totals of threads that have exited
+        Metrics::Snapshot retired = {};
+        // the totals at the last reset
+        Metrics::Snapshot baseline = {};
+
+        Metrics::Snapshot totals();
+    };
+
+    static Registry &getRegistry()
+    {
+        // never destroyed so that thread local counters can retire during shutdown
+        static auto *instance = new Registry();
+        return *instance;
+    }
+
+    struct ThreadCounters {
+        // only the owning thread writes; the atomics let other threads read safely
+        std::array<atomic<uint64_t>, Metrics::COUNT> values = {};
+
+        ThreadCounters()
+        {
+            auto &registry = getRegistry();
+            lock_guard<mutex> guard(registry.lock);
+            registry.threads.push_back(this);
+        }
+
+        ~ThreadCounters()
+        {
+            auto &registry = getRegistry();
+            lock_guard<mutex> guard(registry.lock);
+            for (size_t i = 0; i < Metrics::COUNT; i++) {
+                registry.retired[i] += values[i].load(memory_order_relaxed);
+            }
+            registry.threads.erase(
+              std::remove(registry.threads.begin(), registry.threads.end(), this),
+              registry.threads.end());
+        }
+
+        ThreadCounters(const ThreadCounters &) = delete;
+        ThreadCounters &operator=(const ThreadCounters &) = delete;
+    };
+
+    Metrics::Snapshot Registry::totals()
+    {
+        auto result = retired;
+        for (const auto *thread : threads) {
+            for (size_t i = 0; i < Metrics::COUNT; i++) {
+                result[i] += thread->values[i].load(memory_order_relaxed);
+            }
+        }
+        return result;
+    }
+
+    static ThreadCounters &getThreadCounters()
+    {
+        thread_local ThreadCounters counters;
+        return counters;
+    }
+
+    static size_t indexOf(Metric metric)
+    {
+        auto index = static_cast<size_t>(metric);
+        if (index >= Metrics::COUNT) {
+            throw out_of_range("unknown metric");
+        }
+        return index;
+    }
+
+    void Metrics::increment(Metric metric, uint64_t amount /* = 1 */)
+    {
+        auto &value = getThreadCounters().values[static_cast<size_t>(metric)];
+        value.store(value.load(memory_order_relaxed) + amount, memory_order_relaxed);
+    }
+
+    uint64_t Metrics::get(Metric metric) { return snapshot()[indexOf(metric)]; }
+
+    Metrics::Snapshot Metrics::snapshot()
+    {
+        auto &registry = getRegistry();
+        lock_guard<mutex> guard(registry.lock);
+        auto result = registry.totals();
+        for (size_t i = 0; i < COUNT; i++) {
+            result[i] -= registry.baseline[i];
+        }
+        return result;
+    }
+
+    void Metrics::reset()
+    {
+        // counters are never written by other threads, so a reset moves the baseline
+        auto &registry = getRegistry();
+        lock_guard<mutex> guard(registry.lock);
+        registry.baseline = registry.totals();
+    }
+
+    const char *Metrics::getName(Metric metric) { return metricNames[indexOf(metric)]; }
+} // namespace electionguard
@@ -2,6 +2,7 @@
 
 #include "electionguard/hash.hpp"
 #include "log.hpp"
+#include "sha256.hpp"
 #include "variant_cast.hpp"
 
 using std::make_unique;
@@ -20,19 +21,28 @@ namespace electionguard
         {
             CryptoHashableType headers_ = variant_cast(headers);
             this->seed = hash_elems({&const_cast<ElementModQ &>(seed), headers_});
+            this->seed->setIsSecret(true);
             nextItem = 0;
         }
         explicit Impl(const ElementModQ &seed)
         {
             this->seed = make_unique<ElementModQ>(const_cast<ElementModQ &>(seed));
+            this->seed->setIsSecret(true);
             nextItem = 0;
         }
 
-        unique_ptr<ElementModQ> get(uint64_t item) { return hash_elems({seed.get(), item}); }
+        unique_ptr<ElementModQ> get(uint64_t item)
+        {
+            auto nonce = hash_elems({seed.get(), item});
+            nonce->setIsSecret(true);
+            return nonce;
+        }
 
         unique_ptr<ElementModQ> get(uint64_t item, string headers)
         {
-            return hash_elems({seed.get(), item, headers});
+            auto nonce = hash_elems({seed.get(), item, headers});
+            nonce->setIsSecret(true);
+            return nonce;
         }
 
         unique_ptr<ElementModQ> next()
@@ -67,11 +77,27 @@ namespace electionguard
 
     vector<unique_ptr<ElementModQ>> Nonces::get(uint64_t startItem, uint64_t count) const
     {
-        // TODO: ISSUE #137: preallocate and address possible overflow
-        vector<unique_ptr<ElementModQ>> result;
+        // TODO: ISSUE #137: address possible overflow
         uint64_t endItem = startItem + count;
+        if (!Sha256::isBatchParallel()) {
+            vector<unique_ptr<ElementModQ>> result;
+            result.reserve(count);
+            for (uint64_t i(startItem); i < endItem; i++) {
+                result.push_back(pimpl->get(i));
+            }
+            return result;
+        }
+
+        // the items are independent so hash them together in one batch
+        vector<vector<CryptoHashableType>> inputs;
+        inputs.reserve(count);
         for (uint64_t i(startItem); i < endItem; i++) {
-            result.push_back(this->get(i));
+            inputs.push_back({pimpl->seed.get(), i});
+        }
+
+        auto result = hash_elems_batch(inputs);
+        for (auto &nonce : result) {
+            nonce->setIsSecret(true);
         }
         return result;
     }
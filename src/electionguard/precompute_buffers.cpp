@@ -1,11 +1,16 @@
 #include "electionguard/group.hpp"
 #include "log.hpp"
+#include "trace_span.hpp"
 #include "utils.hpp"
 
+#include <algorithm>
 #include <array>
+#include <cmath>
 #include <cstdint>
 #include <electionguard/constants.h>
 #include <electionguard/export.h>
+#include <electionguard/manifest.hpp>
+#include <electionguard/metrics.hpp>
 #include <electionguard/precompute_buffers.hpp>
 #include <iomanip>
 #include <iostream>
@@ -204,6 +209,63 @@ namespace electionguard
 
 #pragma endregion
 
+#pragma region PrecomputeProfile
+
+    double PrecomputeProfile::getEncryptionsPerSelection() const
+    {
+        if (selectionsPerBallot <= 0.0) {
+            return 0.0;
+        }
+        return contestsPerBallot * ENCRYPTIONS_PER_CONTEST / selectionsPerBallot;
+    }
+
+    PrecomputeProfile PrecomputeProfile::fromManifest(const InternalManifest &manifest)
+    {
+        PrecomputeProfile profile;
+        auto styles = manifest.getBallotStyles();
+        if (styles.empty()) {
+            return profile;
+        }
+
+        uint64_t contests = 0;
+        uint64_t selections = 0;
+        for (const auto &style : styles) {
+            for (const auto &contest : manifest.getContestsFor(style.get().getObjectId())) {
+                // every contest is padded with one placeholder per vote allowed
+                contests++;
+                selections +=
+                  contest.get().getSelections().size() + contest.get().getVotesAllowed();
+            }
+        }
+        if (selections == 0) {
+            return profile;
+        }
+
+        profile.contestsPerBallot = static_cast<double>(contests) / styles.size();
+        profile.selectionsPerBallot = static_cast<double>(selections) / styles.size();
+        return profile;
+    }
+
+#pragma endregion
+
+#pragma region PrecomputeMemoryBudget
+
+    bool PrecomputeMemoryBudget::tryReserve(uint64_t bytes)
+    {
+        auto current = used.load();
+        do {
+            auto max = limit.load();
+            if (max != 0 && current + bytes > max) {
+                return false;
+            }
+        } while (!used.compare_exchange_weak(current, current + bytes));
+        return true;
+    }
+
+    void PrecomputeMemoryBudget::release(uint64_t bytes) { used -= bytes; }
+
+#pragma endregion
+
 #pragma region PrecomputeBuffer
 
     // Lifecycle Methods
@@ -214,7 +276,16 @@ namespace electionguard
           shouldAutoPopulate(shouldAutoPopulate), publicKey(publicKey.clone())
     {
     }
-    PrecomputeBuffer::~PrecomputeBuffer() = default;
+
+    PrecomputeBuffer::PrecomputeBuffer(const ElementModP &publicKey, uint32_t maxQueueSize,
+                                       std::shared_ptr<PrecomputeMemoryBudget> budget)
+        : maxQueueSize(maxQueueSize == 0 ? DEFAULT_PRECOMPUTE_SIZE : maxQueueSize),
+          publicKey(publicKey.clone()), budget(move(budget))
+    {
+    }
+
+    // return the reservations of the remaining values to the shared budget
+    PrecomputeBuffer::~PrecomputeBuffer() { clear(); }
 
     void PrecomputeBuffer::clear()
     {
@@ -225,64 +296,150 @@ namespace electionguard
         for (int i = 0; i < (int)triple_size; i++) {
             encryption_queue.pop();
         }
+        release(triple_size * ENCRYPTION_BYTES);
 
         std::lock_guard<std::mutex> lock2(selection_queue_lock);
         uint32_t twoTriplesAndAQuadruple_size = selection_queue.size();
         for (int i = 0; i < (int)twoTriplesAndAQuadruple_size; i++) {
             selection_queue.pop();
         }
+        release(twoTriplesAndAQuadruple_size * SELECTION_BYTES);
     }
 
-    void PrecomputeBuffer::start()
+    bool PrecomputeBuffer::reserve(uint64_t bytes)
     {
-        if (publicKey == nullptr) {
-            throw std::runtime_error("PrecomputeBufferContext::start() - elgamalPublicKey is null");
+        return budget == nullptr || budget->tryReserve(bytes);
+    }
+
+    void PrecomputeBuffer::release(uint64_t bytes)
+    {
+        if (budget != nullptr && bytes > 0) {
+            budget->release(bytes);
         }
+    }
 
-        isRunning = true;
+    bool PrecomputeBuffer::produceNext()
+    {
+        // Each value tops up whichever queue is emptier relative to its target,
+        // so a manifest with many contests keeps enough triples for the constant
+        // proofs and the contest data. The queue is chosen under the schedule lock
+        // and the value counted as pending, so concurrent producers do not overfill
+        // a queue that is one value short. The values are generated outside of the
+        // locks so that encryptions can keep drawing from the queues while the
+        // buffer is filled.
+        bool isSelection = false;
+        {
+            std::lock_guard<std::mutex> lock(schedule_lock);
+            auto status = getStatus();
+            auto selections = status.selections.size + pendingSelections;
+            auto encryptions = status.encryptions.size + pendingEncryptions;
+            auto needsSelection = selections < status.selections.target;
+            auto needsEncryption = encryptions < status.encryptions.target;
+            if (!needsSelection && !needsEncryption) {
+                return false;
+            }
 
-        // This loop goes through until the queues are full but can be stopped
-        // between generations of two triples and a quad. By full it means
-        // we check how many quads are in the queue, to start with we will
-        // try 5000 and see how that works. If the vendor wanted to pass the
-        // queue size in we could use that.
-        // for now we just go through the loop once
-        int iteration_count = 0;
-        int iterationCountToGenerateTwoTriples = 3;
-        do {
-            std::lock_guard<std::mutex> lock1(encryption_queue_lock);
-            std::lock_guard<std::mutex> lock2(selection_queue_lock);
+            auto selectionFill = static_cast<double>(selections) /
+                                 std::max<uint32_t>(status.selections.target, 1);
+            auto encryptionFill = static_cast<double>(encryptions) /
+                                  std::max<uint32_t>(status.encryptions.target, 1);
+            isSelection =
+              needsSelection && (!needsEncryption || selectionFill <= encryptionFill);
+
+            // stop once the memory budget shared with the other buffers is spent
+            if (!reserve(isSelection ? SELECTION_BYTES : ENCRYPTION_BYTES)) {
+                return false;
+            }
+            if (isSelection) {
+                pendingSelections++;
+            } else {
+                pendingEncryptions++;
+            }
+        }
 
-            // generate two triples and a quadruple
+        if (isSelection) {
             auto quad = createPrecomputedSelection(*publicKey);
+            std::lock_guard<std::mutex> lock(selection_queue_lock);
             selection_queue.push(move(quad));
+            pendingSelections--;
+        } else {
+            auto triple = make_unique<PrecomputedEncryption>(*publicKey);
+            std::lock_guard<std::mutex> lock(encryption_queue_lock);
+            encryption_queue.push(move(triple));
+            pendingEncryptions--;
+        }
+        return true;
+    }
 
-            // This is very rudimentary. We can add a more complex algorithm in
-            // the future, that would look at the queues and increase production if one
-            // is getting lower than expected.
-            // Every third iteration we generate two extra triples, one for use with
-            // the contest constant chaum pedersen proof and one for hashed elgamal encryption
-            // we need less of these because this exponentiation is done only every contest
-            // encryption whereas the two triples and a quadruple is used every selection
-            // encryption. The generating two triples every third iteration is a guess
-            // on how many precomputes we will need.
-            if ((iteration_count % iterationCountToGenerateTwoTriples) == 0) {
-                auto tuple = createTwoPrecomputedEncryptions(*publicKey);
-                encryption_queue.push(move(std::get<0>(tuple)));
-                encryption_queue.push(move(std::get<1>(tuple)));
-            }
-            iteration_count++;
+    void PrecomputeBuffer::start()
+    {
+        if (publicKey == nullptr) {
+            throw std::runtime_error("PrecomputeBufferContext::start() - elgamalPublicKey is null");
+        }
 
-        } while (isRunning && selection_queue.size() < maxQueueSize);
+        // the loop can be stopped between values
+        isRunning = true;
+        while (isRunning && produceNext()) {
+        }
     }
 
-    void PrecomputeBuffer::startAsync()
+    void PrecomputeBuffer::startAsync(uint32_t concurrency /* = 1 */)
     {
-        // TODO: Issue #217: implement this
+        if (publicKey == nullptr) {
+            throw std::runtime_error(
+              "PrecomputeBufferContext::startAsync() - elgamalPublicKey is null");
+        }
+
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+        // a single threaded webassembly module has no workers to produce on,
+        // so its hosts fill the buffer in slices with populate instead
+        (void)concurrency;
         start();
+#else
+        // with emscripten pthreads each producer runs in a web worker that shares the
+        // module memory, and with it the fixed base tables, with the other producers
+        stop();
+        isRunning = true;
+        std::lock_guard<std::mutex> lock(producer_lock);
+        for (uint32_t i = 0; i < std::max<uint32_t>(concurrency, 1); i++) {
+            activeProducers++;
+            producers.emplace_back([this] {
+                try {
+                    while (isRunning && produceNext()) {
+                    }
+                } catch (const std::exception &e) {
+                    Log::error("PrecomputeBuffer::startAsync: producer failed", e);
+                }
+                activeProducers--;
+            });
+        }
+#endif
+    }
+
+    bool PrecomputeBuffer::populate(uint32_t count)
+    {
+        if (publicKey == nullptr) {
+            throw std::runtime_error(
+              "PrecomputeBufferContext::populate() - elgamalPublicKey is null");
+        }
+
+        for (uint32_t i = 0; i < count; i++) {
+            if (!produceNext()) {
+                return true;
+            }
+        }
+        return false;
     }
 
-    void PrecomputeBuffer::stop() { isRunning = false; }
+    void PrecomputeBuffer::stop()
+    {
+        isRunning = false;
+        std::lock_guard<std::mutex> lock(producer_lock);
+        for (auto &producer : producers) {
+            producer.join();
+        }
+        producers.clear();
+    }
 
     uint32_t PrecomputeBuffer::getMaxQueueSize() { return maxQueueSize; }
 
@@ -290,10 +447,53 @@ namespace electionguard
 
     ElementModP *PrecomputeBuffer::getPublicKey() { return publicKey.get(); }
 
+    void PrecomputeBuffer::setProfile(const PrecomputeProfile &profile)
+    {
+        profileEncryptionsPerSelection = profile.getEncryptionsPerSelection();
+    }
+
+    PrecomputeStatus PrecomputeBuffer::getStatus()
+    {
+        PrecomputeStatus status;
+        {
+            std::lock_guard<std::mutex> lock(selection_queue_lock);
+            status.selections.size = static_cast<uint32_t>(selection_queue.size());
+        }
+        {
+            std::lock_guard<std::mutex> lock(encryption_queue_lock);
+            status.encryptions.size = static_cast<uint32_t>(encryption_queue.size());
+        }
+        status.selections.target = maxQueueSize;
+        status.selections.hits = selectionHits;
+        status.selections.misses = selectionMisses;
+        status.encryptions.target = getEncryptionTarget();
+        status.encryptions.hits = encryptionHits;
+        status.encryptions.misses = encryptionMisses;
+        status.encryptionsPerSelection = getEncryptionsPerSelection();
+        status.producers = activeProducers;
+        return status;
+    }
+
+    double PrecomputeBuffer::getEncryptionsPerSelection()
+    {
+        auto selections = static_cast<double>(selectionHits + selectionMisses);
+        auto encryptions = static_cast<double>(encryptionHits + encryptionMisses);
+        return (profileEncryptionsPerSelection * PROFILE_WEIGHT + encryptions) /
+               (PROFILE_WEIGHT + selections);
+    }
+
+    uint32_t PrecomputeBuffer::getEncryptionTarget()
+    {
+        // bound the triple queue so that a skewed mix cannot exhaust memory
+        auto target = std::ceil(getEncryptionsPerSelection() * maxQueueSize);
+        return static_cast<uint32_t>(std::min(target, 2.0 * maxQueueSize));
+    }
+
     std::unique_ptr<PrecomputedEncryption> PrecomputeBuffer::getPrecomputedEncryption()
     {
-        if (!encryption_queue.empty()) {
-            return popPrecomputedEncryption().value();
+        auto triple = popPrecomputedEncryption();
+        if (triple.has_value() && triple.value() != nullptr) {
+            return move(triple.value());
         }
         return make_unique<PrecomputedEncryption>(*publicKey);
     }
@@ -310,15 +510,23 @@ namespace electionguard
             encryption_queue.pop();
         }
 
+        if (result != nullptr) {
+            release(ENCRYPTION_BYTES);
+            encryptionHits++;
+            Metrics::increment(Metric::precomputeHits);
+        } else {
+            encryptionMisses++;
+            Metrics::increment(Metric::precomputeMisses);
+        }
         return result;
     }
 
     std::unique_ptr<PrecomputedSelection> PrecomputeBuffer::getPrecomputedSelection()
     {
-        if (!selection_queue.empty()) {
-            return popPrecomputedSelection().value();
+        auto quad = popPrecomputedSelection();
+        if (quad.has_value() && quad.value() != nullptr) {
+            return move(quad.value());
         }
-
         return createPrecomputedSelection(*publicKey);
     }
 
@@ -333,12 +541,21 @@ namespace electionguard
             selection_queue.pop();
         }
 
+        if (result != nullptr) {
+            release(SELECTION_BYTES);
+            selectionHits++;
+            Metrics::increment(Metric::precomputeHits);
+        } else {
+            selectionMisses++;
+            Metrics::increment(Metric::precomputeMisses);
+        }
         return result;
     }
 
     std::tuple<std::unique_ptr<PrecomputedEncryption>, std::unique_ptr<PrecomputedEncryption>>
     PrecomputeBuffer::createTwoPrecomputedEncryptions(const ElementModP &publicKey)
     {
+        EG_TRACE_SPAN("PrecomputeBuffer::createTwoPrecomputedEncryptions");
         auto triple1 = make_unique<PrecomputedEncryption>(publicKey);
         auto triple2 = make_unique<PrecomputedEncryption>(publicKey);
         return std::make_tuple(move(triple1), move(triple2));
@@ -346,6 +563,7 @@ namespace electionguard
     unique_ptr<PrecomputedSelection>
     PrecomputeBuffer::createPrecomputedSelection(const ElementModP &publicKey)
     {
+        EG_TRACE_SPAN("PrecomputeBuffer::createPrecomputedSelection");
         auto triple1 = make_unique<PrecomputedEncryption>(publicKey);
         auto triple2 = make_unique<PrecomputedEncryption>(publicKey);
         auto quad = make_unique<PrecomputedFakeDisjuctiveCommitments>(publicKey);
@@ -356,11 +574,42 @@ namespace electionguard
 
 #pragma region PrecomputeBufferContext
 
+    // a few limbs are enough to tell the registered keys apart before comparing the whole key
+    static uint64_t getFingerprint(const ElementModP &publicKey)
+    {
+        const auto *data = publicKey.cget();
+        return data[0] ^ (data[1] * 0x9E3779B97F4A7C15ULL) ^ data[MAX_P_LEN - 1];
+    }
+
+    std::shared_ptr<PrecomputeBuffer>
+    PrecomputeBufferContext::find(const ElementModP &publicKey, uint64_t fingerprint) const
+    {
+        for (const auto &entry : _buffers) {
+            if (entry.fingerprint == fingerprint && *entry.buffer->getPublicKey() == publicKey) {
+                return entry.buffer;
+            }
+        }
+        return nullptr;
+    }
+
+    std::shared_ptr<PrecomputeBuffer> PrecomputeBufferContext::getCurrent()
+    {
+        auto &instance = getInstance();
+        std::lock_guard<std::mutex> lock(instance._mutex);
+        return instance._current;
+    }
+
     void PrecomputeBufferContext::clear()
     {
-        if (getInstance()._instance != nullptr) {
-            getInstance()._instance->clear();
-            getInstance()._instance = nullptr;
+        auto &instance = getInstance();
+        std::vector<Entry> buffers;
+        {
+            std::lock_guard<std::mutex> lock(instance._mutex);
+            buffers.swap(instance._buffers);
+            instance._current = nullptr;
+        }
+        for (auto &entry : buffers) {
+            entry.buffer->clear();
         }
     }
 
@@ -368,107 +617,190 @@ namespace electionguard
                                              uint32_t maxQueueSize /* = 0 */)
     {
         clear();
-        getInstance()._instance = make_unique<PrecomputeBuffer>(publicKey, maxQueueSize);
+        add(publicKey, maxQueueSize);
+    }
+
+    void PrecomputeBufferContext::add(const ElementModP &publicKey,
+                                      uint32_t maxQueueSize /* = 0 */)
+    {
+        auto &instance = getInstance();
+        auto fingerprint = getFingerprint(publicKey);
+        std::lock_guard<std::mutex> lock(instance._mutex);
+        auto buffer = instance.find(publicKey, fingerprint);
+        if (buffer == nullptr) {
+            buffer = std::make_shared<PrecomputeBuffer>(publicKey, maxQueueSize, instance.budget);
+            instance._buffers.push_back({fingerprint, buffer});
+        }
+        instance._current = buffer;
+    }
+
+    void PrecomputeBufferContext::remove(const ElementModP &publicKey)
+    {
+        auto &instance = getInstance();
+        auto fingerprint = getFingerprint(publicKey);
+        std::shared_ptr<PrecomputeBuffer> removed;
+        {
+            std::lock_guard<std::mutex> lock(instance._mutex);
+            removed = instance.find(publicKey, fingerprint);
+            auto &buffers = instance._buffers;
+            buffers.erase(std::remove_if(buffers.begin(), buffers.end(),
+                                         [&removed](const Entry &entry) {
+                                             return entry.buffer == removed;
+                                         }),
+                          buffers.end());
+            if (instance._current == removed) {
+                instance._current = buffers.empty() ? nullptr : buffers.back().buffer;
+            }
+        }
+        if (removed != nullptr) {
+            removed->clear();
+        }
     }
 
     void PrecomputeBufferContext::start()
     {
-        if (getInstance()._instance == nullptr) {
+        auto &instance = getInstance();
+        std::vector<std::shared_ptr<PrecomputeBuffer>> buffers;
+        {
+            std::lock_guard<std::mutex> lock(instance._mutex);
+            for (const auto &entry : instance._buffers) {
+                buffers.push_back(entry.buffer);
+            }
+        }
+        if (buffers.empty()) {
             throw std::runtime_error("PrecomputeBufferContext::start() called before "
                                      "PrecomputeBufferContext::initialize()");
         }
-        getInstance()._instance->start();
+        for (auto &buffer : buffers) {
+            buffer->start();
+        }
     }
 
     void PrecomputeBufferContext::start(const ElementModP &elgamalPublicKey)
     {
-        if (getInstance()._instance == nullptr) {
-            getInstance()._instance = make_unique<PrecomputeBuffer>(elgamalPublicKey);
-        } else if (*getInstance()._instance->getPublicKey() != elgamalPublicKey) {
-            getInstance()._instance->clear();
-            getInstance()._instance = make_unique<PrecomputeBuffer>(elgamalPublicKey);
-        }
-        getInstance()._instance->start();
+        add(elgamalPublicKey);
+        getBuffer(elgamalPublicKey)->start();
+    }
+
+    void PrecomputeBufferContext::startAsync(const ElementModP &elgamalPublicKey,
+                                             uint32_t concurrency /* = 1 */)
+    {
+        add(elgamalPublicKey);
+        getBuffer(elgamalPublicKey)->startAsync(concurrency);
     }
 
-    void PrecomputeBufferContext::startAsync(const ElementModP &elgamalPublicKey)
+    bool PrecomputeBufferContext::populate(uint32_t count)
     {
-        if (getInstance()._instance == nullptr) {
-            getInstance()._instance = make_unique<PrecomputeBuffer>(elgamalPublicKey);
-        } else if (*getInstance()._instance->getPublicKey() != elgamalPublicKey) {
-            getInstance()._instance->clear();
-            getInstance()._instance = make_unique<PrecomputeBuffer>(elgamalPublicKey);
+        auto current = getCurrent();
+        if (current == nullptr) {
+            throw std::runtime_error("PrecomputeBufferContext::populate() called before "
+                                     "PrecomputeBufferContext::initialize()");
         }
-        getInstance()._instance->startAsync();
+        return current->populate(count);
     }
 
     void PrecomputeBufferContext::stop()
     {
-        if (getInstance()._instance != nullptr) {
-            getInstance()._instance->stop();
+        auto &instance = getInstance();
+        std::lock_guard<std::mutex> lock(instance._mutex);
+        for (auto &entry : instance._buffers) {
+            entry.buffer->stop();
         }
     }
 
     uint32_t PrecomputeBufferContext::getMaxQueueSize()
     {
-        if (getInstance()._instance == nullptr) {
-            return 0;
-        }
-        return getInstance()._instance->getMaxQueueSize();
+        auto current = getCurrent();
+        return current == nullptr ? 0 : current->getMaxQueueSize();
     }
 
     uint32_t PrecomputeBufferContext::getCurrentQueueSize()
     {
-        if (getInstance()._instance == nullptr) {
-            return 0;
-        }
-        return getInstance()._instance->getCurrentQueueSize();
+        auto current = getCurrent();
+        return current == nullptr ? 0 : current->getCurrentQueueSize();
     }
 
     ElementModP *PrecomputeBufferContext::getPublicKey()
     {
-        if (getInstance()._instance != nullptr) {
-            return getInstance()._instance->getPublicKey();
+        auto current = getCurrent();
+        return current == nullptr ? nullptr : current->getPublicKey();
+    }
+
+    std::shared_ptr<PrecomputeBuffer>
+    PrecomputeBufferContext::getBuffer(const ElementModP &publicKey)
+    {
+        auto &instance = getInstance();
+        auto fingerprint = getFingerprint(publicKey);
+        std::lock_guard<std::mutex> lock(instance._mutex);
+        return instance.find(publicKey, fingerprint);
+    }
+
+    size_t PrecomputeBufferContext::getBufferCount()
+    {
+        auto &instance = getInstance();
+        std::lock_guard<std::mutex> lock(instance._mutex);
+        return instance._buffers.size();
+    }
+
+    void PrecomputeBufferContext::setMemoryBudget(uint64_t bytes)
+    {
+        getInstance().budget->setLimit(bytes);
+    }
+
+    uint64_t PrecomputeBufferContext::getMemoryUsage() { return getInstance().budget->getUsed(); }
+
+    void PrecomputeBufferContext::setProfile(const PrecomputeProfile &profile)
+    {
+        if (auto current = getCurrent()) {
+            current->setProfile(profile);
         }
-        return nullptr;
+    }
+
+    PrecomputeStatus PrecomputeBufferContext::getStatus()
+    {
+        auto current = getCurrent();
+        return current == nullptr ? PrecomputeStatus() : current->getStatus();
     }
 
     std::unique_ptr<PrecomputedEncryption> PrecomputeBufferContext::getPrecomputedEncryption()
     {
-        if (getInstance()._instance != nullptr) {
-            return getInstance()._instance->getPrecomputedEncryption();
-        }
-        return nullptr;
+        auto current = getCurrent();
+        return current == nullptr ? nullptr : current->getPrecomputedEncryption();
     }
 
     std::optional<std::unique_ptr<PrecomputedEncryption>>
     PrecomputeBufferContext::popPrecomputedEncryption()
     {
-        if (getInstance()._instance != nullptr) {
-            return getInstance()._instance->popPrecomputedEncryption();
+        if (auto current = getCurrent()) {
+            return current->popPrecomputedEncryption();
         }
         return std::nullopt;
     }
 
-    std::unique_ptr<PrecomputedSelection> PrecomputeBufferContext::getPrecomputedSelection()
+    std::optional<std::unique_ptr<PrecomputedEncryption>>
+    PrecomputeBufferContext::popPrecomputedEncryption(const ElementModP &publicKey)
     {
-        if (getInstance()._instance != nullptr) {
-            return getInstance()._instance->getPrecomputedSelection();
+        if (auto buffer = getBuffer(publicKey)) {
+            return buffer->popPrecomputedEncryption();
         }
-        return nullptr;
+        return std::nullopt;
+    }
+
+    std::unique_ptr<PrecomputedSelection> PrecomputeBufferContext::getPrecomputedSelection()
+    {
+        auto current = getCurrent();
+        return current == nullptr ? nullptr : current->getPrecomputedSelection();
     }
 
     std::optional<std::unique_ptr<PrecomputedSelection>>
     PrecomputeBufferContext::popPrecomputedSelection()
     {
-        if (getInstance()._instance != nullptr) {
-            return getInstance()._instance->popPrecomputedSelection();
+        if (auto current = getCurrent()) {
+            return current->popPrecomputedSelection();
         }
         return std::nullopt;
     }
 
-    //std::mutex PrecomputeBufferContext::_lock;
-
 #pragma endregion
 
 } // namespace electionguard
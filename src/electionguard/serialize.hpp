@@ -16,6 +16,7 @@
 #include <memory>
 #include <nlohmann/json.hpp>
 #include <regex>
+#include <stdexcept>
 #include <unordered_map>
 
 using electionguard::G;
@@ -23,7 +24,9 @@ using electionguard::P;
 using electionguard::Q;
 using electionguard::R;
 using nlohmann::json;
+using std::invalid_argument;
 using std::make_unique;
+using std::out_of_range;
 using std::reference_wrapper;
 using std::regex;
 using std::regex_replace;
@@ -501,6 +504,294 @@ namespace electionguard
         return elements;
     }
 
+#pragma endregion
+
+#pragma region Binary Helpers
+
+    /// <summary>
+    /// The binary wire format is a compact, versioned alternative to the JSON based
+    /// formats for large objects such as ballots.  Every payload begins with a fixed
+    /// schema header followed by the object body:
+    ///
+    ///   magic (4 bytes) | version (u16) | kind (u8) | flags (u8) | p width (u16) | q width (u16)
+    ///
+    /// All integers are big endian.  Group elements are written as raw fixed width
+    /// big endian values (MAX_P_SIZE bytes for ElementModP, MAX_Q_SIZE bytes for ElementModQ)
+    /// so that they can be read directly out of the buffer without any hex conversion.
+    /// Strings and byte arrays are prefixed with a u32 length.
+    /// </summary>
+    static const uint8_t BINARY_FORMAT_MAGIC[] = {'E', 'G', 'B', 'F'};
+    static const uint16_t BINARY_FORMAT_VERSION = 1;
+    static const size_t BINARY_FORMAT_HEADER_SIZE = 12;
+
+    /// <summary>
+    /// The binary header flag indicating the payload includes the secret nonce values
+    /// </summary>
+    static const uint8_t BINARY_FORMAT_FLAG_WITH_NONCES = 0x01;
+
+    enum class BinaryObjectKind : uint8_t {
+        ciphertextBallot = 1,
+        submittedBallot = 2,
+        compactCiphertextBallot = 3,
+    };
+
+    /// <summary>
+    /// A read only view of a fixed width big endian element inside of a binary buffer.
+    /// The view does not own the memory it points to and is only valid for the lifetime
+    /// of the buffer.  Elements are materialized directly from the view into limbs.
+    /// </summary>
+    struct BinaryElementView {
+        const uint8_t *data;
+        size_t size;
+
+        unique_ptr<ElementModP> toElementModP(bool unchecked = false) const
+        {
+            uint64_t limbs[MAX_P_LEN] = {};
+            toLimbs(static_cast<uint64_t *>(limbs), MAX_P_LEN);
+            return make_unique<ElementModP>(limbs, unchecked);
+        }
+
+        unique_ptr<ElementModQ> toElementModQ(bool unchecked = false) const
+        {
+            uint64_t limbs[MAX_Q_LEN] = {};
+            toLimbs(static_cast<uint64_t *>(limbs), MAX_Q_LEN);
+            return make_unique<ElementModQ>(limbs, unchecked);
+        }
+
+      private:
+        void toLimbs(uint64_t *limbs, size_t length) const
+        {
+            // limbs are stored least significant first
+            for (size_t i = 0; i < length; i++) {
+                const auto *bytes = data + (length - 1 - i) * sizeof(uint64_t);
+                uint64_t limb = 0;
+                for (size_t j = 0; j < sizeof(uint64_t); j++) {
+                    limb = (limb << 8) | bytes[j];
+                }
+                limbs[i] = limb;
+            }
+        }
+    };
+
+    /// <summary>
+    /// Writes values into a growable buffer using the binary wire format
+    /// </summary>
+    class BinaryWriter
+    {
+      public:
+        explicit BinaryWriter(size_t capacity = 0) { buffer.reserve(capacity); }
+
+        void writeHeader(BinaryObjectKind kind, uint8_t flags)
+        {
+            buffer.insert(buffer.end(), begin(BINARY_FORMAT_MAGIC), end(BINARY_FORMAT_MAGIC));
+            writeUint16(BINARY_FORMAT_VERSION);
+            writeUint8(static_cast<uint8_t>(kind));
+            writeUint8(flags);
+            writeUint16(static_cast<uint16_t>(MAX_P_SIZE));
+            writeUint16(static_cast<uint16_t>(MAX_Q_SIZE));
+        }
+
+        void writeUint8(uint8_t value) { buffer.push_back(value); }
+
+        void writeUint16(uint16_t value) { writeBigEndian(value, sizeof(uint16_t)); }
+
+        void writeUint32(uint32_t value) { writeBigEndian(value, sizeof(uint32_t)); }
+
+        void writeUint64(uint64_t value) { writeBigEndian(value, sizeof(uint64_t)); }
+
+        void writeBool(bool value) { writeUint8(value ? 1 : 0); }
+
+        void writeString(const string &value)
+        {
+            writeLength(value.size());
+            buffer.insert(buffer.end(), value.begin(), value.end());
+        }
+
+        void writeBytes(const vector<uint8_t> &value)
+        {
+            writeLength(value.size());
+            buffer.insert(buffer.end(), value.begin(), value.end());
+        }
+
+        void writeElementModP(const ElementModP &element) { writeLimbs(element.cget(), MAX_P_LEN); }
+
+        void writeElementModQ(const ElementModQ &element) { writeLimbs(element.cget(), MAX_Q_LEN); }
+
+        void writeLength(size_t length)
+        {
+            if (length > UINT32_MAX) {
+                throw out_of_range("binary length exceeds the maximum size: " +
+                                   to_string(length));
+            }
+            writeUint32(static_cast<uint32_t>(length));
+        }
+
+        vector<uint8_t> release() { return move(buffer); }
+
+      private:
+        void writeBigEndian(uint64_t value, size_t width)
+        {
+            for (size_t i = width; i > 0; i--) {
+                buffer.push_back(static_cast<uint8_t>(value >> ((i - 1) * 8)));
+            }
+        }
+
+        void writeLimbs(const uint64_t *limbs, size_t length)
+        {
+            // most significant limb first
+            for (size_t i = length; i > 0; i--) {
+                writeBigEndian(limbs[i - 1], sizeof(uint64_t));
+            }
+        }
+
+        vector<uint8_t> buffer;
+    };
+
+    /// <summary>
+    /// Reads values out of a caller owned buffer using the binary wire format.
+    /// The reader never copies the underlying buffer.
+    /// </summary>
+    class BinaryReader
+    {
+      public:
+        BinaryReader(const uint8_t *data, size_t size) : data(data), size(size), offset(0)
+        {
+            if (data == nullptr && size > 0) {
+                throw invalid_argument("binary data cannot be null");
+            }
+        }
+
+        /// <summary>
+        /// Read and validate the schema header, returning the flags
+        /// </summary>
+        uint8_t readHeader(BinaryObjectKind expectedKind)
+        {
+            require(BINARY_FORMAT_HEADER_SIZE);
+            if (memcmp(data + offset, static_cast<const uint8_t *>(BINARY_FORMAT_MAGIC),
+                       sizeof(BINARY_FORMAT_MAGIC)) != 0) {
+                throw invalid_argument("binary data is not in the expected format");
+            }
+            offset += sizeof(BINARY_FORMAT_MAGIC);
+
+            auto version = readUint16();
+            if (version != BINARY_FORMAT_VERSION) {
+                throw invalid_argument("unsupported binary format version: " +
+                                       to_string(version));
+            }
+            auto kind = readUint8();
+            if (kind != static_cast<uint8_t>(expectedKind)) {
+                throw invalid_argument("unexpected binary object kind: " + to_string(kind));
+            }
+            auto flags = readUint8();
+            auto pWidth = readUint16();
+            auto qWidth = readUint16();
+            if (pWidth != MAX_P_SIZE || qWidth != MAX_Q_SIZE) {
+                throw invalid_argument("binary element widths do not match this build");
+            }
+            return flags;
+        }
+
+        uint8_t readUint8()
+        {
+            require(sizeof(uint8_t));
+            return data[offset++];
+        }
+
+        uint16_t readUint16() { return static_cast<uint16_t>(readBigEndian(sizeof(uint16_t))); }
+
+        uint32_t readUint32() { return static_cast<uint32_t>(readBigEndian(sizeof(uint32_t))); }
+
+        uint64_t readUint64() { return readBigEndian(sizeof(uint64_t)); }
+
+        bool readBool() { return readUint8() != 0; }
+
+        BallotBoxState readBallotBoxState()
+        {
+            auto value = readUint64();
+            // the states are ints, so compare before the cast can truncate the value
+            if (value > static_cast<uint64_t>(BallotBoxState::unknown)) {
+                throw invalid_argument("unknown binary ballot box state: " + to_string(value));
+            }
+            switch (static_cast<BallotBoxState>(value)) {
+                case BallotBoxState::notset:
+                case BallotBoxState::cast:
+                case BallotBoxState::challenged:
+                case BallotBoxState::spoiled:
+                case BallotBoxState::unknown:
+                    return static_cast<BallotBoxState>(value);
+            }
+            throw invalid_argument("unknown binary ballot box state: " + to_string(value));
+        }
+
+        string readString()
+        {
+            auto length = readUint32();
+            require(length);
+            string result(reinterpret_cast<const char *>(data + offset), length);
+            offset += length;
+            return result;
+        }
+
+        vector<uint8_t> readBytes()
+        {
+            auto length = readUint32();
+            require(length);
+            vector<uint8_t> result(data + offset, data + offset + length);
+            offset += length;
+            return result;
+        }
+
+        BinaryElementView readElementModP() { return readView(MAX_P_SIZE); }
+
+        BinaryElementView readElementModQ() { return readView(MAX_Q_SIZE); }
+
+        /// <summary>
+        /// Read a collection count, validating that the remaining buffer
+        /// could hold at least that many items of the minimum size
+        /// </summary>
+        uint32_t readCount(size_t minimumItemSize)
+        {
+            auto count = readUint32();
+            if (minimumItemSize > 0 && count > (size - offset) / minimumItemSize) {
+                throw out_of_range("binary collection count exceeds the remaining data");
+            }
+            return count;
+        }
+
+        bool isAtEnd() const { return offset == size; }
+
+      private:
+        void require(size_t length) const
+        {
+            if (length > size - offset) {
+                throw out_of_range("binary data is truncated at offset: " + to_string(offset));
+            }
+        }
+
+        uint64_t readBigEndian(size_t width)
+        {
+            require(width);
+            uint64_t value = 0;
+            for (size_t i = 0; i < width; i++) {
+                value = (value << 8) | data[offset + i];
+            }
+            offset += width;
+            return value;
+        }
+
+        BinaryElementView readView(size_t width)
+        {
+            require(width);
+            BinaryElementView view{data + offset, width};
+            offset += width;
+            return view;
+        }
+
+        const uint8_t *data;
+        size_t size;
+        size_t offset;
+    };
+
 #pragma endregion
 
     class Serialize
@@ -1399,6 +1690,181 @@ namespace electionguard
                   ElementModQ::fromHex(crypto_hash), state);
             }
 
+            static void writeProof(BinaryWriter &writer, const RangedChaumPedersenProof &proof)
+            {
+                writer.writeUint64(proof.getRangeLimit());
+                writer.writeElementModQ(*proof.getChallenge());
+
+                // the integer proofs are written in index order and the commitments
+                // are omitted to match the behavior of the json serializer
+                auto proofs = proof.getProofs();
+                writer.writeLength(proofs.size());
+                for (const auto &integerProof : proofs) {
+                    writer.writeElementModQ(*integerProof.get().challenge);
+                    writer.writeElementModQ(*integerProof.get().response);
+                }
+            }
+
+            static unique_ptr<RangedChaumPedersenProof> readProof(BinaryReader &reader)
+            {
+                auto rangeLimit = reader.readUint64();
+                auto challenge = reader.readElementModQ().toElementModQ();
+
+                auto count = reader.readCount(MAX_Q_SIZE * 2);
+                map<uint64_t, unique_ptr<ZeroKnowledgeProof>> integerProofs;
+                for (uint64_t index = 0; index < count; index++) {
+                    auto proofChallenge = reader.readElementModQ().toElementModQ();
+                    auto proofResponse = reader.readElementModQ().toElementModQ();
+                    integerProofs[index] =
+                      make_unique<ZeroKnowledgeProof>(move(proofChallenge), move(proofResponse));
+                }
+
+                return make_unique<RangedChaumPedersenProof>(rangeLimit, move(challenge),
+                                                             move(integerProofs));
+            }
+
+            static unique_ptr<ElementModQ> readNonce(BinaryReader &reader, bool withNonces)
+            {
+                if (withNonces) {
+                    return reader.readElementModQ().toElementModQ();
+                }
+                return make_unique<ElementModQ>(ZERO_MOD_Q());
+            }
+
+            static size_t binarySizeHint(const electionguard::CiphertextBallot &serializable)
+            {
+                // each selection carries two elements mod p and each contest carries three
+                size_t size = BINARY_FORMAT_HEADER_SIZE + 8 * MAX_Q_SIZE;
+                for (const auto &contest : serializable.getContests()) {
+                    size += 3 * MAX_P_SIZE + 16 * MAX_Q_SIZE;
+                    size += contest.get().getSelections().size() *
+                            (2 * MAX_P_SIZE + 16 * MAX_Q_SIZE);
+                }
+                return size;
+            }
+
+            static void writeBinary(BinaryWriter &writer,
+                                    const electionguard::CiphertextBallot &serializable,
+                                    bool withNonces)
+            {
+                writer.writeString(serializable.getObjectId());
+                writer.writeString(serializable.getStyleId());
+                writer.writeUint64(static_cast<uint64_t>(serializable.getState()));
+                writer.writeElementModQ(*serializable.getManifestHash());
+                writer.writeElementModQ(*serializable.getBallotCodeSeed());
+                writer.writeElementModQ(*serializable.getBallotCode());
+                writer.writeUint64(serializable.getTimestamp());
+                writer.writeElementModQ(*serializable.getCryptoHash());
+                if (withNonces) {
+                    writer.writeElementModQ(*serializable.getNonce());
+                }
+
+                auto contests = serializable.getContests();
+                writer.writeLength(contests.size());
+                for (const auto &contest : contests) {
+                    writer.writeString(contest.get().getObjectId());
+                    writer.writeUint64(contest.get().getSequenceOrder());
+                    writer.writeElementModQ(*contest.get().getDescriptionHash());
+                    writer.writeElementModP(*contest.get().getCiphertextAccumulation()->getPad());
+                    writer.writeElementModP(*contest.get().getCiphertextAccumulation()->getData());
+                    writer.writeElementModQ(*contest.get().getCryptoHash());
+                    writeProof(writer, *contest.get().getProof());
+
+                    auto extendedData = contest.get().getHashedElGamalCiphertext();
+                    writer.writeElementModP(*extendedData->getPad());
+                    writer.writeBytes(extendedData->getData());
+                    writer.writeBytes(extendedData->getMac());
+
+                    if (withNonces) {
+                        writer.writeElementModQ(*contest.get().getNonce());
+                    }
+
+                    auto selections = contest.get().getSelections();
+                    writer.writeLength(selections.size());
+                    for (const auto &selection : selections) {
+                        writer.writeString(selection.get().getObjectId());
+                        writer.writeUint64(selection.get().getSequenceOrder());
+                        writer.writeElementModQ(*selection.get().getDescriptionHash());
+                        writer.writeElementModP(*selection.get().getCiphertext()->getPad());
+                        writer.writeElementModP(*selection.get().getCiphertext()->getData());
+                        writer.writeBool(selection.get().getIsPlaceholder());
+                        writer.writeElementModQ(*selection.get().getCryptoHash());
+                        writeProof(writer, *selection.get().getProof());
+                        if (withNonces) {
+                            writer.writeElementModQ(*selection.get().getNonce());
+                        }
+                    }
+                }
+            }
+
+            static unique_ptr<electionguard::CiphertextBallot> readBinary(BinaryReader &reader,
+                                                                          bool withNonces)
+            {
+                auto objectId = reader.readString();
+                auto styleId = reader.readString();
+                auto serializedState = reader.readBallotBoxState();
+                auto manifestHash = reader.readElementModQ().toElementModQ();
+                auto codeSeed = reader.readElementModQ().toElementModQ();
+                auto ballotCode = reader.readElementModQ().toElementModQ();
+                auto timestamp = reader.readUint64();
+                auto cryptoHash = reader.readElementModQ().toElementModQ();
+                auto ballotNonce = readNonce(reader, withNonces);
+
+                auto contestCount = reader.readCount(3 * MAX_P_SIZE);
+                vector<unique_ptr<CiphertextBallotContest>> contests;
+                contests.reserve(contestCount);
+                for (uint32_t c = 0; c < contestCount; c++) {
+                    auto contestObjectId = reader.readString();
+                    auto contestSequenceOrder = reader.readUint64();
+                    auto contestDescriptionHash = reader.readElementModQ().toElementModQ();
+                    auto accumulationPad = reader.readElementModP().toElementModP();
+                    auto accumulationData = reader.readElementModP().toElementModP();
+                    auto contestCryptoHash = reader.readElementModQ().toElementModQ();
+                    auto contestProof = readProof(reader);
+
+                    auto extendedDataPad = reader.readElementModP().toElementModP();
+                    auto extendedDataData = reader.readBytes();
+                    auto extendedDataMac = reader.readBytes();
+                    auto extendedData = make_unique<HashedElGamalCiphertext>(
+                      move(extendedDataPad), move(extendedDataData), move(extendedDataMac));
+
+                    auto contestNonce = readNonce(reader, withNonces);
+
+                    auto selectionCount = reader.readCount(2 * MAX_P_SIZE);
+                    vector<unique_ptr<CiphertextBallotSelection>> selections;
+                    selections.reserve(selectionCount);
+                    for (uint32_t s = 0; s < selectionCount; s++) {
+                        auto selectionObjectId = reader.readString();
+                        auto selectionSequenceOrder = reader.readUint64();
+                        auto selectionDescriptionHash = reader.readElementModQ().toElementModQ();
+                        auto pad = reader.readElementModP().toElementModP();
+                        auto data = reader.readElementModP().toElementModP();
+                        auto isPlaceholder = reader.readBool();
+                        auto selectionCryptoHash = reader.readElementModQ().toElementModQ();
+                        auto selectionProof = readProof(reader);
+                        auto selectionNonce = readNonce(reader, withNonces);
+
+                        selections.push_back(make_unique<CiphertextBallotSelection>(
+                          selectionObjectId, selectionSequenceOrder, *selectionDescriptionHash,
+                          make_unique<ElGamalCiphertext>(move(pad), move(data)), isPlaceholder,
+                          move(selectionNonce), move(selectionCryptoHash), move(selectionProof)));
+                    }
+
+                    contests.push_back(make_unique<CiphertextBallotContest>(
+                      contestObjectId, contestSequenceOrder, *contestDescriptionHash,
+                      move(selections), move(contestNonce),
+                      make_unique<ElGamalCiphertext>(move(accumulationPad), move(accumulationData)),
+                      move(contestCryptoHash), move(contestProof), move(extendedData)));
+                }
+
+                auto state = serializedState == BallotBoxState::notset ? BallotBoxState::unknown
+                                                                       : serializedState;
+
+                return make_unique<electionguard::CiphertextBallot>(
+                  objectId, styleId, *manifestHash, move(codeSeed), move(contests),
+                  move(ballotCode), timestamp, move(ballotNonce), move(cryptoHash), state);
+            }
+
           public:
             static vector<uint8_t> toBson(const electionguard::CiphertextBallot &serializable,
                                           bool withNonces)
@@ -1427,6 +1893,26 @@ namespace electionguard
             {
                 return toObject(json::from_msgpack(data));
             }
+            static vector<uint8_t> toBinary(const electionguard::CiphertextBallot &serializable,
+                                            bool withNonces)
+            {
+                BinaryWriter writer(binarySizeHint(serializable));
+                writer.writeHeader(BinaryObjectKind::ciphertextBallot,
+                                   withNonces ? BINARY_FORMAT_FLAG_WITH_NONCES : 0);
+                writeBinary(writer, serializable, withNonces);
+                return writer.release();
+            }
+            static unique_ptr<electionguard::CiphertextBallot> fromBinary(const uint8_t *data,
+                                                                          size_t size)
+            {
+                BinaryReader reader(data, size);
+                auto flags = reader.readHeader(BinaryObjectKind::ciphertextBallot);
+                auto result = readBinary(reader, (flags & BINARY_FORMAT_FLAG_WITH_NONCES) != 0);
+                if (!reader.isAtEnd()) {
+                    throw invalid_argument("unexpected trailing binary data");
+                }
+                return result;
+            }
         };
 
         class SubmittedBallot
@@ -1442,6 +1928,21 @@ namespace electionguard
                 {
                     return CiphertextBallot::toObject(j);
                 }
+                static void writeBinaryWrapper(BinaryWriter &writer,
+                                               const electionguard::CiphertextBallot &serializable)
+                {
+                    CiphertextBallot::writeBinary(writer, serializable, false);
+                }
+                static unique_ptr<electionguard::CiphertextBallot>
+                readBinaryWrapper(BinaryReader &reader)
+                {
+                    return CiphertextBallot::readBinary(reader, false);
+                }
+                static size_t
+                binarySizeHintWrapper(const electionguard::CiphertextBallot &serializable)
+                {
+                    return CiphertextBallot::binarySizeHint(serializable);
+                }
             };
 
           private:
@@ -1487,6 +1988,25 @@ namespace electionguard
             {
                 return toObject(json::from_msgpack(data));
             }
+            static vector<uint8_t> toBinary(const electionguard::SubmittedBallot &serializable)
+            {
+                BinaryWriter writer(SubmittedBallotWrapper::binarySizeHintWrapper(serializable));
+                writer.writeHeader(BinaryObjectKind::submittedBallot, 0);
+                SubmittedBallotWrapper::writeBinaryWrapper(writer, serializable);
+                return writer.release();
+            }
+            static unique_ptr<electionguard::SubmittedBallot> fromBinary(const uint8_t *data,
+                                                                         size_t size)
+            {
+                BinaryReader reader(data, size);
+                reader.readHeader(BinaryObjectKind::submittedBallot);
+                auto ciphertext = SubmittedBallotWrapper::readBinaryWrapper(reader);
+                if (!reader.isAtEnd()) {
+                    throw invalid_argument("unexpected trailing binary data");
+                }
+                // TODO: make this a move instead of a copy
+                return electionguard::SubmittedBallot::from(*ciphertext, ciphertext->getState());
+            }
         };
 
         class CompactCiphertextBallot
@@ -1564,6 +2084,71 @@ namespace electionguard
             {
                 return toObject(json::from_msgpack(data));
             }
+            static vector<uint8_t>
+            toBinary(const electionguard::CompactCiphertextBallot &serializable)
+            {
+                auto *plaintext = serializable.getPlaintext();
+                auto selections = plaintext->getSelections();
+                auto writeIns = plaintext->getWriteIns();
+
+                BinaryWriter writer(BINARY_FORMAT_HEADER_SIZE + 3 * MAX_Q_SIZE +
+                                    selections.size() * sizeof(uint64_t) + 128);
+                writer.writeHeader(BinaryObjectKind::compactCiphertextBallot, 0);
+
+                writer.writeString(plaintext->getObjectId());
+                writer.writeString(plaintext->getStyleId());
+                writer.writeLength(selections.size());
+                for (auto selection : selections) {
+                    writer.writeUint64(selection);
+                }
+                writer.writeLength(writeIns.size());
+                for (const auto &writeIn : writeIns) {
+                    writer.writeString(writeIn);
+                }
+
+                writer.writeElementModQ(*serializable.getBallotCodeSeed());
+                writer.writeElementModQ(*serializable.getBallotCode());
+                writer.writeElementModQ(*serializable.getNonce());
+                writer.writeUint64(serializable.getTimestamp());
+                writer.writeUint64(static_cast<uint64_t>(serializable.getBallotBoxState()));
+                return writer.release();
+            }
+            static unique_ptr<electionguard::CompactCiphertextBallot>
+            fromBinary(const uint8_t *data, size_t size)
+            {
+                BinaryReader reader(data, size);
+                reader.readHeader(BinaryObjectKind::compactCiphertextBallot);
+
+                auto objectId = reader.readString();
+                auto styleId = reader.readString();
+                auto selectionCount = reader.readCount(sizeof(uint64_t));
+                vector<uint64_t> selections;
+                selections.reserve(selectionCount);
+                for (uint32_t i = 0; i < selectionCount; i++) {
+                    selections.push_back(reader.readUint64());
+                }
+                auto writeInCount = reader.readCount(sizeof(uint32_t));
+                vector<string> writeIns;
+                writeIns.reserve(writeInCount);
+                for (uint32_t i = 0; i < writeInCount; i++) {
+                    writeIns.push_back(reader.readString());
+                }
+
+                auto codeSeed = reader.readElementModQ().toElementModQ();
+                auto ballotCode = reader.readElementModQ().toElementModQ();
+                auto nonce = reader.readElementModQ().toElementModQ();
+                auto timestamp = reader.readUint64();
+                auto ballotBoxState = reader.readBallotBoxState();
+                if (!reader.isAtEnd()) {
+                    throw invalid_argument("unexpected trailing binary data");
+                }
+
+                auto plaintext = make_unique<electionguard::CompactPlaintextBallot>(
+                  objectId, styleId, move(selections), move(writeIns));
+                return make_unique<electionguard::CompactCiphertextBallot>(
+                  move(plaintext), ballotBoxState, move(codeSeed), move(ballotCode), timestamp,
+                  move(nonce));
+            }
         };
 
         class Constants
@@ -0,0 +1,450 @@
+#include "sha256.hpp"
+
+#include "../../libs/hacl/Hacl_Streaming_SHA2.hpp"
+#include "cpu_features.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+#ifdef EG_CPU_X64
+#    include <immintrin.h>
+#    if defined(_MSC_VER) && !defined(__clang__)
+#        define SHA_NI_TARGET
+#        define AVX2_TARGET
+#    else
+#        define SHA_NI_TARGET __attribute__((target("sha,sse4.1")))
+#        define AVX2_TARGET __attribute__((target("avx2")))
+#    endif
+#endif
+
+using hacl::StreamingSHA2;
+using hacl::StreamingSHA2Mode;
+using std::string;
+using std::vector;
+
+namespace electionguard
+{
+    constexpr size_t BLOCK_SIZE = 64;
+    // the padding appends a 0x80 marker byte and the 64-bit message length in bits
+    constexpr size_t PADDING_SIZE = 9;
+    constexpr size_t STATE_WORDS = 8;
+    constexpr size_t LANES = 8;
+
+    static const uint32_t INITIAL_STATE[STATE_WORDS] = {0x6a09e667, 0xbb67ae85, 0x3c6ef372,
+                                                        0xa54ff53a, 0x510e527f, 0x9b05688c,
+                                                        0x1f83d9ab, 0x5be0cd19};
+
+    static const uint32_t ROUND_CONSTANTS[64] = {
+      0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4,
+      0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe,
+      0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f,
+      0x4a7484aa, 0x5cb0a9dc, 0x76f988da, 0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+      0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc,
+      0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+      0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070, 0x19a4c116,
+      0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+      0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7,
+      0xc67178f2};
+
+    static Sha256Engine detectEngine()
+    {
+        return Sha256::isSupported(Sha256Engine::shaNi) ? Sha256Engine::shaNi
+                                                         : Sha256Engine::portable;
+    }
+
+    static Sha256Engine detectBatchEngine()
+    {
+        // a single sha extensions stream outpaces eight avx2 lanes,
+        // so the lanes are only used on machines without the extensions
+        if (Sha256::isSupported(Sha256Engine::shaNi)) {
+            return Sha256Engine::shaNi;
+        }
+        return Sha256::isSupported(Sha256Engine::avx2) ? Sha256Engine::avx2
+                                                        : Sha256Engine::portable;
+    }
+
+    Sha256Engine Sha256::engine = detectEngine();
+    Sha256Engine Sha256::batchEngine = detectBatchEngine();
+
+#pragma region Padding
+
+    static size_t paddedBlocks(size_t length) { return (length + PADDING_SIZE + 63) / BLOCK_SIZE; }
+
+    /// <summary>
+    /// Write the padded trailing blocks of a message: the bytes after the last full block,
+    /// the marker and the big endian bit length. Returns the number of trailing blocks.
+    /// </summary>
+    static size_t padTail(const uint8_t *message, size_t length, uint8_t *tail)
+    {
+        auto full = length / BLOCK_SIZE * BLOCK_SIZE;
+        auto remaining = length - full;
+        auto blocks = remaining + PADDING_SIZE > BLOCK_SIZE ? 2 : 1;
+        memset(tail, 0, blocks * BLOCK_SIZE);
+        if (remaining > 0) {
+            memcpy(tail, message + full, remaining);
+        }
+        tail[remaining] = 0x80;
+        auto bits = static_cast<uint64_t>(length) * 8;
+        for (size_t i = 0; i < 8; i++) {
+            tail[blocks * BLOCK_SIZE - 1 - i] = static_cast<uint8_t>(bits >> (8 * i));
+        }
+        return blocks;
+    }
+
+    static void writeDigest(const uint32_t *state, uint8_t *digest)
+    {
+        for (size_t i = 0; i < STATE_WORDS; i++) {
+            digest[4 * i] = static_cast<uint8_t>(state[i] >> 24);
+            digest[4 * i + 1] = static_cast<uint8_t>(state[i] >> 16);
+            digest[4 * i + 2] = static_cast<uint8_t>(state[i] >> 8);
+            digest[4 * i + 3] = static_cast<uint8_t>(state[i]);
+        }
+    }
+
+#pragma endregion
+
+#pragma region Portable
+
+    static void hashPortable(const uint8_t *message, size_t length, uint8_t *digest)
+    {
+        StreamingSHA2 sha2(StreamingSHA2Mode::SHA2_256);
+        sha2.update(const_cast<uint8_t *>(message), static_cast<uint32_t>(length));
+        sha2.finish(digest);
+    }
+
+#pragma endregion
+
+#ifdef EG_CPU_X64
+
+#    pragma region SHA Extensions
+
+    /// <summary>
+    /// Compute the next four schedule words from the previous sixteen
+    /// </summary>
+    SHA_NI_TARGET static inline __m128i scheduleShaNi(__m128i w0, __m128i w1, __m128i w2,
+                                                      __m128i w3)
+    {
+        auto words = _mm_sha256msg1_epu32(w0, w1);
+        words = _mm_add_epi32(words, _mm_alignr_epi8(w3, w2, 4));
+        return _mm_sha256msg2_epu32(words, w3);
+    }
+
+    /// <summary>
+    /// Run four rounds over the state held as ABEF and CDGH
+    /// </summary>
+    SHA_NI_TARGET static inline void roundsShaNi(__m128i &abef, __m128i &cdgh, __m128i words,
+                                                 size_t round)
+    {
+        const auto *constants = reinterpret_cast<const __m128i *>(&ROUND_CONSTANTS[round]);
+        auto message = _mm_add_epi32(words, _mm_loadu_si128(constants));
+        cdgh = _mm_sha256rnds2_epu32(cdgh, abef, message);
+        message = _mm_shuffle_epi32(message, 0x0E);
+        abef = _mm_sha256rnds2_epu32(abef, cdgh, message);
+    }
+
+    SHA_NI_TARGET static void compressShaNi(uint32_t *state, const uint8_t *data, size_t blocks)
+    {
+        const auto byteSwap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+        // rearrange the state into the ABEF and CDGH order the instructions use
+        auto dcba = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&state[0]));
+        auto hgfe = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&state[4]));
+        auto cdab = _mm_shuffle_epi32(dcba, 0xB1);
+        auto efgh = _mm_shuffle_epi32(hgfe, 0x1B);
+        auto abef = _mm_alignr_epi8(cdab, efgh, 8);
+        auto cdgh = _mm_blend_epi16(efgh, cdab, 0xF0);
+
+        for (size_t block = 0; block < blocks; block++) {
+            const auto *input = reinterpret_cast<const __m128i *>(data + block * BLOCK_SIZE);
+            auto savedAbef = abef;
+            auto savedCdgh = cdgh;
+
+            auto w0 = _mm_shuffle_epi8(_mm_loadu_si128(&input[0]), byteSwap);
+            roundsShaNi(abef, cdgh, w0, 0);
+            auto w1 = _mm_shuffle_epi8(_mm_loadu_si128(&input[1]), byteSwap);
+            roundsShaNi(abef, cdgh, w1, 4);
+            auto w2 = _mm_shuffle_epi8(_mm_loadu_si128(&input[2]), byteSwap);
+            roundsShaNi(abef, cdgh, w2, 8);
+            auto w3 = _mm_shuffle_epi8(_mm_loadu_si128(&input[3]), byteSwap);
+            roundsShaNi(abef, cdgh, w3, 12);
+
+            for (size_t round = 16; round < 64; round += 16) {
+                w0 = scheduleShaNi(w0, w1, w2, w3);
+                roundsShaNi(abef, cdgh, w0, round);
+                w1 = scheduleShaNi(w1, w2, w3, w0);
+                roundsShaNi(abef, cdgh, w1, round + 4);
+                w2 = scheduleShaNi(w2, w3, w0, w1);
+                roundsShaNi(abef, cdgh, w2, round + 8);
+                w3 = scheduleShaNi(w3, w0, w1, w2);
+                roundsShaNi(abef, cdgh, w3, round + 12);
+            }
+
+            abef = _mm_add_epi32(abef, savedAbef);
+            cdgh = _mm_add_epi32(cdgh, savedCdgh);
+        }
+
+        auto feba = _mm_shuffle_epi32(abef, 0x1B);
+        auto dchg = _mm_shuffle_epi32(cdgh, 0xB1);
+        dcba = _mm_blend_epi16(feba, dchg, 0xF0);
+        hgfe = _mm_alignr_epi8(dchg, feba, 8);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(&state[0]), dcba);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(&state[4]), hgfe);
+    }
+
+    static void hashShaNi(const uint8_t *message, size_t length, uint8_t *digest)
+    {
+        uint32_t state[STATE_WORDS];
+        memcpy(state, INITIAL_STATE, sizeof(state));
+
+        compressShaNi(state, message, length / BLOCK_SIZE);
+        uint8_t tail[2 * BLOCK_SIZE];
+        auto tailBlocks = padTail(message, length, tail);
+        compressShaNi(state, tail, tailBlocks);
+
+        writeDigest(state, digest);
+    }
+
+#    pragma endregion
+
+#    pragma region AVX2 Lanes
+
+    AVX2_TARGET static inline __m256i rotr(__m256i x, int n)
+    {
+        return _mm256_or_si256(_mm256_srli_epi32(x, n), _mm256_slli_epi32(x, 32 - n));
+    }
+
+    /// <summary>
+    /// Load the sixteen words of a block from each lane and transpose them
+    /// so each vector holds the same word for every lane
+    /// </summary>
+    AVX2_TARGET static void loadWordsAvx2(const uint8_t *const *blocks, __m256i *words)
+    {
+        const auto byteSwap = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13,
+                                               12, 3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14,
+                                               13, 12);
+        for (size_t half = 0; half < 2; half++) {
+            __m256i rows[LANES];
+            for (size_t lane = 0; lane < LANES; lane++) {
+                rows[lane] = _mm256_loadu_si256(
+                  reinterpret_cast<const __m256i *>(blocks[lane] + half * BLOCK_SIZE / 2));
+            }
+
+            __m256i pairs[LANES];
+            for (size_t i = 0; i < LANES; i += 2) {
+                pairs[i] = _mm256_unpacklo_epi32(rows[i], rows[i + 1]);
+                pairs[i + 1] = _mm256_unpackhi_epi32(rows[i], rows[i + 1]);
+            }
+            __m256i quads[LANES];
+            for (size_t i = 0; i < LANES; i += 4) {
+                quads[i] = _mm256_unpacklo_epi64(pairs[i], pairs[i + 2]);
+                quads[i + 1] = _mm256_unpackhi_epi64(pairs[i], pairs[i + 2]);
+                quads[i + 2] = _mm256_unpacklo_epi64(pairs[i + 1], pairs[i + 3]);
+                quads[i + 3] = _mm256_unpackhi_epi64(pairs[i + 1], pairs[i + 3]);
+            }
+            auto *out = &words[half * LANES];
+            for (size_t i = 0; i < 4; i++) {
+                out[i] = _mm256_shuffle_epi8(
+                  _mm256_permute2x128_si256(quads[i], quads[i + 4], 0x20), byteSwap);
+                out[i + 4] = _mm256_shuffle_epi8(
+                  _mm256_permute2x128_si256(quads[i], quads[i + 4], 0x31), byteSwap);
+            }
+        }
+    }
+
+    /// <summary>
+    /// Compress one block in every lane, keeping the previous state of inactive lanes
+    /// </summary>
+    AVX2_TARGET static void compressAvx2(__m256i *state, const uint8_t *const *blocks,
+                                         __m256i active)
+    {
+        __m256i w[16];
+        loadWordsAvx2(blocks, w);
+
+        auto a = state[0];
+        auto b = state[1];
+        auto c = state[2];
+        auto d = state[3];
+        auto e = state[4];
+        auto f = state[5];
+        auto g = state[6];
+        auto h = state[7];
+
+        for (size_t round = 0; round < 64; round++) {
+            if (round >= 16) {
+                auto w15 = w[(round - 15) & 15];
+                auto w2 = w[(round - 2) & 15];
+                auto s0 = _mm256_xor_si256(_mm256_xor_si256(rotr(w15, 7), rotr(w15, 18)),
+                                           _mm256_srli_epi32(w15, 3));
+                auto s1 = _mm256_xor_si256(_mm256_xor_si256(rotr(w2, 17), rotr(w2, 19)),
+                                           _mm256_srli_epi32(w2, 10));
+                w[round & 15] = _mm256_add_epi32(
+                  _mm256_add_epi32(w[round & 15], s0),
+                  _mm256_add_epi32(w[(round - 7) & 15], s1));
+            }
+
+            auto sum1 = _mm256_xor_si256(_mm256_xor_si256(rotr(e, 6), rotr(e, 11)), rotr(e, 25));
+            auto choose = _mm256_xor_si256(_mm256_and_si256(e, f), _mm256_andnot_si256(e, g));
+            auto constant = _mm256_set1_epi32(static_cast<int32_t>(ROUND_CONSTANTS[round]));
+            auto t1 = _mm256_add_epi32(_mm256_add_epi32(h, sum1),
+                                       _mm256_add_epi32(_mm256_add_epi32(choose, constant),
+                                                        w[round & 15]));
+            auto sum0 = _mm256_xor_si256(_mm256_xor_si256(rotr(a, 2), rotr(a, 13)), rotr(a, 22));
+            auto majority = _mm256_or_si256(_mm256_and_si256(a, b),
+                                            _mm256_and_si256(c, _mm256_or_si256(a, b)));
+            auto t2 = _mm256_add_epi32(sum0, majority);
+
+            h = g;
+            g = f;
+            f = e;
+            e = _mm256_add_epi32(d, t1);
+            d = c;
+            c = b;
+            b = a;
+            a = _mm256_add_epi32(t1, t2);
+        }
+
+        __m256i working[STATE_WORDS] = {a, b, c, d, e, f, g, h};
+        for (size_t i = 0; i < STATE_WORDS; i++) {
+            auto next = _mm256_add_epi32(state[i], working[i]);
+            state[i] = _mm256_blendv_epi8(state[i], next, active);
+        }
+    }
+
+    /// <summary>
+    /// Hash up to eight messages in the lanes of avx2 registers.
+    /// Unused lanes repeat the first message and their digests are discarded.
+    /// </summary>
+    AVX2_TARGET static void hashLanesAvx2(const string *const *messages, size_t count,
+                                          uint8_t *const *digests)
+    {
+        // pad every message into one buffer so each lane reads whole blocks
+        size_t blockCounts[LANES];
+        size_t offsets[LANES];
+        size_t totalBlocks = 0;
+        size_t maxBlocks = 0;
+        for (size_t lane = 0; lane < LANES; lane++) {
+            const auto &message = *messages[lane < count ? lane : 0];
+            blockCounts[lane] = paddedBlocks(message.size());
+            offsets[lane] = totalBlocks * BLOCK_SIZE;
+            totalBlocks += blockCounts[lane];
+            maxBlocks = std::max(maxBlocks, blockCounts[lane]);
+        }
+        vector<uint8_t> padded(totalBlocks * BLOCK_SIZE);
+        for (size_t lane = 0; lane < LANES; lane++) {
+            const auto &message = *messages[lane < count ? lane : 0];
+            const auto *bytes = reinterpret_cast<const uint8_t *>(message.data());
+            auto full = message.size() / BLOCK_SIZE * BLOCK_SIZE;
+            if (full > 0) {
+                memcpy(&padded[offsets[lane]], bytes, full);
+            }
+            padTail(bytes, message.size(), &padded[offsets[lane] + full]);
+        }
+
+        __m256i state[STATE_WORDS];
+        for (size_t i = 0; i < STATE_WORDS; i++) {
+            state[i] = _mm256_set1_epi32(static_cast<int32_t>(INITIAL_STATE[i]));
+        }
+
+        const uint8_t *blocks[LANES];
+        alignas(32) int32_t activeLanes[LANES];
+        for (size_t block = 0; block < maxBlocks; block++) {
+            for (size_t lane = 0; lane < LANES; lane++) {
+                // finished lanes reread their last block and keep their state
+                auto isActive = block < blockCounts[lane];
+                auto index = isActive ? block : blockCounts[lane] - 1;
+                blocks[lane] = &padded[offsets[lane] + index * BLOCK_SIZE];
+                activeLanes[lane] = isActive ? -1 : 0;
+            }
+            auto active = _mm256_load_si256(reinterpret_cast<const __m256i *>(activeLanes));
+            compressAvx2(state, blocks, active);
+        }
+
+        alignas(32) uint32_t words[STATE_WORDS][LANES];
+        for (size_t i = 0; i < STATE_WORDS; i++) {
+            _mm256_store_si256(reinterpret_cast<__m256i *>(words[i]), state[i]);
+        }
+        for (size_t lane = 0; lane < count; lane++) {
+            uint32_t laneState[STATE_WORDS];
+            for (size_t i = 0; i < STATE_WORDS; i++) {
+                laneState[i] = words[i][lane];
+            }
+            writeDigest(laneState, digests[lane]);
+        }
+    }
+
+#    pragma endregion
+
+#endif
+
+    bool Sha256::isSupported(Sha256Engine engine)
+    {
+        switch (engine) {
+            case Sha256Engine::portable:
+                return true;
+            case Sha256Engine::shaNi:
+                return CpuFeatures::hasShaNi();
+            case Sha256Engine::avx2:
+                return CpuFeatures::hasAvx2();
+        }
+        return false;
+    }
+
+    /// <summary>
+    /// Hash a message with a single stream engine, falling back to the portable engine
+    /// </summary>
+    static void hashWith(Sha256Engine engine, const uint8_t *message, size_t length,
+                         uint8_t *digest)
+    {
+#ifdef EG_CPU_X64
+        if (engine == Sha256Engine::shaNi && Sha256::isSupported(Sha256Engine::shaNi)) {
+            hashShaNi(message, length, digest);
+            return;
+        }
+#endif
+        hashPortable(message, length, digest);
+    }
+
+    bool Sha256::isBatchParallel()
+    {
+        return batchEngine == Sha256Engine::avx2 && isSupported(Sha256Engine::avx2);
+    }
+
+    void Sha256::hash(const uint8_t *message, size_t length, uint8_t *digest)
+    {
+        hashWith(engine, message, length, digest);
+    }
+
+    void Sha256::hashMany(const vector<string> &messages, uint8_t *digests)
+    {
+#ifdef EG_CPU_X64
+        if (isBatchParallel() && messages.size() > 1) {
+            // group messages of similar length so the lanes finish together
+            vector<size_t> order(messages.size());
+            std::iota(order.begin(), order.end(), 0);
+            std::stable_sort(order.begin(), order.end(), [&messages](size_t lhs, size_t rhs) {
+                return paddedBlocks(messages[lhs].size()) < paddedBlocks(messages[rhs].size());
+            });
+
+            for (size_t hashed = 0; hashed < order.size(); hashed += LANES) {
+                auto count = std::min(LANES, order.size() - hashed);
+                const string *lanes[LANES];
+                uint8_t *laneDigests[LANES];
+                for (size_t lane = 0; lane < count; lane++) {
+                    lanes[lane] = &messages[order[hashed + lane]];
+                    laneDigests[lane] = digests + order[hashed + lane] * DIGEST_SIZE;
+                }
+                hashLanesAvx2(static_cast<const string *const *>(lanes), count,
+                              static_cast<uint8_t *const *>(laneDigests));
+            }
+            return;
+        }
+#endif
+        auto single = batchEngine == Sha256Engine::avx2 ? engine : batchEngine;
+        for (size_t hashed = 0; hashed < messages.size(); hashed++) {
+            const auto &message = messages[hashed];
+            hashWith(single, reinterpret_cast<const uint8_t *>(message.data()), message.size(),
+                     digests + hashed * DIGEST_SIZE);
+        }
+    }
+} // namespace electionguard
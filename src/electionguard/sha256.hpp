@@ -0,0 +1,80 @@
+#ifndef __ELECTIONGUARD_CPP_SHA256_HPP_INCLUDED__
+#define __ELECTIONGUARD_CPP_SHA256_HPP_INCLUDED__
+
+#include <cstddef>
+#include <cstdint>
+#include <electionguard/export.h>
+#include <string>
+#include <vector>
+
+namespace electionguard
+{
+    /// <summary>
+    /// The implementations available for SHA-256
+    /// </summary>
+    enum class Sha256Engine {
+        /// <summary>
+        /// The hacl streaming sha2 routines, one message at a time
+        /// </summary>
+        portable = 0,
+        /// <summary>
+        /// The x86 sha extensions, one message at a time
+        /// </summary>
+        shaNi = 1,
+        /// <summary>
+        /// Eight independent messages hashed together in the lanes of avx2 registers.
+        /// Only applies to batches; single messages use the best single stream engine.
+        /// </summary>
+        avx2 = 2,
+    };
+
+    /// <summary>
+    /// SHA-256 over complete messages, with runtime dispatch to the fastest engine
+    /// the machine supports.
+    ///
+    /// Hashing a batch of independent messages lets the multi-buffer engine fill its lanes,
+    /// which is how nonce sequences and per-selection hashes are derived in bulk.
+    /// </summary>
+    class EG_INTERNAL_API Sha256
+    {
+      public:
+        static constexpr size_t DIGEST_SIZE = 32;
+
+        /// <summary>
+        /// The engine used for single messages. Detected at startup.
+        /// Selecting an engine the machine does not support falls back to the portable engine.
+        /// </summary>
+        static Sha256Engine engine;
+
+        /// <summary>
+        /// The engine used for batches of messages. Detected at startup, preferring
+        /// the sha extensions and using the avx2 lanes on machines without them.
+        /// Selecting an engine the machine does not support falls back to the portable engine.
+        /// </summary>
+        static Sha256Engine batchEngine;
+
+        /// <summary>
+        /// Check whether the cpu and the operating system support an engine
+        /// </summary>
+        static bool isSupported(Sha256Engine engine);
+
+        /// <summary>
+        /// Check whether batches are hashed together in parallel lanes
+        /// rather than one message at a time
+        /// </summary>
+        static bool isBatchParallel();
+
+        /// <summary>
+        /// Hash a message, writing DIGEST_SIZE bytes to the digest
+        /// </summary>
+        static void hash(const uint8_t *message, size_t length, uint8_t *digest);
+
+        /// <summary>
+        /// Hash independent messages, writing DIGEST_SIZE bytes per message to the digests
+        /// in the same order as the messages
+        /// </summary>
+        static void hashMany(const std::vector<std::string> &messages, uint8_t *digests);
+    };
+} // namespace electionguard
+
+#endif /* __ELECTIONGUARD_CPP_SHA256_HPP_INCLUDED__ */
@@ -7,8 +7,12 @@ set(FACADES_electionguard
     ${PROJECT_SOURCE_DIR}/src/electionguard/facades/bignum256.hpp
     ${PROJECT_SOURCE_DIR}/src/electionguard/facades/bignum4096.cpp
     ${PROJECT_SOURCE_DIR}/src/electionguard/facades/bignum4096.hpp
+    ${PROJECT_SOURCE_DIR}/src/electionguard/facades/bignum4096_backend.cpp
+    ${PROJECT_SOURCE_DIR}/src/electionguard/facades/bignum4096_backend.hpp
+    ${PROJECT_SOURCE_DIR}/src/electionguard/facades/bignum4096_ifma.cpp
     ${PROJECT_SOURCE_DIR}/src/electionguard/facades/chaum_pedersen.cpp
     ${PROJECT_SOURCE_DIR}/src/electionguard/facades/collections.c
+    ${PROJECT_SOURCE_DIR}/src/electionguard/facades/decrypt.cpp
     ${PROJECT_SOURCE_DIR}/src/electionguard/facades/discrete_log.cpp
     ${PROJECT_SOURCE_DIR}/src/electionguard/facades/election.cpp
     ${PROJECT_SOURCE_DIR}/src/electionguard/facades/elgamal.cpp
@@ -17,9 +21,11 @@ set(FACADES_electionguard
     ${PROJECT_SOURCE_DIR}/src/electionguard/facades/group.cpp
     ${PROJECT_SOURCE_DIR}/src/electionguard/facades/hash.cpp
     ${PROJECT_SOURCE_DIR}/src/electionguard/facades/manifest.cpp
+    ${PROJECT_SOURCE_DIR}/src/electionguard/facades/metrics.cpp
     ${PROJECT_SOURCE_DIR}/src/electionguard/facades/nonces.cpp
     ${PROJECT_SOURCE_DIR}/src/electionguard/facades/polynomial.cpp
     ${PROJECT_SOURCE_DIR}/src/electionguard/facades/precompute_buffers.cpp
+    ${PROJECT_SOURCE_DIR}/src/electionguard/facades/tracing.cpp
 )
 
 set(SOURCES_electionguard
@@ -28,6 +34,9 @@ set(SOURCES_electionguard
     ${PROJECT_SOURCE_DIR}/src/electionguard/ballot.cpp
     ${PROJECT_SOURCE_DIR}/src/electionguard/chaum_pedersen.cpp
     ${PROJECT_SOURCE_DIR}/src/electionguard/convert.cpp
+    ${PROJECT_SOURCE_DIR}/src/electionguard/cpu_features.cpp
+    ${PROJECT_SOURCE_DIR}/src/electionguard/cpu_features.hpp
+    ${PROJECT_SOURCE_DIR}/src/electionguard/decrypt.cpp
     ${PROJECT_SOURCE_DIR}/src/electionguard/discrete_log.cpp
     ${PROJECT_SOURCE_DIR}/src/electionguard/election.cpp
     ${PROJECT_SOURCE_DIR}/src/electionguard/elgamal.cpp
@@ -40,11 +49,18 @@ set(SOURCES_electionguard
     ${PROJECT_SOURCE_DIR}/src/electionguard/log.cpp
     ${PROJECT_SOURCE_DIR}/src/electionguard/lookup_table.hpp
     ${PROJECT_SOURCE_DIR}/src/electionguard/manifest.cpp
+    ${PROJECT_SOURCE_DIR}/src/electionguard/metrics.cpp
     ${PROJECT_SOURCE_DIR}/src/electionguard/nonces.cpp
     ${PROJECT_SOURCE_DIR}/src/electionguard/precompute_buffers.cpp
     ${PROJECT_SOURCE_DIR}/src/electionguard/convert.hpp
     ${PROJECT_SOURCE_DIR}/src/electionguard/random.cpp
     ${PROJECT_SOURCE_DIR}/src/electionguard/random.hpp
+    ${PROJECT_SOURCE_DIR}/src/electionguard/sha256.cpp
+    ${PROJECT_SOURCE_DIR}/src/electionguard/sha256.hpp
+    ${PROJECT_SOURCE_DIR}/src/electionguard/table_memory.cpp
+    ${PROJECT_SOURCE_DIR}/src/electionguard/table_memory.hpp
+    ${PROJECT_SOURCE_DIR}/src/electionguard/trace_span.hpp
+    ${PROJECT_SOURCE_DIR}/src/electionguard/tracing.cpp
     ${PROJECT_SOURCE_DIR}/src/electionguard/utils.hpp
     ${PROJECT_SOURCE_DIR}/src/electionguard/variant_cast.hpp
 )
@@ -59,6 +75,7 @@ set(INCLUDES_electionguard_h
     ${PROJECT_SOURCE_DIR}/include/electionguard/chaum_pedersen.h
     ${PROJECT_SOURCE_DIR}/include/electionguard/constants.h
     ${PROJECT_SOURCE_DIR}/include/electionguard/collections.h
+    ${PROJECT_SOURCE_DIR}/include/electionguard/decrypt.h
     ${PROJECT_SOURCE_DIR}/include/electionguard/discrete_log.h
     ${PROJECT_SOURCE_DIR}/include/electionguard/election.h
     ${PROJECT_SOURCE_DIR}/include/electionguard/elgamal.h
@@ -68,10 +85,12 @@ set(INCLUDES_electionguard_h
     ${PROJECT_SOURCE_DIR}/include/electionguard/group.h
     ${PROJECT_SOURCE_DIR}/include/electionguard/hash.h
     ${PROJECT_SOURCE_DIR}/include/electionguard/manifest.h
+    ${PROJECT_SOURCE_DIR}/include/electionguard/metrics.h
     ${PROJECT_SOURCE_DIR}/include/electionguard/nonces.h
     ${PROJECT_SOURCE_DIR}/include/electionguard/polynomial.h
     ${PROJECT_SOURCE_DIR}/include/electionguard/precompute_buffers.h
     ${PROJECT_SOURCE_DIR}/include/electionguard/status.h
+    ${PROJECT_SOURCE_DIR}/include/electionguard/tracing.h
 )
 
 set(INCLUDES_electionguard_hpp
@@ -81,6 +100,7 @@ set(INCLUDES_electionguard_hpp
     ${PROJECT_SOURCE_DIR}/include/electionguard/ballot.hpp
     ${PROJECT_SOURCE_DIR}/include/electionguard/chaum_pedersen.hpp
     ${PROJECT_SOURCE_DIR}/include/electionguard/crypto_hashable.hpp
+    ${PROJECT_SOURCE_DIR}/include/electionguard/decrypt.hpp
     ${PROJECT_SOURCE_DIR}/include/electionguard/discrete_log.hpp
     ${PROJECT_SOURCE_DIR}/include/electionguard/election_object_base.hpp
     ${PROJECT_SOURCE_DIR}/include/electionguard/election.hpp
@@ -90,7 +110,9 @@ set(INCLUDES_electionguard_hpp
     ${PROJECT_SOURCE_DIR}/include/electionguard/group.hpp
     ${PROJECT_SOURCE_DIR}/include/electionguard/hash.hpp
     ${PROJECT_SOURCE_DIR}/include/electionguard/manifest.hpp
+    ${PROJECT_SOURCE_DIR}/include/electionguard/metrics.hpp
     ${PROJECT_SOURCE_DIR}/include/electionguard/nonces.hpp
     ${PROJECT_SOURCE_DIR}/include/electionguard/precompute_buffers.hpp
     ${PROJECT_SOURCE_DIR}/include/electionguard/polynomial.hpp
+    ${PROJECT_SOURCE_DIR}/include/electionguard/tracing.hpp
 )
@@ -0,0 +1,185 @@
+#include "table_memory.hpp"
+
+#include <new>
+
+#if defined(_WIN32)
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+#elif defined(__linux__)
+#    include <fstream>
+#    include <string>
+#    include <sys/mman.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#else
+#    include <cstring>
+#endif
+
+namespace electionguard
+{
+    static size_t roundUp(size_t size, size_t alignment)
+    {
+        return (size + alignment - 1) / alignment * alignment;
+    }
+
+#if defined(_WIN32)
+
+    TableMemory::TableMemory(size_t size, TableMemoryPolicy policy) : _size(size)
+    {
+        // windows has no transparent huge pages, and large pages need the
+        // lock pages in memory privilege, so fall back to regular pages without them
+        if (policy == TableMemoryPolicy::explicitHugePages) {
+            auto largePageSize = GetLargePageMinimum();
+            if (largePageSize > 0) {
+                _mappedSize = roundUp(size, largePageSize);
+                _data = VirtualAlloc(nullptr, _mappedSize,
+                                     MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+                if (_data != nullptr) {
+                    _policy = TableMemoryPolicy::explicitHugePages;
+                    return;
+                }
+            }
+        }
+
+        _mappedSize = size;
+        _data = VirtualAlloc(nullptr, _mappedSize, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+        if (_data == nullptr) {
+            throw std::bad_alloc();
+        }
+        _policy = TableMemoryPolicy::standard;
+    }
+
+    TableMemory::~TableMemory() { VirtualFree(_data, 0, MEM_RELEASE); }
+
+    uint32_t TableMemory::getCurrentNumaNode()
+    {
+        PROCESSOR_NUMBER processor;
+        GetCurrentProcessorNumberEx(&processor);
+        USHORT node = 0;
+        if (!GetNumaProcessorNodeEx(&processor, &node) || node == 0xFFFF) {
+            return 0;
+        }
+        return node;
+    }
+
+    uint32_t TableMemory::getNumaNodeCount()
+    {
+        static const uint32_t count = [] {
+            ULONG highest = 0;
+            if (!GetNumaHighestNodeNumber(&highest)) {
+                return 1U;
+            }
+            return static_cast<uint32_t>(highest) + 1U;
+        }();
+        return count;
+    }
+
+#elif defined(__linux__)
+
+    // the size of a huge page on x86-64 and the default on aarch64
+    constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+    static void *mapAnonymous(size_t size, int flags)
+    {
+        auto *data = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS | flags, -1, 0);
+        return data == MAP_FAILED ? nullptr : data;
+    }
+
+    TableMemory::TableMemory(size_t size, TableMemoryPolicy policy) : _size(size)
+    {
+#    ifdef MAP_HUGETLB
+        if (policy == TableMemoryPolicy::explicitHugePages) {
+            _mappedSize = roundUp(size, HUGE_PAGE_SIZE);
+            _data = mapAnonymous(_mappedSize, MAP_HUGETLB);
+            if (_data != nullptr) {
+                _policy = TableMemoryPolicy::explicitHugePages;
+                return;
+            }
+        }
+#    endif
+
+#    ifdef MADV_HUGEPAGE
+        if (policy != TableMemoryPolicy::standard) {
+            // over allocate so the table can start on a huge page boundary,
+            // then return the unaligned head and tail to the kernel
+            _mappedSize = roundUp(size, HUGE_PAGE_SIZE);
+            auto *mapped = static_cast<uint8_t *>(mapAnonymous(_mappedSize + HUGE_PAGE_SIZE, 0));
+            if (mapped != nullptr) {
+                auto address = reinterpret_cast<uintptr_t>(mapped);
+                auto *aligned = reinterpret_cast<uint8_t *>(roundUp(address, HUGE_PAGE_SIZE));
+                auto head = static_cast<size_t>(aligned - mapped);
+                if (head > 0) {
+                    munmap(mapped, head);
+                }
+                munmap(aligned + _mappedSize, HUGE_PAGE_SIZE - head);
+                _data = aligned;
+                _policy = madvise(_data, _mappedSize, MADV_HUGEPAGE) == 0
+                            ? TableMemoryPolicy::transparentHugePages
+                            : TableMemoryPolicy::standard;
+                return;
+            }
+        }
+#    endif
+
+        _mappedSize = size;
+        _data = mapAnonymous(_mappedSize, 0);
+        if (_data == nullptr) {
+            throw std::bad_alloc();
+        }
+        _policy = TableMemoryPolicy::standard;
+    }
+
+    TableMemory::~TableMemory() { munmap(_data, _mappedSize); }
+
+    uint32_t TableMemory::getCurrentNumaNode()
+    {
+#    ifdef SYS_getcpu
+        unsigned cpu = 0;
+        unsigned node = 0;
+        if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) {
+            return node;
+        }
+#    endif
+        return 0;
+    }
+
+    uint32_t TableMemory::getNumaNodeCount()
+    {
+        static const uint32_t count = [] {
+            // the online nodes are listed as ranges such as "0" or "0-1"
+            std::ifstream online("/sys/devices/system/node/online");
+            std::string nodes;
+            if (!(online >> nodes) || nodes.empty()) {
+                return 1U;
+            }
+            auto last = nodes.find_last_of("-,");
+            auto highest = std::stoul(last == std::string::npos ? nodes : nodes.substr(last + 1));
+            return static_cast<uint32_t>(highest) + 1U;
+        }();
+        return count;
+    }
+
+#else
+
+    // platforms without page level control use aligned heap memory
+    constexpr size_t TABLE_ALIGNMENT = 64;
+
+    TableMemory::TableMemory(size_t size, TableMemoryPolicy policy)
+        : _size(size), _mappedSize(size), _policy(TableMemoryPolicy::standard)
+    {
+        (void)policy;
+        _data = ::operator new(size, std::align_val_t(TABLE_ALIGNMENT));
+        std::memset(_data, 0, size);
+    }
+
+    TableMemory::~TableMemory() { ::operator delete(_data, std::align_val_t(TABLE_ALIGNMENT)); }
+
+    uint32_t TableMemory::getCurrentNumaNode() { return 0; }
+
+    uint32_t TableMemory::getNumaNodeCount() { return 1; }
+
+#endif
+} // namespace electionguard
@@ -0,0 +1,73 @@
+#ifndef __ELECTIONGUARD_CPP_TABLE_MEMORY_HPP_INCLUDED__
+#define __ELECTIONGUARD_CPP_TABLE_MEMORY_HPP_INCLUDED__
+
+#include <cstddef>
+#include <cstdint>
+#include <electionguard/export.h>
+
+namespace electionguard
+{
+    /// <summary>
+    /// How the storage of large, randomly accessed tables is allocated.
+    ///
+    /// A fixed base table spans thousands of 4 KiB pages, so most lookups miss the TLB.
+    /// Backing the table with huge pages lets a handful of TLB entries cover it.
+    /// </summary>
+    enum class TableMemoryPolicy {
+        /// <summary>
+        /// regular pages from the system allocator
+        /// </summary>
+        standard = 0,
+        /// <summary>
+        /// huge page aligned memory that the kernel is advised to back with
+        /// transparent huge pages. falls back to regular pages where unsupported.
+        /// </summary>
+        transparentHugePages = 1,
+        /// <summary>
+        /// memory from the reserved huge page pool (hugetlbfs on linux, large pages on windows).
+        /// falls back to transparent huge pages when the pool or the privilege is missing.
+        /// </summary>
+        explicitHugePages = 2,
+    };
+
+    /// <summary>
+    /// A block of zeroed memory allocated according to a TableMemoryPolicy.
+    ///
+    /// The pages are committed lazily by the operating system, so they are placed
+    /// on the NUMA node of the thread that first writes to them.
+    /// </summary>
+    class EG_INTERNAL_API TableMemory
+    {
+      public:
+        TableMemory(size_t size, TableMemoryPolicy policy);
+        TableMemory(const TableMemory &) = delete;
+        TableMemory &operator=(const TableMemory &) = delete;
+        ~TableMemory();
+
+        void *data() const { return _data; }
+        size_t size() const { return _size; }
+
+        /// <summary>
+        /// The policy that was actually applied after any fallbacks
+        /// </summary>
+        TableMemoryPolicy getPolicy() const { return _policy; }
+
+        /// <summary>
+        /// The NUMA node of the calling thread, or 0 when it cannot be determined
+        /// </summary>
+        static uint32_t getCurrentNumaNode();
+
+        /// <summary>
+        /// The number of NUMA nodes on the machine, at least 1
+        /// </summary>
+        static uint32_t getNumaNodeCount();
+
+      private:
+        void *_data = nullptr;
+        size_t _size = 0;
+        size_t _mappedSize = 0;
+        TableMemoryPolicy _policy = TableMemoryPolicy::standard;
+    };
+} // namespace electionguard
+
+#endif /* __ELECTIONGUARD_CPP_TABLE_MEMORY_HPP_INCLUDED__ */
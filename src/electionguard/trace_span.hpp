@@ -0,0 +1,43 @@
+#ifndef __ELECTIONGUARD_CPP_TRACE_SPAN_HPP_INCLUDED__
+#define __ELECTIONGUARD_CPP_TRACE_SPAN_HPP_INCLUDED__
+
+#include <cstdint>
+#include <electionguard/export.h>
+#include <electionguard/tracing.hpp>
+
+namespace electionguard
+{
+    /// <summary>
+    /// Records the time between its construction and destruction as a span
+    /// on the calling thread, when tracing is enabled.
+    ///
+    /// The name must outlive the trace, so use string literals.
+    /// Prefer EG_TRACE_SPAN, which removes the span when tracing is not compiled in.
+    /// </summary>
+    class EG_INTERNAL_API TraceSpan
+    {
+      public:
+        explicit TraceSpan(const char *name);
+        ~TraceSpan();
+
+        TraceSpan(const TraceSpan &) = delete;
+        TraceSpan &operator=(const TraceSpan &) = delete;
+
+      private:
+        const char *name;
+        uint64_t start = 0;
+        bool isRecording = false;
+    };
+} // namespace electionguard
+
+#define EG_TRACE_SPAN_CONCAT_INNER(a, b) a##b
+#define EG_TRACE_SPAN_CONCAT(a, b) EG_TRACE_SPAN_CONCAT_INNER(a, b)
+
+#ifdef EG_TRACING
+#    define EG_TRACE_SPAN(name)                                                                    \
+        ::electionguard::TraceSpan EG_TRACE_SPAN_CONCAT(traceSpan, __LINE__)(name)
+#else
+#    define EG_TRACE_SPAN(name) static_cast<void>(0)
+#endif
+
+#endif /* __ELECTIONGUARD_CPP_TRACE_SPAN_HPP_INCLUDED__ */
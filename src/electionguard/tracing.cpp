@@ -0,0 +1,204 @@
+#include "electionguard/tracing.hpp"
+
+#include "trace_span.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <nlohmann/json.hpp>
+#include <vector>
+
+using nlohmann::json;
+using std::atomic;
+using std::lock_guard;
+using std::make_shared;
+using std::memory_order_relaxed;
+using std::move;
+using std::mutex;
+using std::shared_ptr;
+using std::string;
+using std::vector;
+using std::chrono::duration_cast;
+using std::chrono::nanoseconds;
+using std::chrono::steady_clock;
+
+namespace electionguard
+{
+    struct TraceEvent {
+        const char *name;
+        uint64_t start;
+        uint64_t duration;
+    };
+
+    /// <summary>
+    /// The ring buffer of spans recorded by one thread
+    /// </summary>
+    struct ThreadTrace {
+        uint32_t threadId;
+        mutex lock;
+        vector<TraceEvent> events;
+        size_t next = 0;
+        bool isFull = false;
+        bool hasExited = false;
+
+        ThreadTrace(uint32_t threadId, size_t capacity) : threadId(threadId)
+        {
+            events.resize(capacity);
+        }
+
+        void record(const TraceEvent &event)
+        {
+            lock_guard<mutex> guard(lock);
+            if (events.empty()) {
+                return;
+            }
+            events[next] = event;
+            next = (next + 1) % events.size();
+            isFull = isFull || next == 0;
+        }
+
+        void reset(size_t capacity)
+        {
+            lock_guard<mutex> guard(lock);
+            events.assign(capacity, {});
+            next = 0;
+            isFull = false;
+        }
+    };
+
+    struct TraceRegistry {
+        mutex lock;
+        vector<shared_ptr<ThreadTrace>> threads;
+        uint32_t nextThreadId = 1;
+        atomic<size_t> capacity{Tracing::DEFAULT_THREAD_CAPACITY};
+        atomic<bool> isEnabled{false};
+        const steady_clock::time_point epoch = steady_clock::now();
+    };
+
+    static TraceRegistry &getRegistry()
+    {
+        // never destroyed so that threads can still retire their buffers during shutdown
+        static auto *instance = new TraceRegistry();
+        return *instance;
+    }
+
+    /// <summary>
+    /// Owns the calling thread's buffer and marks it exited when the thread ends,
+    /// so the spans can still be exported until the next clear
+    /// </summary>
+    struct ThreadTraceHandle {
+        shared_ptr<ThreadTrace> trace;
+
+        ThreadTraceHandle()
+        {
+            auto &registry = getRegistry();
+            lock_guard<mutex> guard(registry.lock);
+            trace = make_shared<ThreadTrace>(registry.nextThreadId++,
+                                             registry.capacity.load(memory_order_relaxed));
+            registry.threads.push_back(trace);
+        }
+
+        ~ThreadTraceHandle()
+        {
+            auto &registry = getRegistry();
+            lock_guard<mutex> guard(registry.lock);
+            trace->hasExited = true;
+        }
+    };
+
+    static ThreadTrace &getThreadTrace()
+    {
+        thread_local ThreadTraceHandle handle;
+        return *handle.trace;
+    }
+
+    static uint64_t getTimestamp()
+    {
+        auto elapsed = steady_clock::now() - getRegistry().epoch;
+        return static_cast<uint64_t>(duration_cast<nanoseconds>(elapsed).count());
+    }
+
+#pragma region TraceSpan
+
+    TraceSpan::TraceSpan(const char *name) : name(name)
+    {
+        if (Tracing::isEnabled()) {
+            isRecording = true;
+            start = getTimestamp();
+        }
+    }
+
+    TraceSpan::~TraceSpan()
+    {
+        if (isRecording) {
+            getThreadTrace().record({name, start, getTimestamp() - start});
+        }
+    }
+
+#pragma endregion
+
+#pragma region Tracing
+
+    bool Tracing::isCompiledIn()
+    {
+#ifdef EG_TRACING
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    bool Tracing::isEnabled() { return getRegistry().isEnabled.load(memory_order_relaxed); }
+
+    void Tracing::setEnabled(bool enabled)
+    {
+        getRegistry().isEnabled.store(enabled && isCompiledIn(), memory_order_relaxed);
+    }
+
+    void Tracing::setThreadCapacity(size_t capacity)
+    {
+        getRegistry().capacity.store(capacity, memory_order_relaxed);
+    }
+
+    void Tracing::clear()
+    {
+        auto &registry = getRegistry();
+        lock_guard<mutex> guard(registry.lock);
+        vector<shared_ptr<ThreadTrace>> running;
+        for (auto &trace : registry.threads) {
+            if (!trace->hasExited) {
+                trace->reset(registry.capacity.load(memory_order_relaxed));
+                running.push_back(trace);
+            }
+        }
+        registry.threads = move(running);
+    }
+
+    string Tracing::toChromeTraceJson()
+    {
+        auto events = json::array();
+        auto &registry = getRegistry();
+        lock_guard<mutex> guard(registry.lock);
+        for (auto &trace : registry.threads) {
+            lock_guard<mutex> traceGuard(trace->lock);
+            auto count = trace->isFull ? trace->events.size() : trace->next;
+            auto first = trace->isFull ? trace->next : 0;
+            for (size_t i = 0; i < count; i++) {
+                const auto &event = trace->events[(first + i) % trace->events.size()];
+                // the trace event format measures time in microseconds
+                events.push_back({{"name", event.name},
+                                  {"cat", "electionguard"},
+                                  {"ph", "X"},
+                                  {"ts", static_cast<double>(event.start) / 1000.0},
+                                  {"dur", static_cast<double>(event.duration) / 1000.0},
+                                  {"pid", 1},
+                                  {"tid", trace->threadId}});
+            }
+        }
+        json result = {{"traceEvents", events}, {"displayTimeUnit", "ns"}};
+        return result.dump();
+    }
+
+#pragma endregion
+} // namespace electionguard
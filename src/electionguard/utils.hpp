@@ -1,12 +1,16 @@
 #ifndef __ELECTIONGUARD_CPP_UTILS_HPP_INCLUDED__
 #define __ELECTIONGUARD_CPP_UTILS_HPP_INCLUDED__
 
+#include <array>
 #include <chrono>
+#include <cstdint>
+#include <electionguard/constants.h>
 #include <electionguard/export.h>
 #include <exception>
 #include <map>
 #include <stdexcept>
 
+using std::array;
 using std::map;
 using std::out_of_range;
 using std::chrono::duration;
@@ -4,6 +4,7 @@
 
 #include <emscripten/bind.h>
 #include <iostream>
+#include <thread>
 
 using namespace emscripten;
 using namespace electionguard;
@@ -12,16 +13,44 @@ using namespace std;
 // a marker class since the PrecomputeBufferContext is a singleton
 class PrecomputeBufferContextFacade
 {
+  public:
+    // whether the module was built with pthreads, so startAsync produces in web workers
+    static bool isThreaded()
+    {
+#ifdef __EMSCRIPTEN_PTHREADS__
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    static uint32_t getHardwareConcurrency() { return std::thread::hardware_concurrency(); }
 };
 
 EMSCRIPTEN_BINDINGS(electionguard)
 {
+    value_object<PrecomputeQueueStatus>("PrecomputeQueueStatus")
+      .field("size", &PrecomputeQueueStatus::size)
+      .field("target", &PrecomputeQueueStatus::target);
+
+    value_object<PrecomputeStatus>("PrecomputeStatus")
+      .field("selections", &PrecomputeStatus::selections)
+      .field("encryptions", &PrecomputeStatus::encryptions)
+      .field("encryptionsPerSelection", &PrecomputeStatus::encryptionsPerSelection)
+      .field("producers", &PrecomputeStatus::producers);
+
     class_<PrecomputeBufferContextFacade>("PrecomputeBufferContext")
       .class_function("clear", &PrecomputeBufferContext::clear)
       .class_function("initialize", &PrecomputeBufferContext::initialize)
+      .class_function("add", &PrecomputeBufferContext::add)
       .class_function("start", select_overload<void()>(&PrecomputeBufferContext::start))
       .class_function("startAsync", &PrecomputeBufferContext::startAsync)
+      .class_function("populate", &PrecomputeBufferContext::populate)
       .class_function("stop", &PrecomputeBufferContext::stop)
       .class_function("getMaxQueueSize", &PrecomputeBufferContext::getMaxQueueSize)
-      .class_function("getCurrentQueueSize", &PrecomputeBufferContext::getCurrentQueueSize);
-}
\ No newline at end of file
+      .class_function("getCurrentQueueSize", &PrecomputeBufferContext::getCurrentQueueSize)
+      .class_function("getStatus", &PrecomputeBufferContext::getStatus)
+      .class_function("isThreaded", &PrecomputeBufferContextFacade::isThreaded)
+      .class_function("getHardwareConcurrency",
+                      &PrecomputeBufferContextFacade::getHardwareConcurrency);
+}
@@ -121,3 +121,39 @@ BENCHMARK_DEFINE_F(ChaumPedersenFixture, CheckConstantChaumPedersen)(benchmark::
 
 BENCHMARK_REGISTER_F(ChaumPedersenFixture, CheckConstantChaumPedersen)
   ->Unit(benchmark::kMillisecond);
+
+// a cumulative or approval contest proves every value up to its limit, so the ranged proof
+// grows with the limit while each integer proof stays independent of the others
+BENCHMARK_DEFINE_F(ChaumPedersenFixture, MakeRangedChaumPedersen)(benchmark::State &state)
+{
+    auto limit = static_cast<uint64_t>(state.range(0));
+    auto concurrency = static_cast<size_t>(state.range(1));
+    for (auto _ : state) {
+        auto proof = RangedChaumPedersenProof::make(*message, *nonce, 1UL, limit,
+                                                    *keypair->getPublicKey(), ONE_MOD_Q(),
+                                                    "bench", *seed, concurrency);
+    }
+}
+
+BENCHMARK_REGISTER_F(ChaumPedersenFixture, MakeRangedChaumPedersen)
+  ->ArgsProduct({{1, 5, 20}, {1, 0}})
+  ->UseRealTime()
+  ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(ChaumPedersenFixture, CheckRangedChaumPedersen)(benchmark::State &state)
+{
+    auto limit = static_cast<uint64_t>(state.range(0));
+    auto concurrency = static_cast<size_t>(state.range(1));
+    auto proof = RangedChaumPedersenProof::make(*message, *nonce, 1UL, limit,
+                                                *keypair->getPublicKey(), ONE_MOD_Q(), "bench",
+                                                *seed);
+    for (auto _ : state) {
+        auto result =
+          proof->isValid(*message, *keypair->getPublicKey(), ONE_MOD_Q(), "bench", concurrency);
+    }
+}
+
+BENCHMARK_REGISTER_F(ChaumPedersenFixture, CheckRangedChaumPedersen)
+  ->ArgsProduct({{1, 5, 20}, {1, 0}})
+  ->UseRealTime()
+  ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,174 @@
+#include "../../../src/electionguard/convert.hpp"
+#include "../utils/constants.hpp"
+
+#include <benchmark/benchmark.h>
+#include <electionguard/constants.h>
+#include <electionguard/group.hpp>
+#include <electionguard/hash.hpp>
+#include <iomanip>
+#include <sstream>
+#include <string>
+
+using namespace electionguard;
+using namespace std;
+
+#pragma region Hex Codec
+
+/// <summary>
+/// The stream based encoder the codec replaces, kept as a reference point
+/// </summary>
+static string streamBytesToHex(const uint8_t *bytes, size_t size)
+{
+    stringstream stream;
+    stream << hex << uppercase;
+    for (size_t i = 0; i < size; i++) {
+        stream << setw(2) << setfill('0') << static_cast<uint16_t>(bytes[i]);
+    }
+    return stream.str();
+}
+
+class HexCodecFixture : public benchmark::Fixture
+{
+  public:
+    void SetUp(const ::benchmark::State &state)
+    {
+        p = make_unique<ElementModP>(LARGE_P_ARRAY_1, true);
+        q = make_unique<ElementModQ>(LARGE_Q_ARRAY_1, true);
+        pBytes = p->toBytes();
+        pHex = p->toHex();
+        qHex = q->toHex();
+    }
+
+    void TearDown(const ::benchmark::State &state) {}
+
+    unique_ptr<ElementModP> p;
+    unique_ptr<ElementModQ> q;
+    vector<uint8_t> pBytes;
+    string pHex;
+    string qHex;
+};
+
+BENCHMARK_DEFINE_F(HexCodecFixture, stream_encode_4096)(benchmark::State &state)
+{
+    for (auto _ : state) {
+        auto result = streamBytesToHex(pBytes.data(), pBytes.size());
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetBytesProcessed(state.iterations() * MAX_P_SIZE);
+}
+
+BENCHMARK_DEFINE_F(HexCodecFixture, hex_encode_4096)(benchmark::State &state)
+{
+    char out[MAX_P_SIZE * 2];
+    for (auto _ : state) {
+        hex_encode(pBytes.data(), pBytes.size(), static_cast<char *>(out));
+        benchmark::DoNotOptimize(out);
+    }
+    state.SetBytesProcessed(state.iterations() * MAX_P_SIZE);
+}
+
+BENCHMARK_DEFINE_F(HexCodecFixture, hex_decode_4096)(benchmark::State &state)
+{
+    uint8_t out[MAX_P_SIZE];
+    for (auto _ : state) {
+        hex_decode(pHex.data(), pHex.size(), static_cast<uint8_t *>(out));
+        benchmark::DoNotOptimize(out);
+    }
+    state.SetBytesProcessed(state.iterations() * MAX_P_SIZE);
+}
+
+BENCHMARK_DEFINE_F(HexCodecFixture, limbs_to_hex_4096)(benchmark::State &state)
+{
+    char out[MAX_P_SIZE * 2];
+    for (auto _ : state) {
+        limbs_to_hex(p->get(), MAX_P_LEN, static_cast<char *>(out));
+        benchmark::DoNotOptimize(out);
+    }
+    state.SetBytesProcessed(state.iterations() * MAX_P_SIZE);
+}
+
+BENCHMARK_DEFINE_F(HexCodecFixture, hex_to_limbs_4096)(benchmark::State &state)
+{
+    uint64_t out[MAX_P_LEN];
+    for (auto _ : state) {
+        hex_to_limbs(pHex.data(), pHex.size(), static_cast<uint64_t *>(out), MAX_P_LEN);
+        benchmark::DoNotOptimize(out);
+    }
+    state.SetBytesProcessed(state.iterations() * MAX_P_SIZE);
+}
+
+BENCHMARK_DEFINE_F(HexCodecFixture, ElementModP_toHex)(benchmark::State &state)
+{
+    for (auto _ : state) {
+        // a fresh element so the hex representation is not cached
+        auto element = make_unique<ElementModP>(LARGE_P_ARRAY_1, true);
+        auto result = element->toHex();
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+BENCHMARK_DEFINE_F(HexCodecFixture, ElementModP_fromHex)(benchmark::State &state)
+{
+    for (auto _ : state) {
+        auto result = ElementModP::fromHex(pHex, true);
+    }
+}
+
+BENCHMARK_DEFINE_F(HexCodecFixture, ElementModQ_toHex)(benchmark::State &state)
+{
+    for (auto _ : state) {
+        auto result = q->toHex();
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+BENCHMARK_DEFINE_F(HexCodecFixture, ElementModQ_fromHex)(benchmark::State &state)
+{
+    for (auto _ : state) {
+        auto result = ElementModQ::fromHex(qHex, true);
+    }
+}
+
+BENCHMARK_DEFINE_F(HexCodecFixture, hash_elems_ElementModP)(benchmark::State &state)
+{
+    for (auto _ : state) {
+        auto result = hash_elems({p.get(), p.get(), q.get()});
+    }
+}
+
+BENCHMARK_DEFINE_F(HexCodecFixture, ElementModP_toHex_cached)(benchmark::State &state)
+{
+    auto element = make_unique<ElementModP>(LARGE_P_ARRAY_1, true);
+    element->setIsCacheable(true);
+    for (auto _ : state) {
+        auto result = element->toHex();
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+BENCHMARK_DEFINE_F(HexCodecFixture, hash_elems_ElementModP_cached)(benchmark::State &state)
+{
+    auto cachedP = p->clone();
+    auto cachedQ = q->clone();
+    cachedP->setIsCacheable(true);
+    cachedQ->setIsCacheable(true);
+    for (auto _ : state) {
+        auto result = hash_elems({cachedP.get(), cachedP.get(), cachedQ.get()});
+    }
+}
+
+BENCHMARK_REGISTER_F(HexCodecFixture, stream_encode_4096)->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(HexCodecFixture, hex_encode_4096)->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(HexCodecFixture, hex_decode_4096)->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(HexCodecFixture, limbs_to_hex_4096)->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(HexCodecFixture, hex_to_limbs_4096)->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(HexCodecFixture, ElementModP_toHex)->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(HexCodecFixture, ElementModP_fromHex)->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(HexCodecFixture, ElementModQ_toHex)->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(HexCodecFixture, ElementModQ_fromHex)->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(HexCodecFixture, hash_elems_ElementModP)->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(HexCodecFixture, ElementModP_toHex_cached)->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(HexCodecFixture, hash_elems_ElementModP_cached)
+  ->Unit(benchmark::kMicrosecond);
+
+#pragma endregion
@@ -51,6 +51,47 @@ BENCHMARK_DEFINE_F(ElgamalEncryptFixture, ElGamalEncryptfixed_base)(benchmark::S
 BENCHMARK_REGISTER_F(ElgamalEncryptFixture, ElGamalEncryptfixed_base)
   ->Unit(benchmark::kMillisecond);
 
+BENCHMARK_DEFINE_F(ElgamalEncryptFixture, ElGamalEncryptSequential)(benchmark::State &state)
+{
+    vector<unique_ptr<ElementModQ>> nonces;
+    for (int64_t i = 0; i < state.range(0); i++) {
+        nonces.push_back(rand_q());
+    }
+    for (auto _ : state) {
+        for (const auto &selectionNonce : nonces) {
+            elgamalEncrypt(1UL, *selectionNonce, *fixed_base_keypair->getPublicKey());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_REGISTER_F(ElgamalEncryptFixture, ElGamalEncryptSequential)
+  ->Arg(8)
+  ->Arg(64)
+  ->Arg(256)
+  ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(ElgamalEncryptFixture, ElGamalEncryptBatch)(benchmark::State &state)
+{
+    vector<unique_ptr<ElementModQ>> nonces;
+    vector<reference_wrapper<const ElementModQ>> nonceRefs;
+    for (int64_t i = 0; i < state.range(0); i++) {
+        nonces.push_back(rand_q());
+        nonceRefs.push_back(*nonces.back());
+    }
+    vector<uint64_t> messages(nonces.size(), 1UL);
+    for (auto _ : state) {
+        elgamalEncryptBatch(messages, nonceRefs, *fixed_base_keypair->getPublicKey());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_REGISTER_F(ElgamalEncryptFixture, ElGamalEncryptBatch)
+  ->Arg(8)
+  ->Arg(64)
+  ->Arg(256)
+  ->Unit(benchmark::kMillisecond);
+
 BENCHMARK_DEFINE_F(ElgamalEncryptFixture, ElGamalDecrypt)(benchmark::State &state)
 {
     auto two = TWO_MOD_Q();
@@ -5,6 +5,7 @@
 
 #include <benchmark/benchmark.h>
 #include <electionguard/ballot.hpp>
+#include <electionguard/ballot_compact.hpp>
 #include <electionguard/election.hpp>
 #include <electionguard/encrypt.hpp>
 #include <electionguard/hash.hpp>
@@ -182,6 +183,28 @@ BENCHMARK_DEFINE_F(EncryptBallotFixture, encryptContests_Full_NoProofCheck)(benc
     }
 }
 
+BENCHMARK_DEFINE_F(EncryptBallotFixture, EncryptionMediator_encrypt)(benchmark::State &state)
+{
+    auto mediator = make_unique<EncryptionMediator>(*internal, *context, *device);
+    for (auto _ : state) {
+        for (auto i = 0; i < state.range(0); i++) {
+            auto result = mediator->encrypt(*ballot, false);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_DEFINE_F(EncryptBallotFixture, EncryptionMediator_encryptBatch)
+(benchmark::State &state)
+{
+    auto mediator = make_unique<EncryptionMediator>(*internal, *context, *device);
+    vector<reference_wrapper<const PlaintextBallot>> ballots(state.range(0), ref(*ballot));
+    for (auto _ : state) {
+        auto result = mediator->encryptBatch(ballots, false);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
 BENCHMARK_REGISTER_F(EncryptBallotFixture, encryptBallot_Full_FromJSON)
   ->Unit(benchmark::kMillisecond);
 BENCHMARK_REGISTER_F(EncryptBallotFixture, encryptBallot_Full_NoProofCheck)
@@ -196,5 +219,78 @@ BENCHMARK_REGISTER_F(EncryptBallotFixture, encryptContests_Full_FromJSON)
   ->Unit(benchmark::kMillisecond);
 BENCHMARK_REGISTER_F(EncryptBallotFixture, encryptContests_Full_NoProofCheck)
   ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(EncryptBallotFixture, EncryptionMediator_encrypt)
+  ->Arg(16)
+  ->UseRealTime()
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(EncryptBallotFixture, EncryptionMediator_encryptBatch)
+  ->Arg(16)
+  ->UseRealTime()
+  ->Unit(benchmark::kMillisecond);
+
+#pragma endregion
+
+#pragma region expandCompactCiphertextBallot
+
+class ExpandCompactBallotFixture : public benchmark::Fixture
+{
+  public:
+    void SetUp(const ::benchmark::State &state)
+    {
+        auto secret = ElementModQ::fromHex(a_fixed_secret);
+        keypair = ElGamalKeyPair::fromSecret(*secret);
+        manifest = ManifestGenerator::getJeffersonCountyManifest_Minimal();
+        internal = make_unique<InternalManifest>(*manifest);
+        context = ElectionGenerator::getFakeContext(*internal, *keypair->getPublicKey());
+        device = make_unique<EncryptionDevice>(12345UL, 23456UL, 34567UL, "Location");
+        auto mediator = make_unique<EncryptionMediator>(*internal, *context, *device);
+        auto plaintext = BallotGenerator::getFakeBallot(*internal);
+        compactCiphertext = mediator->compactEncrypt(*plaintext);
+    }
+
+    void TearDown(const ::benchmark::State &state) {}
+
+    unique_ptr<ElGamalKeyPair> keypair;
+    unique_ptr<Manifest> manifest;
+    unique_ptr<InternalManifest> internal;
+    unique_ptr<CiphertextElectionContext> context;
+    unique_ptr<EncryptionDevice> device;
+    unique_ptr<CompactCiphertextBallot> compactCiphertext;
+};
+
+BENCHMARK_DEFINE_F(ExpandCompactBallotFixture, expand_WithProofCheck)(benchmark::State &state)
+{
+    for (auto _ : state) {
+        auto result = expandCompactCiphertextBallot(*compactCiphertext, *internal, *context);
+    }
+}
+
+BENCHMARK_DEFINE_F(ExpandCompactBallotFixture, expand_NoProofCheck)(benchmark::State &state)
+{
+    for (auto _ : state) {
+        auto result =
+          expandCompactCiphertextBallot(*compactCiphertext, *internal, *context, false);
+    }
+}
+
+BENCHMARK_DEFINE_F(ExpandCompactBallotFixture, expandBatch_NoProofCheck)
+(benchmark::State &state)
+{
+    vector<reference_wrapper<const CompactCiphertextBallot>> batch(state.range(0),
+                                                                   ref(*compactCiphertext));
+    for (auto _ : state) {
+        auto result = expandCompactCiphertextBallots(batch, *internal, *context, false);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_REGISTER_F(ExpandCompactBallotFixture, expand_WithProofCheck)
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(ExpandCompactBallotFixture, expand_NoProofCheck)
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(ExpandCompactBallotFixture, expandBatch_NoProofCheck)
+  ->Arg(16)
+  ->UseRealTime()
+  ->Unit(benchmark::kMillisecond);
 
 #pragma endregion
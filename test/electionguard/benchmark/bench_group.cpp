@@ -1,6 +1,7 @@
 #include "../../../src/electionguard/convert.hpp"
 #include "../../../src/electionguard/facades/bignum4096.hpp"
 #include "../../../src/electionguard/log.hpp"
+#include "../../../src/electionguard/lookup_table.hpp"
 #include "../../../src/electionguard/utils.hpp"
 #include "../utils/byte_logger.hpp"
 #include "../utils/constants.hpp"
@@ -160,6 +161,67 @@ BENCHMARK_DEFINE_F(GroupElementFixture, pow_mod_p_fixed_base)(benchmark::State &
 
 BENCHMARK_REGISTER_F(GroupElementFixture, pow_mod_p_fixed_base)->Unit(benchmark::kMillisecond);
 
+// compares the byte table (0 teeth) against comb layouts of {teeth, tables, constant time}
+BENCHMARK_DEFINE_F(GroupElementFixture, pow_mod_p_fixed_base_layout)(benchmark::State &state)
+{
+    auto rand_p1 = rand_p();
+    auto rand_q1 = rand_q();
+    auto *base = const_cast<uint64_t *>(rand_p1->cget());
+    auto &exponent = const_cast<uint64_t(&)[MAX_Q_LEN]>(rand_q1->cref());
+    unique_ptr<FixedBaseEngine> table;
+    if (state.range(0) == 0) {
+        table = make_unique<LookupTableType>(base);
+        state.SetLabel(to_string(LUT_TABLE_LENGTH * LUT_ORDER_BITS * MAX_P_SIZE / 1024) + " KiB");
+    } else {
+        auto comb = make_unique<CombTable>(base, state.range(0), state.range(1));
+        state.SetLabel(to_string(comb->size() / 1024) + " KiB, " +
+                       to_string(comb->getSquarings()) + " sqr, " +
+                       to_string(comb->getMultiplications()) + " mul");
+        table = move(comb);
+    }
+    vector<uint64_t> result(MAX_P_LEN);
+    for (auto _ : state) {
+        if (state.range(2) != 0) {
+            table->pow_mod_p_constant_time(exponent, result.data());
+        } else {
+            auto exp = table->pow_mod_p(exponent);
+        }
+    }
+}
+
+BENCHMARK_REGISTER_F(GroupElementFixture, pow_mod_p_fixed_base_layout)
+  ->Args({0, 0, 0})
+  ->Args({8, 32, 0})
+  ->Args({12, 4, 0})
+  ->Args({10, 4, 0})
+  ->Args({8, 8, 0})
+  ->Args({8, 4, 0})
+  ->Args({4, 4, 0})
+  ->Args({0, 0, 1})
+  ->Args({8, 8, 1})
+  ->Args({6, 4, 1})
+  ->Args({5, 4, 1})
+  ->Args({4, 4, 1})
+  ->Args({4, 2, 1})
+  ->Unit(benchmark::kMillisecond);
+
+// the nonce exponentiations of an encryption, g^R and K^R, in each timing
+BENCHMARK_DEFINE_F(GroupElementFixture, g_pow_p_timing)(benchmark::State &state)
+{
+    auto timing =
+      state.range(0) != 0 ? FixedBaseTiming::constantTime : FixedBaseTiming::variableTime;
+    auto nonce = rand_q();
+    auto warmup = g_pow_p(*nonce, timing);
+    for (auto _ : state) {
+        auto exp = g_pow_p(*nonce, timing);
+    }
+}
+
+BENCHMARK_REGISTER_F(GroupElementFixture, g_pow_p_timing)
+  ->Arg(0)
+  ->Arg(1)
+  ->Unit(benchmark::kMillisecond);
+
 BENCHMARK_DEFINE_F(GroupElementFixture, pow_mod_p_with_p)(benchmark::State &state)
 {
     auto rand_p1 = rand_p();
@@ -171,6 +233,55 @@ BENCHMARK_DEFINE_F(GroupElementFixture, pow_mod_p_with_p)(benchmark::State &stat
 
 BENCHMARK_REGISTER_F(GroupElementFixture, pow_mod_p_with_p)->Unit(benchmark::kMillisecond);
 
+// the share accumulation of a decryption raises the share of each guardian
+// to its Lagrange coefficient and multiplies the results
+BENCHMARK_DEFINE_F(GroupElementFixture, pow_mod_p_product)(benchmark::State &state)
+{
+    vector<unique_ptr<ElementModP>> bases;
+    vector<unique_ptr<ElementModQ>> exponents;
+    for (int64_t i = 0; i < state.range(0); i++) {
+        bases.push_back(rand_p());
+        exponents.push_back(rand_q());
+    }
+    for (auto _ : state) {
+        auto product = ElementModP::fromUint64(1UL);
+        for (size_t i = 0; i < bases.size(); i++) {
+            product = mul_mod_p(*product, *pow_mod_p(*bases[i], *exponents[i]));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_REGISTER_F(GroupElementFixture, pow_mod_p_product)
+  ->Arg(3)
+  ->Arg(5)
+  ->Arg(10)
+  ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(GroupElementFixture, pow_mod_p_multi)(benchmark::State &state)
+{
+    vector<unique_ptr<ElementModP>> bases;
+    vector<unique_ptr<ElementModQ>> exponents;
+    vector<reference_wrapper<const ElementModP>> baseRefs;
+    vector<reference_wrapper<const ElementModQ>> exponentRefs;
+    for (int64_t i = 0; i < state.range(0); i++) {
+        bases.push_back(rand_p());
+        exponents.push_back(rand_q());
+        baseRefs.push_back(*bases.back());
+        exponentRefs.push_back(*exponents.back());
+    }
+    for (auto _ : state) {
+        auto product = pow_mod_p_multi(baseRefs, exponentRefs);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_REGISTER_F(GroupElementFixture, pow_mod_p_multi)
+  ->Arg(3)
+  ->Arg(5)
+  ->Arg(10)
+  ->Unit(benchmark::kMillisecond);
+
 #endif
 
 BENCHMARK_DEFINE_F(GroupElementFixture, g_pow_p_with_q)(benchmark::State &state)
@@ -126,3 +126,71 @@ BENCHMARK_DEFINE_F(HaclBignum4096Fixture, pow_mod_p_const_time_mont)(benchmark::
 
 BENCHMARK_REGISTER_F(HaclBignum4096Fixture, pow_mod_p_const_time_mont)
   ->Unit(benchmark::kMillisecond);
+
+#pragma region Backends
+
+/// <summary>
+/// Select the backend named by the benchmark argument for the duration of the benchmark
+/// </summary>
+static bool useBackend(benchmark::State &state, Bignum4096Backend &previous)
+{
+    auto backend = static_cast<Bignum4096Backend>(state.range(0));
+    if (!isBignum4096BackendSupported(backend)) {
+        state.SkipWithError("backend is not supported on this machine");
+        return false;
+    }
+    previous = Bignum4096::backend;
+    Bignum4096::backend = backend;
+    state.SetLabel(backend == Bignum4096Backend::portable ? "portable" : "avx512ifma");
+    return true;
+}
+
+BENCHMARK_DEFINE_F(HaclBignum4096Fixture, montgomery_mul_backend)(benchmark::State &state)
+{
+    Bignum4096Backend previous;
+    if (!useBackend(state, previous)) {
+        return;
+    }
+
+    uint64_t aM[MAX_P_LEN] = {};
+    uint64_t bM[MAX_P_LEN] = {};
+    CONTEXT_P().to_montgomery_form(p1->get(), static_cast<uint64_t *>(aM));
+    CONTEXT_P().to_montgomery_form(p2->get(), static_cast<uint64_t *>(bM));
+
+    uint64_t result[MAX_P_LEN] = {};
+    for (auto _ : state) {
+        CONTEXT_P().montgomery_mod_mul_stay_in_mont_form(aM, bM, static_cast<uint64_t *>(result));
+        benchmark::DoNotOptimize(result);
+    }
+    Bignum4096::backend = previous;
+}
+
+BENCHMARK_REGISTER_F(HaclBignum4096Fixture, montgomery_mul_backend)
+  ->Arg(static_cast<int64_t>(Bignum4096Backend::portable))
+  ->Arg(static_cast<int64_t>(Bignum4096Backend::avx512ifma))
+  ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_DEFINE_F(HaclBignum4096Fixture, pow_mod_p_var_time_mont_backend)
+(benchmark::State &state)
+{
+    Bignum4096Backend previous;
+    if (!useBackend(state, previous)) {
+        return;
+    }
+
+    auto g = G().get();
+    auto e = rand_q()->toElementModP();
+
+    uint64_t result[MAX_P_LEN] = {};
+    for (auto _ : state) {
+        CONTEXT_P().modExp(g, MAX_P_SIZE, e->get(), static_cast<uint64_t *>(result), false);
+    }
+    Bignum4096::backend = previous;
+}
+
+BENCHMARK_REGISTER_F(HaclBignum4096Fixture, pow_mod_p_var_time_mont_backend)
+  ->Arg(static_cast<int64_t>(Bignum4096Backend::portable))
+  ->Arg(static_cast<int64_t>(Bignum4096Backend::avx512ifma))
+  ->Unit(benchmark::kMillisecond);
+
+#pragma endregion
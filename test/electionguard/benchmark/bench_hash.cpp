@@ -1,3 +1,4 @@
+#include "../../../src/electionguard/sha256.hpp"
 #include "../utils/constants.hpp"
 
 #include <benchmark/benchmark.h>
@@ -96,3 +97,74 @@ BENCHMARK_DEFINE_F(HashFixture, two_uints)(benchmark::State &state)
 }
 
 BENCHMARK_REGISTER_F(HashFixture, two_uints)->Unit(benchmark::kMillisecond);
+
+#pragma region Batch
+
+BENCHMARK_DEFINE_F(HashFixture, uint_and_element_each)(benchmark::State &state)
+{
+    auto count = static_cast<uint64_t>(state.range(0));
+    for (auto _ : state) {
+        for (uint64_t i = 0; i < count; i++) {
+            auto result = hash_elems({p1.get(), i});
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+BENCHMARK_DEFINE_F(HashFixture, uint_and_element_batch)(benchmark::State &state)
+{
+    auto count = static_cast<uint64_t>(state.range(0));
+    vector<vector<CryptoHashableType>> inputs;
+    for (uint64_t i = 0; i < count; i++) {
+        inputs.push_back({p1.get(), i});
+    }
+    for (auto _ : state) {
+        auto result = hash_elems_batch(inputs);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+BENCHMARK_REGISTER_F(HashFixture, uint_and_element_each)
+  ->Arg(8)
+  ->Arg(64)
+  ->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(HashFixture, uint_and_element_batch)
+  ->Arg(8)
+  ->Arg(64)
+  ->Unit(benchmark::kMicrosecond);
+
+/// <summary>
+/// Hash 64 messages of the given size with each sha256 engine
+/// </summary>
+static void Sha256_hashMany(benchmark::State &state)
+{
+    auto engine = static_cast<Sha256Engine>(state.range(0));
+    if (!Sha256::isSupported(engine)) {
+        state.SkipWithError("engine is not supported on this machine");
+        return;
+    }
+    vector<string> messages(64, string(static_cast<size_t>(state.range(1)), 'a'));
+    vector<uint8_t> digests(messages.size() * Sha256::DIGEST_SIZE);
+
+    auto previousEngine = Sha256::engine;
+    auto previousBatchEngine = Sha256::batchEngine;
+    Sha256::engine = engine == Sha256Engine::avx2 ? Sha256Engine::portable : engine;
+    Sha256::batchEngine = engine;
+    for (auto _ : state) {
+        Sha256::hashMany(messages, digests.data());
+        benchmark::DoNotOptimize(digests.data());
+    }
+    Sha256::engine = previousEngine;
+    Sha256::batchEngine = previousBatchEngine;
+
+    state.SetBytesProcessed(state.iterations() * messages.size() * state.range(1));
+}
+
+BENCHMARK(Sha256_hashMany)
+  ->ArgsProduct({{static_cast<int64_t>(Sha256Engine::portable),
+                  static_cast<int64_t>(Sha256Engine::shaNi),
+                  static_cast<int64_t>(Sha256Engine::avx2)},
+                 {96, 1100}})
+  ->Unit(benchmark::kMicrosecond);
+
+#pragma endregion
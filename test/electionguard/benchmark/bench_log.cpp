@@ -0,0 +1,56 @@
+#include "../../../src/electionguard/log.hpp"
+
+#include <benchmark/benchmark.h>
+#include <electionguard/constants.h>
+#include <electionguard/group.hpp>
+
+using namespace electionguard;
+using namespace std;
+
+class LogFixture : public benchmark::Fixture
+{
+  public:
+    void SetUp(const ::benchmark::State &state) { element = g_pow_p(*rand_q()); }
+
+    void TearDown(const ::benchmark::State &state) {}
+
+    unique_ptr<ElementModP> element;
+};
+
+BENCHMARK_DEFINE_F(LogFixture, baseline)(benchmark::State &state)
+{
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(element.get());
+    }
+}
+
+BENCHMARK_REGISTER_F(LogFixture, baseline)->Unit(benchmark::kNanosecond);
+
+BENCHMARK_DEFINE_F(LogFixture, trace_eager)(benchmark::State &state)
+{
+    for (auto _ : state) {
+        Log::trace("manifestHash   :", element->toHex());
+    }
+}
+
+BENCHMARK_REGISTER_F(LogFixture, trace_eager)->Unit(benchmark::kNanosecond);
+
+BENCHMARK_DEFINE_F(LogFixture, trace_lazy)(benchmark::State &state)
+{
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(element.get());
+        EG_LOG_TRACE("manifestHash   :", element->toHex());
+    }
+}
+
+BENCHMARK_REGISTER_F(LogFixture, trace_lazy)->Unit(benchmark::kNanosecond);
+
+BENCHMARK_DEFINE_F(LogFixture, trace_level_check)(benchmark::State &state)
+{
+    // the cost when trace is compiled in but the logger level is higher
+    for (auto _ : state) {
+        EG_LOG_AT(trace, trace, "manifestHash   :", element->toHex());
+    }
+}
+
+BENCHMARK_REGISTER_F(LogFixture, trace_level_check)->Unit(benchmark::kNanosecond);
@@ -0,0 +1,98 @@
+#include "../../../src/electionguard/lookup_table.hpp"
+#include "../../../src/electionguard/table_memory.hpp"
+
+#include <atomic>
+#include <benchmark/benchmark.h>
+#include <electionguard/constants.h>
+#include <electionguard/group.hpp>
+#include <string>
+#include <vector>
+
+using namespace electionguard;
+using namespace std;
+
+static const char *policyName(TableMemoryPolicy policy)
+{
+    switch (policy) {
+        case TableMemoryPolicy::transparentHugePages:
+            return "transparent huge pages";
+        case TableMemoryPolicy::explicitHugePages:
+            return "explicit huge pages";
+        default:
+            return "standard pages";
+    }
+}
+
+// enough distinct exponents that the rows touched vary across the whole table
+static const size_t EXPONENT_COUNT = 256;
+
+static const vector<unique_ptr<ElementModQ>> &getExponents()
+{
+    static const auto exponents = [] {
+        vector<unique_ptr<ElementModQ>> result;
+        for (size_t i = 0; i < EXPONENT_COUNT; i++) {
+            result.push_back(rand_q());
+        }
+        return result;
+    }();
+    return exponents;
+}
+
+class LookupTableFixture : public benchmark::Fixture
+{
+  public:
+    // fixtures are set up on every thread, so the shared exponents are made once
+    void SetUp(const ::benchmark::State &state) { getExponents(); }
+
+    void TearDown(const ::benchmark::State &state) {}
+};
+
+BENCHMARK_DEFINE_F(LookupTableFixture, pow_mod_p_memory_policy)(benchmark::State &state)
+{
+    auto requested = static_cast<TableMemoryPolicy>(state.range(0));
+    LookupTableType table(const_cast<uint64_t *>(G().cget()), requested);
+    state.SetLabel(policyName(table.getMemoryPolicy()));
+
+    const auto &exponents = getExponents();
+    size_t index = 0;
+    for (auto _ : state) {
+        auto &exponent = exponents[index++ % EXPONENT_COUNT];
+        benchmark::DoNotOptimize(
+          table.pow_mod_p(const_cast<uint64_t(&)[MAX_Q_LEN]>(exponent->cref())));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_REGISTER_F(LookupTableFixture, pow_mod_p_memory_policy)
+  ->Arg(static_cast<int64_t>(TableMemoryPolicy::standard))
+  ->Arg(static_cast<int64_t>(TableMemoryPolicy::transparentHugePages))
+  ->Arg(static_cast<int64_t>(TableMemoryPolicy::explicitHugePages))
+  ->Unit(benchmark::kMicrosecond);
+
+// every thread exponentiates against the shared context tables, either reading the one
+// copy that was built first or a replica on its own NUMA node
+BENCHMARK_DEFINE_F(LookupTableFixture, pow_mod_p_numa_replication)(benchmark::State &state)
+{
+    // every thread stores the same setting, so no thread runs ahead with the other one
+    LookupTableContext::setNumaReplication(state.range(0) != 0);
+    state.SetLabel(to_string(TableMemory::getNumaNodeCount()) + " numa nodes");
+
+    static atomic<size_t> threadOffset{0};
+    const auto &exponents = getExponents();
+    auto hex = G().toHex();
+    auto &base = const_cast<uint64_t(&)[MAX_P_LEN]>(G().cref());
+    size_t index = threadOffset++;
+    for (auto _ : state) {
+        auto &exponent = exponents[index++ % EXPONENT_COUNT];
+        benchmark::DoNotOptimize(LookupTableContext::pow_mod_p(
+          hex, base, const_cast<uint64_t(&)[MAX_Q_LEN]>(exponent->cref())));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_REGISTER_F(LookupTableFixture, pow_mod_p_numa_replication)
+  ->Arg(0)
+  ->Arg(1)
+  ->ThreadPerCpu()
+  ->UseRealTime()
+  ->Unit(benchmark::kMicrosecond);
@@ -40,3 +40,27 @@ BENCHMARK_DEFINE_F(NonceFixture, next)(benchmark::State &state)
 }
 
 BENCHMARK_REGISTER_F(NonceFixture, next)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(NonceFixture, get_each)(benchmark::State &state)
+{
+    auto count = static_cast<uint64_t>(state.range(0));
+    for (auto _ : state) {
+        for (uint64_t i = 0; i < count; i++) {
+            auto nonce = nonces->get(i);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+BENCHMARK_REGISTER_F(NonceFixture, get_each)->Arg(64)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_DEFINE_F(NonceFixture, get_range)(benchmark::State &state)
+{
+    auto count = static_cast<uint64_t>(state.range(0));
+    for (auto _ : state) {
+        auto result = nonces->get(0UL, count);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+BENCHMARK_REGISTER_F(NonceFixture, get_range)->Arg(64)->Unit(benchmark::kMicrosecond);
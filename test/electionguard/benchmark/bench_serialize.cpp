@@ -0,0 +1,173 @@
+#include "../generators/ballot.hpp"
+#include "../generators/election.hpp"
+#include "../generators/manifest.hpp"
+#include "../utils/constants.hpp"
+
+#include <benchmark/benchmark.h>
+#include <electionguard/ballot.hpp>
+#include <electionguard/ballot_compact.hpp>
+#include <electionguard/election.hpp>
+#include <electionguard/encrypt.hpp>
+#include <electionguard/manifest.hpp>
+
+using namespace electionguard;
+using namespace electionguard::tools::generators;
+using namespace std;
+
+#pragma region CiphertextBallot
+
+class SerializeCiphertextBallotFixture : public benchmark::Fixture
+{
+  public:
+    void SetUp(const ::benchmark::State &state)
+    {
+        auto secret = ElementModQ::fromHex(a_fixed_secret);
+        keypair = ElGamalKeyPair::fromSecret(*secret);
+        manifest = ManifestGenerator::getJeffersonCountyManifest_Minimal();
+        internal = make_unique<InternalManifest>(*manifest);
+        context = ElectionGenerator::getFakeContext(*internal, *keypair->getPublicKey());
+        device = make_unique<EncryptionDevice>(12345UL, 23456UL, 34567UL, "Location");
+        mediator = make_unique<EncryptionMediator>(*internal, *context, *device);
+
+        auto plaintext = BallotGenerator::getFakeBallot(*internal);
+        ciphertext = mediator->encrypt(*plaintext);
+        compactCiphertext = mediator->compactEncrypt(*plaintext);
+
+        json = ciphertext->toJson();
+        bson = ciphertext->toBson();
+        msgpack = ciphertext->toMsgPack();
+        binary = ciphertext->toBinary();
+        compactMsgpack = compactCiphertext->toMsgPack();
+        compactBinary = compactCiphertext->toBinary();
+    }
+
+    void TearDown(const ::benchmark::State &state) {}
+
+    unique_ptr<ElGamalKeyPair> keypair;
+    unique_ptr<Manifest> manifest;
+    unique_ptr<InternalManifest> internal;
+    unique_ptr<CiphertextElectionContext> context;
+    unique_ptr<EncryptionDevice> device;
+    unique_ptr<EncryptionMediator> mediator;
+    unique_ptr<CiphertextBallot> ciphertext;
+    unique_ptr<CompactCiphertextBallot> compactCiphertext;
+    string json;
+    vector<uint8_t> bson;
+    vector<uint8_t> msgpack;
+    vector<uint8_t> binary;
+    vector<uint8_t> compactMsgpack;
+    vector<uint8_t> compactBinary;
+};
+
+BENCHMARK_DEFINE_F(SerializeCiphertextBallotFixture, toJson)(benchmark::State &state)
+{
+    for (auto _ : state) {
+        auto result = ciphertext->toJson();
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetBytesProcessed(state.iterations() * json.size());
+    state.counters["size"] = json.size();
+}
+
+BENCHMARK_DEFINE_F(SerializeCiphertextBallotFixture, fromJson)(benchmark::State &state)
+{
+    for (auto _ : state) {
+        auto result = CiphertextBallot::fromJson(json);
+    }
+    state.SetBytesProcessed(state.iterations() * json.size());
+    state.counters["size"] = json.size();
+}
+
+BENCHMARK_DEFINE_F(SerializeCiphertextBallotFixture, toBson)(benchmark::State &state)
+{
+    for (auto _ : state) {
+        auto result = ciphertext->toBson();
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetBytesProcessed(state.iterations() * bson.size());
+    state.counters["size"] = bson.size();
+}
+
+BENCHMARK_DEFINE_F(SerializeCiphertextBallotFixture, fromBson)(benchmark::State &state)
+{
+    for (auto _ : state) {
+        auto result = CiphertextBallot::fromBson(bson);
+    }
+    state.SetBytesProcessed(state.iterations() * bson.size());
+    state.counters["size"] = bson.size();
+}
+
+BENCHMARK_DEFINE_F(SerializeCiphertextBallotFixture, toMsgPack)(benchmark::State &state)
+{
+    for (auto _ : state) {
+        auto result = ciphertext->toMsgPack();
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetBytesProcessed(state.iterations() * msgpack.size());
+    state.counters["size"] = msgpack.size();
+}
+
+BENCHMARK_DEFINE_F(SerializeCiphertextBallotFixture, fromMsgPack)(benchmark::State &state)
+{
+    for (auto _ : state) {
+        auto result = CiphertextBallot::fromMsgPack(msgpack);
+    }
+    state.SetBytesProcessed(state.iterations() * msgpack.size());
+    state.counters["size"] = msgpack.size();
+}
+
+BENCHMARK_DEFINE_F(SerializeCiphertextBallotFixture, toBinary)(benchmark::State &state)
+{
+    for (auto _ : state) {
+        auto result = ciphertext->toBinary();
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetBytesProcessed(state.iterations() * binary.size());
+    state.counters["size"] = binary.size();
+}
+
+BENCHMARK_DEFINE_F(SerializeCiphertextBallotFixture, fromBinary)(benchmark::State &state)
+{
+    for (auto _ : state) {
+        auto result = CiphertextBallot::fromBinary(binary.data(), binary.size());
+    }
+    state.SetBytesProcessed(state.iterations() * binary.size());
+    state.counters["size"] = binary.size();
+}
+
+BENCHMARK_DEFINE_F(SerializeCiphertextBallotFixture, compact_fromMsgPack)
+(benchmark::State &state)
+{
+    for (auto _ : state) {
+        auto result = CompactCiphertextBallot::fromMsgPack(compactMsgpack);
+    }
+    state.SetBytesProcessed(state.iterations() * compactMsgpack.size());
+    state.counters["size"] = compactMsgpack.size();
+}
+
+BENCHMARK_DEFINE_F(SerializeCiphertextBallotFixture, compact_fromBinary)
+(benchmark::State &state)
+{
+    for (auto _ : state) {
+        auto result =
+          CompactCiphertextBallot::fromBinary(compactBinary.data(), compactBinary.size());
+    }
+    state.SetBytesProcessed(state.iterations() * compactBinary.size());
+    state.counters["size"] = compactBinary.size();
+}
+
+BENCHMARK_REGISTER_F(SerializeCiphertextBallotFixture, toJson)->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(SerializeCiphertextBallotFixture, fromJson)->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(SerializeCiphertextBallotFixture, toBson)->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(SerializeCiphertextBallotFixture, fromBson)->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(SerializeCiphertextBallotFixture, toMsgPack)->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(SerializeCiphertextBallotFixture, fromMsgPack)
+  ->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(SerializeCiphertextBallotFixture, toBinary)->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(SerializeCiphertextBallotFixture, fromBinary)->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(SerializeCiphertextBallotFixture, compact_fromMsgPack)
+  ->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(SerializeCiphertextBallotFixture, compact_fromBinary)
+  ->Unit(benchmark::kMicrosecond);
+
+#pragma endregion
@@ -18,18 +18,28 @@ set(SOURCES_electionguard_test_utils
 set(SOURCES_electionguard_test_benchmark
     ${CMAKE_CURRENT_SOURCE_DIR}/electionguard/benchmark/main.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/electionguard/benchmark/bench_chaum_pedersen.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/electionguard/benchmark/bench_convert.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/electionguard/benchmark/bench_elgamal.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/electionguard/benchmark/bench_encrypt.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/electionguard/benchmark/bench_group.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/electionguard/benchmark/bench_hacl.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/electionguard/benchmark/bench_hash.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/electionguard/benchmark/bench_hashed_elgamal.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/electionguard/benchmark/bench_log.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/electionguard/benchmark/bench_lookup_table.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/electionguard/benchmark/bench_nonces.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/electionguard/benchmark/bench_serialize.cpp
 
     # TODO: reenable
     # ${CMAKE_CURRENT_SOURCE_DIR}/electionguard/benchmark/bench_precompute.cpp
 )
 
+set(SOURCES_electionguard_test_workload
+    ${CMAKE_CURRENT_SOURCE_DIR}/electionguard/workload/main.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/electionguard/workload/workload.hpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/electionguard/workload/workload.cpp
+)
+
 set(SOURCES_electionguard_test_cpp_tests
     ${CMAKE_CURRENT_SOURCE_DIR}/main.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/electionguard/test_ballot_code.cpp
@@ -37,6 +47,7 @@ set(SOURCES_electionguard_test_cpp_tests
     ${CMAKE_CURRENT_SOURCE_DIR}/electionguard/test_ballot.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/electionguard/test_chaum_pedersen.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/electionguard/test_constants.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/electionguard/test_decrypt.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/electionguard/test_discrete_log.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/electionguard/test_election.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/electionguard/test_elgamal.cpp
@@ -45,7 +56,10 @@ set(SOURCES_electionguard_test_cpp_tests
     ${CMAKE_CURRENT_SOURCE_DIR}/electionguard/test_group.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/electionguard/test_hacl.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/electionguard/test_hash.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/electionguard/test_metrics.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/electionguard/test_nonces.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/electionguard/test_precompute_buffers.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/electionguard/test_tracing.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/electionguard/test_manifest.cpp
 )
 
@@ -55,6 +69,7 @@ set(SOURCES_electionguard_test_c_tests
     ${CMAKE_CURRENT_SOURCE_DIR}/electionguard/test_ballot.c
     ${CMAKE_CURRENT_SOURCE_DIR}/electionguard/test_chaum_pedersen.c
     ${CMAKE_CURRENT_SOURCE_DIR}/electionguard/test_collections.c
+    ${CMAKE_CURRENT_SOURCE_DIR}/electionguard/test_decrypt.c
     ${CMAKE_CURRENT_SOURCE_DIR}/electionguard/test_election.c
     ${CMAKE_CURRENT_SOURCE_DIR}/electionguard/test_elgamal.c
     ${CMAKE_CURRENT_SOURCE_DIR}/electionguard/test_encrypt_compact.c
@@ -62,4 +77,5 @@ set(SOURCES_electionguard_test_c_tests
     ${CMAKE_CURRENT_SOURCE_DIR}/electionguard/test_group.c
     ${CMAKE_CURRENT_SOURCE_DIR}/electionguard/test_hash.c
     ${CMAKE_CURRENT_SOURCE_DIR}/electionguard/test_manifest.c
+    ${CMAKE_CURRENT_SOURCE_DIR}/electionguard/test_metrics.c
 )
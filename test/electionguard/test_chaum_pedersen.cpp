@@ -305,6 +305,49 @@ TEST_CASE("Ranged CP Proof encryption of all generates valid proof")
     CHECK(result.isValid == true);
 }
 
+TEST_CASE("Ranged CP Proof with a large limit is the same for every concurrency")
+{
+    // Arrange
+    auto keypair = ElGamalKeyPair::fromSecret(TWO_MOD_Q(), false);
+    const auto &nonce = ONE_MOD_Q();
+    const auto &seed = TWO_MOD_Q();
+    const auto selected = 7UL; // we chose 7 selections on the ballot
+    const auto limit = 21UL;   // can choose up to 21 selections in a cumulative contest
+    auto message = elgamalEncrypt(selected, nonce, *keypair->getPublicKey());
+
+    // Act
+    auto serial = RangedChaumPedersenProof::make(*message, nonce, selected, limit,
+                                                 *keypair->getPublicKey(), ONE_MOD_Q(), "test",
+                                                 seed, 1);
+    auto parallel = RangedChaumPedersenProof::make(*message, nonce, selected, limit,
+                                                   *keypair->getPublicKey(), ONE_MOD_Q(), "test",
+                                                   seed, 0);
+    auto serialResult =
+      serial->isValid(*message, *keypair->getPublicKey(), ONE_MOD_Q(), "test", 1);
+    auto parallelResult =
+      parallel->isValid(*message, *keypair->getPublicKey(), ONE_MOD_Q(), "test", 0);
+
+    // Assert
+    CHECK(serialResult.isValid == true);
+    CHECK(parallelResult.isValid == true);
+    CHECK(*serial->getChallenge() == *parallel->getChallenge());
+    REQUIRE(serial->getProofs().size() == limit);
+    REQUIRE(parallel->getProofs().size() == limit);
+    for (uint64_t j = 0; j < limit; j++) {
+        const auto *serialProof = serial->getProofAtIndex(j);
+        const auto *parallelProof = parallel->getProofAtIndex(j);
+        CHECK(*serialProof->commitment.value() == *parallelProof->commitment.value());
+        CHECK(*serialProof->challenge == *parallelProof->challenge);
+        CHECK(*serialProof->response == *parallelProof->response);
+    }
+
+    // a tampered response is found by the parallel verification
+    parallel->getProofAtIndex(limit - 1)->response = ONE_MOD_Q().clone();
+    auto tamperedResult =
+      parallel->isValid(*message, *keypair->getPublicKey(), ONE_MOD_Q(), "test", 0);
+    CHECK(tamperedResult.isValid == false);
+}
+
 // the constant CP Proof is only compatible with
 // E.G. 1.0 Compatible ElGamal Encrypt.
 // for E.G. 2.0 Base-K ElGamal Encrypt use RangedChaumPedersenProof
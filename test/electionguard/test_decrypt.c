@@ -0,0 +1,122 @@
+#include <assert.h>
+#include <electionguard/decrypt.h>
+#include <electionguard/elgamal.h>
+#include <string.h>
+
+static bool test_decryption_shares_compute_and_combine(void);
+
+bool test_decrypt(void)
+{
+    printf("\n -------- test_decrypt.c --------- \n");
+    return test_decryption_shares_compute_and_combine();
+}
+
+bool test_decryption_shares_compute_and_combine(void)
+{
+    // Arrange
+    eg_element_mod_q_t *nonce = NULL;
+    if (eg_element_mod_q_new(ONE_MOD_Q_ARRAY, &nonce)) {
+        assert(false);
+    }
+
+    eg_element_mod_q_t *secret = NULL;
+    if (eg_element_mod_q_new(TWO_MOD_Q_ARRAY, &secret)) {
+        assert(false);
+    }
+
+    eg_elgamal_keypair_t *key_pair = NULL;
+    if (eg_elgamal_keypair_from_secret_new(secret, &key_pair)) {
+        assert(false);
+    }
+
+    eg_element_mod_p_t *public_key = NULL;
+    if (eg_elgamal_keypair_get_public_key(key_pair, &public_key)) {
+        assert(false);
+    }
+
+    eg_elgamal_ciphertext_t *ciphertext = NULL;
+    if (eg_elgamal_encrypt(1UL, nonce, public_key, &ciphertext)) {
+        assert(false);
+    }
+
+    eg_element_mod_p_t *pad = NULL;
+    eg_element_mod_p_t *data = NULL;
+    if (eg_elgamal_ciphertext_get_pad(ciphertext, &pad) ||
+        eg_elgamal_ciphertext_get_data(ciphertext, &data)) {
+        assert(false);
+    }
+
+    uint64_t *limbs = NULL;
+    uint64_t size = 0;
+    uint64_t ciphertexts[2 * MAX_P_LEN] = {0};
+    if (eg_element_mod_p_get_data(pad, &limbs, &size)) {
+        assert(false);
+    }
+    memcpy(ciphertexts, limbs, MAX_P_LEN * sizeof(uint64_t));
+    if (eg_element_mod_p_get_data(data, &limbs, &size)) {
+        assert(false);
+    }
+    memcpy(ciphertexts + MAX_P_LEN, limbs, MAX_P_LEN * sizeof(uint64_t));
+
+    uint64_t shares[MAX_P_LEN] = {0};
+    uint64_t commitments[2 * MAX_P_LEN] = {0};
+    uint64_t challenges[MAX_Q_LEN] = {0};
+    uint64_t responses[MAX_Q_LEN] = {0};
+
+    // Act
+    if (eg_decryption_shares_compute(ciphertexts, 1, secret, nonce, nonce, 0, shares, commitments,
+                                     challenges, responses)) {
+        assert(false);
+    }
+
+    eg_element_mod_p_t *partial_decryption = NULL;
+    if (eg_elgamal_ciphertext_partial_decrypt(ciphertext, secret, &partial_decryption)) {
+        assert(false);
+    }
+
+    uint64_t plaintext = 0;
+    eg_element_mod_q_t *coefficients[] = {nonce};
+    if (eg_decryption_shares_combine(ciphertexts, 1, shares, coefficients, 1, public_key, 0,
+                                     &plaintext)) {
+        assert(false);
+    }
+
+    // Assert
+    if (eg_element_mod_p_get_data(partial_decryption, &limbs, &size)) {
+        assert(false);
+    }
+    assert(memcmp(shares, limbs, MAX_P_LEN * sizeof(uint64_t)) == 0);
+    assert(plaintext == 1UL);
+    assert(eg_decryption_shares_compute(ciphertexts, 1, NULL, nonce, nonce, 0, shares,
+                                        commitments, challenges, responses) ==
+           ELECTIONGUARD_STATUS_ERROR_INVALID_ARGUMENT);
+    // a pad of 2^4096 - 1 is not an element of the group
+    memset(ciphertexts, 0xff, MAX_P_LEN * sizeof(uint64_t));
+    assert(eg_decryption_shares_compute(ciphertexts, 1, secret, nonce, nonce, 0, shares,
+                                        commitments, challenges, responses) ==
+           ELECTIONGUARD_STATUS_ERROR_INVALID_ARGUMENT);
+
+    // Clean Up
+    if (eg_element_mod_p_free(partial_decryption)) {
+        assert(false);
+    }
+    if (eg_elgamal_ciphertext_free(ciphertext)) {
+        assert(false);
+    }
+    if (eg_elgamal_keypair_free(key_pair)) {
+        assert(false);
+    }
+    if (eg_element_mod_q_free(secret)) {
+        assert(false);
+    }
+    if (eg_element_mod_q_free(nonce)) {
+        assert(false);
+    }
+
+    // Don't call free, we don't own them.
+    public_key = NULL;
+    pad = NULL;
+    data = NULL;
+
+    return true;
+}
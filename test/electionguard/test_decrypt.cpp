@@ -0,0 +1,183 @@
+#include "utils/constants.hpp"
+
+#include <doctest/doctest.h>
+#include <electionguard/constants.h>
+#include <electionguard/decrypt.hpp>
+#include <electionguard/elgamal.hpp>
+#include <electionguard/group.hpp>
+#include <electionguard/hash.hpp>
+
+using namespace electionguard;
+using namespace std;
+
+static ElGamalCiphertextBatch makeCiphertexts(const ElementModP &publicKey,
+                                              const vector<uint64_t> &messages)
+{
+    vector<unique_ptr<ElementModQ>> nonces;
+    vector<reference_wrapper<const ElementModQ>> nonceRefs;
+    for (size_t i = 0; i < messages.size(); i++) {
+        nonces.push_back(rand_q());
+        nonceRefs.push_back(*nonces.back());
+    }
+    return elgamalEncryptBatch(messages, nonceRefs, publicKey);
+}
+
+static ElGamalCiphertextBatch makeCiphertexts(const ElementModP &publicKey, size_t count)
+{
+    vector<uint64_t> messages;
+    for (size_t i = 0; i < count; i++) {
+        messages.push_back(i % 3);
+    }
+    return makeCiphertexts(publicKey, messages);
+}
+
+TEST_CASE("computeDecryptionShares produces the partial decryptions with valid proofs")
+{
+    // Arrange
+    auto secret = ElementModQ::fromHex(a_fixed_secret);
+    auto keypair = ElGamalKeyPair::fromSecret(*secret);
+    auto *publicKey = keypair->getPublicKey();
+    auto extendedBaseHash = rand_q();
+    auto nonceSeed = rand_q();
+    // more than one chunk, and a partial last chunk
+    auto ciphertexts = makeCiphertexts(*publicKey, 37);
+
+    // Act
+    auto shares = computeDecryptionShares(ciphertexts, *secret, *extendedBaseHash, *nonceSeed);
+
+    // Assert
+    CHECK(shares.size() == ciphertexts.size());
+    for (size_t i = 0; i < shares.size(); i++) {
+        auto ciphertext = ciphertexts.getCiphertext(i);
+        auto share = shares.getShareElement(i);
+        auto proof = shares.getProof(i);
+        auto *alpha = ciphertext->getPad();
+        auto *beta = ciphertext->getData();
+        auto *a = proof->getPad();
+        auto *b = proof->getData();
+        auto *c = proof->getChallenge();
+        auto *v = proof->getResponse();
+
+        // 𝑀𝑖 = 𝐴^𝑠𝑖 mod 𝑝
+        CHECK((*share == *ciphertext->partialDecrypt(*secret)));
+        // 𝑎𝑖 = 𝑔^𝑣𝑖 ⋅ 𝐾𝑖^𝑐𝑖 mod 𝑝
+        CHECK((*a == *mul_mod_p(*g_pow_p(*v), *pow_mod_p(*publicKey, *c))));
+        // 𝑏𝑖 = 𝐴^𝑣𝑖 ⋅ 𝑀𝑖^𝑐𝑖 mod 𝑝
+        CHECK((*b == *mul_mod_p(*pow_mod_p(*alpha, *v), *pow_mod_p(*share, *c))));
+        // 𝑐𝑖 = H(𝐻𝐸;30,𝐾𝑖,𝐴,𝐵,𝑎𝑖,𝑏𝑖,𝑀𝑖)
+        auto challenge = hash_elems({HashPrefix::get_prefix_decrypt_selection_proof(),
+                                     extendedBaseHash.get(), publicKey, alpha, beta, a, b,
+                                     share.get()});
+        CHECK((*c == *challenge));
+    }
+    CHECK_THROWS(shares.getProof(shares.size()));
+}
+
+TEST_CASE("computeDecryptionShares is deterministic for a nonce seed across concurrency")
+{
+    // Arrange
+    auto keypair = ElGamalKeyPair::fromSecret(TWO_MOD_Q(), false);
+    auto nonceSeed = rand_q();
+    auto ciphertexts = makeCiphertexts(*keypair->getPublicKey(), 20);
+
+    // Act
+    auto sequential =
+      computeDecryptionShares(ciphertexts, TWO_MOD_Q(), ONE_MOD_Q(), *nonceSeed, 1);
+    auto parallel = computeDecryptionShares(ciphertexts, TWO_MOD_Q(), ONE_MOD_Q(), *nonceSeed, 4);
+    auto empty = computeDecryptionShares(ElGamalCiphertextBatch(0), TWO_MOD_Q(), ONE_MOD_Q(),
+                                         *nonceSeed);
+
+    // Assert
+    CHECK(empty.size() == 0);
+    for (size_t i = 0; i < ciphertexts.size(); i++) {
+        CHECK(equal(sequential.getShare(i), sequential.getShare(i) + MAX_P_LEN,
+                    parallel.getShare(i)));
+        CHECK(equal(sequential.getCommitmentData(i), sequential.getCommitmentData(i) + MAX_P_LEN,
+                    parallel.getCommitmentData(i)));
+        CHECK(equal(sequential.getResponse(i), sequential.getResponse(i) + MAX_Q_LEN,
+                    parallel.getResponse(i)));
+    }
+}
+
+TEST_CASE("computeDecryptionShares never reuses a proof nonce when the seed is reused")
+{
+    // Arrange
+    auto keypair = ElGamalKeyPair::fromSecret(TWO_MOD_Q(), false);
+    auto nonceSeed = rand_q();
+    auto tally = makeCiphertexts(*keypair->getPublicKey(), 2);
+    auto challenged = makeCiphertexts(*keypair->getPublicKey(), 2);
+
+    // Act
+    auto tallyShares = computeDecryptionShares(tally, TWO_MOD_Q(), ONE_MOD_Q(), *nonceSeed);
+    auto challengedShares =
+      computeDecryptionShares(challenged, TWO_MOD_Q(), ONE_MOD_Q(), *nonceSeed);
+    auto repeatedShares = computeDecryptionShares(tally, TWO_MOD_Q(), ONE_MOD_Q(), *nonceSeed);
+
+    // Assert
+    for (size_t i = 0; i < tally.size(); i++) {
+        // the same position in another batch commits to a different nonce
+        CHECK_FALSE(equal(tallyShares.getCommitmentPad(i),
+                          tallyShares.getCommitmentPad(i) + MAX_P_LEN,
+                          challengedShares.getCommitmentPad(i)));
+        // the same ciphertext always receives the same proof
+        CHECK(equal(tallyShares.getResponse(i), tallyShares.getResponse(i) + MAX_Q_LEN,
+                    repeatedShares.getResponse(i)));
+    }
+}
+
+TEST_CASE("computeDecryptionShares rejects a pad outside of the group")
+{
+    // Arrange
+    auto keypair = ElGamalKeyPair::fromSecret(TWO_MOD_Q(), false);
+    auto ciphertexts = makeCiphertexts(*keypair->getPublicKey(), 2);
+    copy(P().get(), P().get() + MAX_P_LEN, ciphertexts.getPad(1));
+
+    // Act & Assert
+    CHECK_THROWS(computeDecryptionShares(ciphertexts, TWO_MOD_Q(), ONE_MOD_Q(), ONE_MOD_Q()));
+}
+
+TEST_CASE("combineDecryptionShares decrypts with the weighted shares of every guardian")
+{
+    // Arrange
+    vector<unique_ptr<ElementModQ>> secrets;
+    vector<unique_ptr<ElementModQ>> coefficients;
+    vector<reference_wrapper<const ElementModQ>> coefficientRefs;
+    auto jointSecret = ElementModQ::fromUint64(0UL);
+    for (size_t i = 0; i < 3; i++) {
+        secrets.push_back(rand_q());
+        coefficients.push_back(rand_q());
+        coefficientRefs.push_back(*coefficients.back());
+        jointSecret = add_mod_q(*jointSecret, *mul_mod_q(*secrets.back(), *coefficients.back()));
+    }
+    auto jointKey = g_pow_p(*jointSecret);
+    vector<uint64_t> messages;
+    for (size_t i = 0; i < 21; i++) {
+        messages.push_back(i % 5 == 0 ? 0UL : i);
+    }
+    auto ciphertexts = makeCiphertexts(*jointKey, messages);
+
+    vector<DecryptionShareBatch> shares;
+    vector<reference_wrapper<const DecryptionShareBatch>> shareRefs;
+    for (const auto &secret : secrets) {
+        shares.push_back(computeDecryptionShares(ciphertexts, *secret, ONE_MOD_Q(), *rand_q()));
+    }
+    for (const auto &guardianShares : shares) {
+        shareRefs.push_back(guardianShares);
+    }
+
+    // Act
+    auto plaintexts = combineDecryptionShares(ciphertexts, shareRefs, coefficientRefs, *jointKey);
+
+    // Assert
+    CHECK(plaintexts == messages);
+    for (size_t i = 0; i < ciphertexts.size(); i++) {
+        auto shareAccumulation = pow_mod_p(*shares[0].getShareElement(i), *coefficients[0]);
+        for (size_t g = 1; g < shares.size(); g++) {
+            shareAccumulation = mul_mod_p(
+              *shareAccumulation, *pow_mod_p(*shares[g].getShareElement(i), *coefficients[g]));
+        }
+        CHECK(ciphertexts.getCiphertext(i)->decrypt(*shareAccumulation, *jointKey) ==
+              plaintexts[i]);
+    }
+    CHECK_THROWS(combineDecryptionShares(ciphertexts, shareRefs, {}, *jointKey));
+}
@@ -21,3 +21,23 @@ TEST_CASE("Can find discrete log valid value")
     // Assert
     CHECK(result == 100UL);
 }
+
+TEST_CASE("Can find discrete log values of a batch")
+{
+    // Arrange
+    vector<uint64_t> plaintexts = {3UL, 250UL, 0UL, 3UL, 40UL, 251UL};
+    vector<unique_ptr<ElementModP>> elements;
+    vector<reference_wrapper<const ElementModP>> elementRefs;
+    for (auto plaintext : plaintexts) {
+        elements.push_back(g_pow_p(*ElementModQ::fromUint64(plaintext)));
+        elementRefs.push_back(*elements.back());
+    }
+
+    // Act
+    auto results = DiscreteLog::getAsync(elementRefs, G());
+    auto cached = DiscreteLog::getAsync(elementRefs, G());
+
+    // Assert
+    CHECK(results == plaintexts);
+    CHECK(cached == plaintexts);
+}
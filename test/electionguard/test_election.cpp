@@ -6,6 +6,7 @@
 #include <electionguard/election.hpp>
 #include <electionguard/elgamal.hpp>
 #include <electionguard/manifest.hpp>
+#include <electionguard/metrics.hpp>
 #include <unordered_map>
 
 using namespace electionguard;
@@ -80,3 +81,39 @@ TEST_CASE("Assign ExtraData to CiphertextElectionContextand Serialize")
     CHECK(fromJson->getExtendedData().at("uri") == context->getExtendedData().at("uri"));
     CHECK(fromBson->getExtendedData().at("uri") == context->getExtendedData().at("uri"));
 }
+
+TEST_CASE("CiphertextElectionContext registers its public key as a fixed base")
+{
+    // Arrange
+    auto keypair = ElGamalKeyPair::fromSecret(*rand_q());
+    auto otherKeypair = ElGamalKeyPair::fromSecret(*rand_q());
+    auto publicKey = ElementModP::fromHex(keypair->getPublicKey()->toHex());
+    auto otherPublicKey = ElementModP::fromHex(otherKeypair->getPublicKey()->toHex());
+    auto generator = ElementModP::fromHex(G().toHex());
+    auto exponent = rand_q();
+    auto expected = pow_mod_p(*publicKey, *exponent->toElementModP());
+    CHECK_FALSE(is_fixed_base(*publicKey));
+    CHECK_FALSE(is_fixed_base(*otherPublicKey));
+
+    // Act
+    auto context = CiphertextElectionContext::make(1UL, 1UL, publicKey->clone(),
+                                                   TWO_MOD_Q().clone(), TWO_MOD_Q().clone());
+    // a context carrying the other key that is only ever loaded from json
+    auto json = context->toJson();
+    auto keyHex = publicKey->toHex();
+    CHECK(json.find(keyHex) != string::npos);
+    json.replace(json.find(keyHex), keyHex.size(), otherPublicKey->toHex());
+    auto fromJson = CiphertextElectionContext::fromJson(json);
+    Metrics::reset();
+    auto actual = pow_mod_p(*publicKey, *exponent);
+
+    // Assert
+    CHECK(is_fixed_base(*publicKey));
+    CHECK(is_fixed_base(*otherPublicKey));
+    CHECK(is_fixed_base(*generator));
+    CHECK_FALSE(publicKey->isFixedBase());
+    CHECK(Metrics::get(Metric::powModPTable) == 1);
+    CHECK(Metrics::get(Metric::powModPFull) == 0);
+    CHECK(*actual == *expected);
+    CHECK(fromJson->getElGamalPublicKey()->isFixedBase());
+}
@@ -274,6 +274,53 @@ TEST_CASE("elgamalAdd simple decrypts with secret")
     CHECK(2UL == decrypted);
 }
 
+TEST_CASE("elgamalEncryptBatch matches elgamalEncrypt for each message")
+{
+    // Arrange
+    auto secret = ElementModQ::fromHex(a_fixed_secret);
+    auto keypair = ElGamalKeyPair::fromSecret(*secret);
+    auto *publicKey = keypair->getPublicKey();
+    vector<uint64_t> messages = {0UL, 1UL, 1UL, 0UL, 3UL, 1UL};
+    vector<unique_ptr<ElementModQ>> nonces;
+    vector<reference_wrapper<const ElementModQ>> nonceRefs;
+    for (size_t i = 0; i < messages.size(); i++) {
+        nonces.push_back(rand_q());
+        nonceRefs.push_back(*nonces.back());
+    }
+
+    // Act
+    auto batch = elgamalEncryptBatch(messages, nonceRefs, *publicKey);
+
+    // Assert
+    CHECK(batch.size() == messages.size());
+    for (size_t i = 0; i < messages.size(); i++) {
+        auto expected = elgamalEncrypt(messages[i], *nonces[i], *publicKey);
+        auto actual = batch.getCiphertext(i);
+        CHECK((*actual == *expected));
+        CHECK(actual->decrypt(*secret, *publicKey) == messages[i]);
+    }
+    CHECK(batch.getData(0) == batch.getPad(0) + messages.size() * MAX_P_LEN);
+}
+
+TEST_CASE("elgamalEncryptBatch without a fixed base and with a zero nonce")
+{
+    // Arrange
+    auto keypair = ElGamalKeyPair::fromSecret(TWO_MOD_Q(), false);
+    auto nonce = rand_q();
+    vector<uint64_t> messages = {1UL};
+    vector<reference_wrapper<const ElementModQ>> nonces = {*nonce};
+    vector<reference_wrapper<const ElementModQ>> zeroNonces = {ZERO_MOD_Q()};
+
+    // Act
+    auto batch = elgamalEncryptBatch(messages, nonces, *keypair->getPublicKey());
+
+    // Assert
+    auto expected = elgamalEncrypt(1UL, *nonce, *keypair->getPublicKey());
+    CHECK((*batch.getCiphertext(0) == *expected));
+    CHECK_THROWS(elgamalEncryptBatch(messages, zeroNonces, *keypair->getPublicKey()));
+    CHECK_THROWS(elgamalEncryptBatch({0UL, 1UL}, nonces, *keypair->getPublicKey()));
+}
+
 TEST_CASE("HashedElGamalCiphertext encrypt and decrypt data")
 {
     uint64_t qwords_to_use[4] = {0x0102030405060708, 0x090a0b0c0d0e0f10, 0x1112131415161718,
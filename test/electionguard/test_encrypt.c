@@ -11,6 +11,7 @@
 #include <electionguard/plaintext_ballot.generated.h>
 #include <electionguard/plaintext_ballot_selection.generated.h>
 #include <stdlib.h>
+#include <string.h>
 
 bool strings_are_equal(char *expected, char *actual);
 
@@ -18,13 +19,14 @@ static bool test_encrypt_selection(void);
 static bool test_encrypt_contest(void);
 static bool test_encrypt_ballot_simple_succeeds(void);
 static bool test_encrypt_ballot_simple_cast_removes_nonces(void);
+static bool test_encrypt_ballots_into_arena(void);
 
 bool test_encrypt(void)
 {
     printf("\n -------- test_encrypt.c --------- \n");
     return test_encrypt_selection() && test_encrypt_contest() &&
            test_encrypt_ballot_simple_succeeds() &&
-           test_encrypt_ballot_simple_cast_removes_nonces();
+           test_encrypt_ballot_simple_cast_removes_nonces() && test_encrypt_ballots_into_arena();
 }
 
 bool test_encrypt_selection(void)
@@ -315,3 +317,186 @@ bool test_encrypt_ballot_simple_cast_removes_nonces(void)
 
     return true;
 }
+
+bool test_encrypt_ballots_into_arena(void)
+{
+    printf("\n -------- test_encrypt_ballots_into_arena -------- \n");
+
+    // Arrange
+
+    eg_element_mod_q_t *two_mod_q = NULL;
+    if (eg_element_mod_q_new(TWO_MOD_Q_ARRAY, &two_mod_q)) {
+        assert(false);
+    }
+
+    eg_elgamal_keypair_t *key_pair = NULL;
+    if (eg_elgamal_keypair_from_secret_new(two_mod_q, &key_pair)) {
+        assert(false);
+    }
+
+    eg_element_mod_p_t *public_key = NULL;
+    if (eg_elgamal_keypair_get_public_key(key_pair, &public_key)) {
+        assert(false);
+    }
+
+    eg_election_manifest_t *description = NULL;
+    if (eg_test_election_mocks_get_simple_election_from_file(&description)) {
+        assert(false);
+    }
+
+    eg_internal_manifest_t *metadata = NULL;
+    eg_ciphertext_election_context_t *context = NULL;
+    if (eg_test_election_mocks_get_fake_ciphertext_election(description, public_key, &metadata,
+                                                            &context)) {
+        assert(false);
+    }
+
+    eg_encryption_device_t *device = NULL;
+    if (eg_encryption_device_new(12345UL, 23456UL, 34567UL, "Location", &device)) {
+        assert(false);
+    }
+
+    eg_encryption_mediator_t *mediator = NULL;
+    if (eg_encryption_mediator_new(metadata, context, device, &mediator)) {
+        assert(false);
+    }
+
+    eg_plaintext_ballot_t *ballot = NULL;
+    if (eg_test_ballot_mocks_get_simple_ballot_from_file(&ballot)) {
+        assert(false);
+    }
+
+    char *json = NULL;
+    uint64_t json_size = 0;
+    if (eg_plaintext_ballot_to_json(ballot, &json, &json_size)) {
+        assert(false);
+    }
+    json_size = strlen(json);
+
+    // the same ballot twice in one contiguous buffer
+    uint8_t *plaintexts = malloc(2 * json_size);
+    memcpy(plaintexts, json, json_size);
+    memcpy(plaintexts + json_size, json, json_size);
+    uint64_t plaintext_offsets[3] = {0, json_size, 2 * json_size};
+
+    // Act
+
+    uint64_t offsets[3] = {0};
+    uint64_t required_size = 0;
+    const char *malformed = "{\"object_id\": ";
+    uint64_t malformed_offsets[2] = {0, strlen(malformed)};
+    eg_electionguard_status_t malformed_status = eg_encryption_mediator_encrypt_ballots(
+      mediator, (const uint8_t *)malformed, malformed_offsets, 1,
+      ELECTIONGUARD_BALLOT_SERIALIZATION_JSON, ELECTIONGUARD_BALLOT_SERIALIZATION_MSGPACK, false,
+      false, 2, NULL, 0, offsets, &required_size);
+
+    uint8_t too_small[1] = {0};
+    eg_electionguard_status_t too_small_status = eg_encryption_mediator_encrypt_ballots(
+      mediator, plaintexts, plaintext_offsets, 2, ELECTIONGUARD_BALLOT_SERIALIZATION_JSON,
+      ELECTIONGUARD_BALLOT_SERIALIZATION_MSGPACK, false, false, 2, too_small, sizeof(too_small),
+      offsets, &required_size);
+
+    // leave room for the retry to serialize differently
+    uint64_t arena_size = 2 * required_size;
+    uint8_t *arena = malloc(arena_size);
+    if (eg_encryption_mediator_encrypt_ballots(
+          mediator, plaintexts, plaintext_offsets, 2, ELECTIONGUARD_BALLOT_SERIALIZATION_JSON,
+          ELECTIONGUARD_BALLOT_SERIALIZATION_MSGPACK, false, false, 2, arena, arena_size,
+          offsets, &required_size)) {
+        assert(false);
+    }
+
+    // a fresh mediator starts the chain from the same seed
+    eg_encryption_mediator_t *fresh_mediator = NULL;
+    if (eg_encryption_mediator_new(metadata, context, device, &fresh_mediator)) {
+        assert(false);
+    }
+
+    eg_ciphertext_ballot_t *fresh = NULL;
+    if (eg_encryption_mediator_encrypt_ballot(fresh_mediator, ballot, false, &fresh)) {
+        assert(false);
+    }
+
+    // Assert
+    assert(malformed_status == ELECTIONGUARD_STATUS_ERROR_INVALID_ARGUMENT);
+    assert(too_small_status == ELECTIONGUARD_STATUS_ERROR_OUT_OF_RANGE);
+    assert(offsets[0] == 0);
+    assert(offsets[2] == required_size);
+    assert(required_size <= arena_size);
+
+    eg_ciphertext_ballot_t *first = NULL;
+    if (eg_ciphertext_ballot_from_msgpack(arena, offsets[1], &first)) {
+        assert(false);
+    }
+
+    eg_ciphertext_ballot_t *second = NULL;
+    if (eg_ciphertext_ballot_from_msgpack(arena + offsets[1], offsets[2] - offsets[1], &second)) {
+        assert(false);
+    }
+
+    char *plaintext_id = NULL;
+    if (eg_plaintext_ballot_get_object_id(ballot, &plaintext_id)) {
+        assert(false);
+    }
+
+    char *first_id = NULL;
+    if (eg_ciphertext_ballot_get_object_id(first, &first_id)) {
+        assert(false);
+    }
+
+    char *second_id = NULL;
+    if (eg_ciphertext_ballot_get_object_id(second, &second_id)) {
+        assert(false);
+    }
+
+    assert(strings_are_equal(plaintext_id, first_id) == true);
+    assert(strings_are_equal(plaintext_id, second_id) == true);
+
+    // the failed calls rolled the chain back, so the retry chains from the original seed
+    eg_element_mod_q_t *first_seed = NULL;
+    if (eg_ciphertext_ballot_get_ballot_code_seed(first, &first_seed)) {
+        assert(false);
+    }
+
+    eg_element_mod_q_t *fresh_seed = NULL;
+    if (eg_ciphertext_ballot_get_ballot_code_seed(fresh, &fresh_seed)) {
+        assert(false);
+    }
+
+    uint64_t *first_seed_data = NULL;
+    uint64_t first_seed_size = 0;
+    if (eg_element_mod_q_get_data(first_seed, &first_seed_data, &first_seed_size)) {
+        assert(false);
+    }
+
+    uint64_t *fresh_seed_data = NULL;
+    uint64_t fresh_seed_size = 0;
+    if (eg_element_mod_q_get_data(fresh_seed, &fresh_seed_data, &fresh_seed_size)) {
+        assert(false);
+    }
+
+    assert(first_seed_size == fresh_seed_size);
+    assert(memcmp(first_seed_data, fresh_seed_data, first_seed_size * sizeof(uint64_t)) == 0);
+
+    // Clean Up
+    eg_ciphertext_ballot_free(fresh);
+    eg_encryption_mediator_free(fresh_mediator);
+    free(second_id);
+    free(first_id);
+    free(plaintext_id);
+    eg_ciphertext_ballot_free(second);
+    eg_ciphertext_ballot_free(first);
+    free(arena);
+    free(plaintexts);
+    free(json);
+    eg_plaintext_ballot_free(ballot);
+    eg_encryption_mediator_free(mediator);
+    eg_encryption_device_free(device);
+    eg_ciphertext_election_context_free(context);
+    eg_internal_manifest_free(metadata);
+    eg_election_manifest_free(description);
+    eg_elgamal_keypair_free(key_pair);
+    eg_element_mod_q_free(two_mod_q);
+
+    return true;
+}
@@ -255,6 +255,67 @@ TEST_CASE("Encrypt simple PlaintextBallot with EncryptionMediator succeeds")
     auto bson = ciphertext->toBson();
     auto fromBson = CiphertextBallot::fromBson(bson);
     CHECK(fromBson->getNonce()->toHex() == ZERO_MOD_Q().toHex());
+
+    auto binary = ciphertext->toBinary();
+    auto fromBinary = CiphertextBallot::fromBinary(binary);
+    CHECK(fromBinary->getNonce()->toHex() == ZERO_MOD_Q().toHex());
+    CHECK(fromBinary->getCryptoHash()->toHex() == ciphertext->getCryptoHash()->toHex());
+    CHECK(fromBinary->toJson() == ciphertext->toJson());
+    CHECK(fromBinary->toBinary() == binary);
+    CHECK(binary.size() < ciphertext->toMsgPack().size());
+
+    auto binaryWithNonces = ciphertext->toBinary(true);
+    auto fromBinaryWithNonces = CiphertextBallot::fromBinary(binaryWithNonces);
+    CHECK(fromBinaryWithNonces->getNonce()->toHex() == ciphertext->getNonce()->toHex());
+    CHECK(fromBinaryWithNonces->toJson(true) == ciphertext->toJson(true));
+
+    auto truncated = vector<uint8_t>(binary.begin(), binary.end() - 1);
+    CHECK_THROWS(CiphertextBallot::fromBinary(truncated));
+    CHECK_THROWS(SubmittedBallot::fromBinary(binary));
+
+    auto submitted = SubmittedBallot::from(*ciphertext, BallotBoxState::cast);
+    auto fromSubmittedBinary = SubmittedBallot::fromBinary(submitted->toBinary());
+    CHECK(fromSubmittedBinary->getState() == BallotBoxState::cast);
+    CHECK(fromSubmittedBinary->toJson() == submitted->toJson());
+}
+
+TEST_CASE("Encrypt simple PlaintextBallot and load it with validated residues")
+{
+    // Arrange
+    auto secret = ElementModQ::fromHex(a_fixed_secret);
+    auto keypair = ElGamalKeyPair::fromSecret(*secret);
+    auto manifest = ManifestGenerator::getJeffersonCountyManifest_Minimal();
+    auto internal = make_unique<InternalManifest>(*manifest);
+    auto context = ElectionGenerator::getFakeContext(*internal, *keypair->getPublicKey());
+    auto device = make_unique<EncryptionDevice>(12345UL, 23456UL, 34567UL, "Location");
+    auto mediator = make_unique<EncryptionMediator>(*internal, *context, *device);
+    auto plaintext = BallotGenerator::getFakeBallot(*manifest);
+    auto ciphertext = mediator->encrypt(*plaintext);
+    auto json = ciphertext->toJson();
+    auto msgPack = ciphertext->toMsgPack();
+
+    // -pad mod p is outside of the subgroup only by its order two component
+    auto &selection = ciphertext->getContests()[0].get().getSelections()[0].get();
+    auto *pad = selection.getCiphertext()->getPad();
+    uint64_t minusOne[MAX_P_LEN] = {};
+    copy(P().cget(), P().cget() + MAX_P_LEN, minusOne);
+    minusOne[0] -= 1;
+    auto negatedPad = mul_mod_p(*pad, ElementModP(minusOne, true));
+    auto tampered = json;
+    auto position = tampered.find(pad->toHex());
+    REQUIRE(position != string::npos);
+    tampered.replace(position, pad->toHex().size(), negatedPad->toHex());
+
+    // Act
+    auto fromJson = CiphertextBallot::fromJson(json, true);
+    auto fromMsgPack = CiphertextBallot::fromMsgPack(msgPack, true);
+    auto unvalidated = CiphertextBallot::fromJson(tampered);
+
+    // Assert
+    CHECK(fromJson->getObjectId() == ciphertext->getObjectId());
+    CHECK(fromMsgPack->getObjectId() == ciphertext->getObjectId());
+    CHECK(unvalidated->getObjectId() == ciphertext->getObjectId());
+    CHECK_THROWS(CiphertextBallot::fromJson(tampered, true));
 }
 
 TEST_CASE("Encrypt full PlaintextBallot with WriteIn and Overvote with EncryptionMediator succeeds")
@@ -336,6 +397,69 @@ TEST_CASE("Encrypt simple CompactPlaintextBallot with EncryptionMediator succeed
     CHECK(compactCiphertext->getObjectId() == plaintext->getObjectId());
 }
 
+TEST_CASE("Encrypt batch of PlaintextBallots with EncryptionMediator chains in submission order")
+{
+    // Arrange
+    auto secret = ElementModQ::fromHex(a_fixed_secret);
+    auto keypair = ElGamalKeyPair::fromSecret(*secret);
+    auto manifest = ManifestGenerator::getJeffersonCountyManifest_Minimal();
+    auto internal = make_unique<InternalManifest>(*manifest);
+    auto context = ElectionGenerator::getFakeContext(*internal, *keypair->getPublicKey());
+    auto device = make_unique<EncryptionDevice>(12345UL, 23456UL, 34567UL, "Location");
+    auto mediator = make_unique<EncryptionMediator>(*internal, *context, *device);
+
+    vector<unique_ptr<PlaintextBallot>> plaintexts;
+    vector<reference_wrapper<const PlaintextBallot>> ballots;
+    for (auto i = 0; i < 5; i++) {
+        plaintexts.push_back(BallotGenerator::getFakeBallot(*internal));
+        ballots.push_back(ref(*plaintexts.back()));
+    }
+
+    // Act
+    auto ciphertexts = mediator->encryptBatch(ballots, true, false, 2);
+    auto next = mediator->encrypt(*plaintexts.front());
+
+    // Assert
+    REQUIRE(ciphertexts.size() == plaintexts.size());
+    CHECK(*ciphertexts.front()->getBallotCodeSeed() == *device->getHash());
+    for (size_t i = 0; i < ciphertexts.size(); i++) {
+        CHECK(ciphertexts[i]->getObjectId() == plaintexts[i]->getObjectId());
+        CHECK(ciphertexts[i]->isValidEncryption(*context->getManifestHash(),
+                                                *keypair->getPublicKey(),
+                                                *context->getCryptoExtendedBaseHash()));
+        if (i > 0) {
+            CHECK(*ciphertexts[i]->getBallotCodeSeed() == *ciphertexts[i - 1]->getBallotCode());
+        }
+    }
+    CHECK(*next->getBallotCodeSeed() == *ciphertexts.back()->getBallotCode());
+}
+
+TEST_CASE("Encrypt batch with EncryptionMediator keeps the chain when a ballot fails")
+{
+    // Arrange
+    auto secret = ElementModQ::fromHex(a_fixed_secret);
+    auto keypair = ElGamalKeyPair::fromSecret(*secret);
+    auto manifest = ManifestGenerator::getJeffersonCountyManifest_Minimal();
+    auto internal = make_unique<InternalManifest>(*manifest);
+    auto context = ElectionGenerator::getFakeContext(*internal, *keypair->getPublicKey());
+    auto device = make_unique<EncryptionDevice>(12345UL, 23456UL, 34567UL, "Location");
+    auto mediator = make_unique<EncryptionMediator>(*internal, *context, *device);
+
+    auto valid = BallotGenerator::getFakeBallot(*internal);
+    auto invalid = make_unique<PlaintextBallot>("invalid-ballot", "invalid-style",
+                                                vector<unique_ptr<PlaintextBallotContest>>());
+    vector<reference_wrapper<const PlaintextBallot>> ballots{ref(*valid), ref(*valid),
+                                                             ref(*invalid)};
+
+    // Act
+    CHECK_THROWS(mediator->encryptBatch(ballots, true, false, 2));
+    auto next = mediator->encrypt(*valid);
+
+    // Assert
+    CHECK(*mediator->getBallotCodeSeed() == *next->getBallotCode());
+    CHECK(*next->getBallotCodeSeed() == *device->getHash());
+}
+
 TEST_CASE("Encrypt simple ballot from file with mediator succeeds")
 {
     // Arrange
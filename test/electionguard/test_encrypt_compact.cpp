@@ -55,6 +55,26 @@ TEST_CASE("Can Serialize CompactCiphertextBallot")
     auto msgpack = fixture->compactCiphertext->toMsgPack();
     auto fromMsgpack = CompactCiphertextBallot::fromMsgPack(msgpack);
     CHECK(fromMsgpack->getNonce()->toHex() == fixture->compactCiphertext->getNonce()->toHex());
+
+    auto binary = fixture->compactCiphertext->toBinary();
+    auto fromBinary = CompactCiphertextBallot::fromBinary(binary);
+    CHECK(fromBinary->getNonce()->toHex() == fixture->compactCiphertext->getNonce()->toHex());
+    CHECK(fromBinary->getPlaintext()->getSelections() ==
+          fixture->compactCiphertext->getPlaintext()->getSelections());
+    CHECK(fromBinary->toBinary() == binary);
+
+    // the ballot box state is the last field
+    auto corrupt = binary;
+    corrupt[corrupt.size() - 2] = 0;
+    corrupt[corrupt.size() - 1] = 7;
+    CHECK_THROWS(CompactCiphertextBallot::fromBinary(corrupt));
+
+    // 2^32 + 1 would be read as cast if the state were truncated to an int
+    auto outOfRange = binary;
+    fill(outOfRange.end() - 8, outOfRange.end(), 0);
+    outOfRange[outOfRange.size() - 5] = 1;
+    outOfRange[outOfRange.size() - 1] = 1;
+    CHECK_THROWS(CompactCiphertextBallot::fromBinary(outOfRange));
 }
 
 TEST_CASE("Can Expand Plaintext")
@@ -87,3 +107,28 @@ TEST_CASE("Can Expand Ciphertext")
             *fixture->context->getManifestHash(), *fixture->keypair->getPublicKey(),
             *fixture->context->getCryptoExtendedBaseHash()) == true);
 }
+
+TEST_CASE("Can Expand batch of Ciphertexts without verifying proofs")
+{
+    // Arrange
+    auto fixture = make_unique<TestEncryptFixture>();
+    auto second = fixture->mediator->compactEncrypt(*fixture->plaintext);
+    vector<reference_wrapper<const CompactCiphertextBallot>> compactCiphertexts = {
+      ref(*fixture->compactCiphertext), ref(*second)};
+
+    // Act
+    auto expanded =
+      expandCompactCiphertextBallots(compactCiphertexts, *fixture->internal, *fixture->context,
+                                     false, 2);
+
+    // Assert
+    REQUIRE(expanded.size() == 2);
+    CHECK(*expanded[0]->getBallotCode() == *fixture->compactCiphertext->getBallotCode());
+    CHECK(*expanded[1]->getBallotCode() == *second->getBallotCode());
+    CHECK(*expanded[1]->getBallotCodeSeed() == *expanded[0]->getBallotCode());
+    for (const auto &ciphertext : expanded) {
+        CHECK(ciphertext->isValidEncryption(*fixture->context->getManifestHash(),
+                                            *fixture->keypair->getPublicKey(),
+                                            *fixture->context->getCryptoExtendedBaseHash()));
+    }
+}
@@ -5,15 +5,17 @@
 #include <electionguard/constants.h>
 #include <electionguard/group.h>
 #include <stdlib.h>
+#include <string.h>
 
 bool strings_are_equal(char *expected, char *actual);
 
 static bool test_g_pow_p_with_random(void);
+static bool test_borrowed_elements(void);
 
 bool test_group(void)
 {
     printf("\n -------- test_group.c --------- \n");
-    return test_g_pow_p_with_random();
+    return test_g_pow_p_with_random() && test_borrowed_elements();
 }
 
 bool test_g_pow_p_with_random(void)
@@ -51,3 +53,76 @@ bool test_g_pow_p_with_random(void)
 
     return true;
 }
+
+bool test_borrowed_elements(void)
+{
+    printf("\n -------- test_borrowed_elements -------- \n");
+
+    // Arrange
+    eg_element_mod_p_t *g = NULL;
+    if (eg_element_mod_p_constant_g(&g)) {
+        assert(false);
+    }
+
+    uint64_t *g_data = NULL;
+    uint64_t g_size = 0;
+    if (eg_element_mod_p_get_data(g, &g_data, &g_size)) {
+        assert(false);
+    }
+
+    // the generator and zero, contiguously
+    uint64_t *limbs = calloc(2 * MAX_P_LEN, sizeof(uint64_t));
+    memcpy(limbs, g_data, MAX_P_SIZE);
+
+    eg_element_mod_q_t *e = NULL;
+    if (eg_element_mod_q_rand_q_new(&e)) {
+        assert(false);
+    }
+
+    // Act
+    eg_element_mod_p_t *borrowed = NULL;
+    if (eg_element_mod_p_borrow(limbs, &borrowed)) {
+        assert(false);
+    }
+
+    eg_element_mod_p_t *expected = NULL;
+    if (eg_element_mod_q_pow_mod_p(g, e, &expected)) {
+        assert(false);
+    }
+
+    eg_element_mod_p_t *actual = NULL;
+    if (eg_element_mod_q_pow_mod_p(borrowed, e, &actual)) {
+        assert(false);
+    }
+
+    bool valid[2] = {false, true};
+    if (eg_element_mod_p_is_valid_residue_batch(limbs, 2, valid)) {
+        assert(false);
+    }
+
+    // Assert
+    char *expected_hex = NULL;
+    if (eg_element_mod_p_to_hex(expected, &expected_hex)) {
+        assert(false);
+    }
+
+    char *actual_hex = NULL;
+    if (eg_element_mod_p_to_hex(actual, &actual_hex)) {
+        assert(false);
+    }
+
+    assert(strings_are_equal(expected_hex, actual_hex) == true);
+    assert(valid[0] == true);
+    assert(valid[1] == false);
+
+    // Clean Up
+    free(actual_hex);
+    free(expected_hex);
+    eg_element_mod_p_free(actual);
+    eg_element_mod_p_free(expected);
+    eg_element_mod_p_free(borrowed);
+    eg_element_mod_q_free(e);
+    free(limbs);
+
+    return true;
+}
@@ -2,6 +2,7 @@
 #include "../../src/electionguard/convert.hpp"
 #include "../../src/electionguard/facades/bignum4096.hpp"
 #include "../../src/electionguard/log.hpp"
+#include "../../src/electionguard/lookup_table.hpp"
 #include "../../src/electionguard/utils.hpp"
 #include "utils/byte_logger.hpp"
 #include "utils/constants.hpp"
@@ -9,8 +10,11 @@
 #include <algorithm>
 #include <cmath>
 #include <doctest/doctest.h>
+#include <electionguard/async.hpp>
 #include <electionguard/constants.h>
+#include <electionguard/elgamal.hpp>
 #include <electionguard/group.hpp>
+#include <electionguard/hash.hpp>
 #include <exception>
 #include <iostream>
 #include <string>
@@ -598,6 +602,100 @@ TEST_CASE("pow_mod_p 2 ^ 3 = 8 and 3 ^ 2 = 9")
     CHECK((*result9 == *nine));
 }
 
+TEST_CASE("pow_mod_p_multi equals the product of each pow_mod_p")
+{
+    // Arrange
+    vector<unique_ptr<ElementModP>> bases;
+    vector<unique_ptr<ElementModQ>> exponents;
+    vector<reference_wrapper<const ElementModP>> baseRefs;
+    vector<reference_wrapper<const ElementModQ>> exponentRefs;
+    auto expected = ElementModP::fromUint64(1UL);
+    for (size_t i = 0; i < 5; i++) {
+        bases.push_back(g_pow_p(*rand_q()));
+        exponents.push_back(i == 2 ? ElementModQ::fromUint64(0UL) : rand_q());
+        baseRefs.push_back(*bases.back());
+        exponentRefs.push_back(*exponents.back());
+        expected = mul_mod_p(*expected, *pow_mod_p(*bases.back(), *exponents.back()));
+    }
+
+    // Act
+    auto result = pow_mod_p_multi(baseRefs, exponentRefs);
+    auto empty = pow_mod_p_multi({}, {});
+
+    // Assert
+    CHECK((*result == *expected));
+    CHECK((*empty == ONE_MOD_P()));
+    CHECK_THROWS(pow_mod_p_multi(baseRefs, {}));
+}
+
+TEST_CASE("is_valid_residue_batch matches isValidResidue for each element")
+{
+    // Arrange
+    uint64_t minusOne[MAX_P_LEN] = {};
+    copy(P().cget(), P().cget() + MAX_P_LEN, minusOne);
+    minusOne[0] -= 1;
+    vector<unique_ptr<ElementModP>> valid;
+    vector<reference_wrapper<const ElementModP>> validRefs;
+    for (size_t i = 0; i < 6; i++) {
+        valid.push_back(g_pow_p(*rand_q()));
+        validRefs.push_back(*valid.back());
+    }
+    // outside of the subgroup by the order two component, the large cofactor and the bounds
+    auto negated = mul_mod_p(*valid[0], ElementModP(minusOne, true));
+    auto random = rand_p();
+    auto mixed = validRefs;
+    mixed.insert(mixed.begin() + 2, *negated);
+    mixed.push_back(*random);
+    mixed.push_back(ZERO_MOD_P());
+
+    // Act
+    auto validResults = is_valid_residue_batch(validRefs);
+    auto mixedResults = is_valid_residue_batch(mixed);
+
+    // Assert
+    CHECK(validResults == vector<bool>(validRefs.size(), true));
+    CHECK(mixedResults.size() == mixed.size());
+    for (size_t i = 0; i < mixed.size(); i++) {
+        CHECK(mixedResults[i] == mixed[i].get().isValidResidue());
+    }
+    CHECK(mixedResults[2] == false);
+    CHECK(is_valid_residue_batch({}).empty());
+}
+
+#pragma endregion
+
+#pragma region div_mod_p
+
+TEST_CASE("div_mod_p_batch equals div_mod_p for each pair")
+{
+    // Arrange
+    const size_t count = 7;
+    vector<uint64_t> numerators(count * MAX_P_LEN);
+    vector<uint64_t> denominators(count * MAX_P_LEN);
+    vector<unique_ptr<ElementModP>> expected;
+    for (size_t i = 0; i < count; i++) {
+        auto numerator = g_pow_p(*rand_q());
+        auto denominator = g_pow_p(*rand_q());
+        copy(numerator->cget(), numerator->cget() + MAX_P_LEN,
+             numerators.data() + i * MAX_P_LEN);
+        copy(denominator->cget(), denominator->cget() + MAX_P_LEN,
+             denominators.data() + i * MAX_P_LEN);
+        expected.push_back(div_mod_p(*numerator, *denominator));
+    }
+    vector<uint64_t> results(count * MAX_P_LEN);
+    vector<uint64_t> zeros(MAX_P_LEN);
+
+    // Act
+    div_mod_p_batch(numerators.data(), denominators.data(), count, results.data());
+
+    // Assert
+    for (size_t i = 0; i < count; i++) {
+        CHECK(equal(expected[i]->cget(), expected[i]->cget() + MAX_P_LEN,
+                    results.data() + i * MAX_P_LEN));
+    }
+    CHECK_THROWS(div_mod_p_batch(numerators.data(), zeros.data(), 1, results.data()));
+}
+
 #pragma endregion
 
 #pragma region g_pow_p
@@ -779,3 +877,384 @@ TEST_CASE("Test G is converted correctly")
 }
 
 #pragma endregion
+
+#pragma region Hex Codec
+
+TEST_CASE("Hex codec round trips bytes of every width")
+{
+    // Arrange
+    const char *digits = "0123456789ABCDEF";
+    vector<uint8_t> bytes(MAX_P_SIZE);
+    for (size_t i = 0; i < bytes.size(); i++) {
+        bytes[i] = static_cast<uint8_t>((i * 167 + 13) & 0xFF);
+    }
+
+    for (size_t size = 0; size <= 80; size++) {
+        // Act
+        string hex(size * 2, '\0');
+        auto written = hex_encode(bytes.data(), size, &hex[0]);
+        vector<uint8_t> decoded(size);
+        auto read = hex_decode(hex.data(), hex.size(), decoded.data());
+
+        // Assert
+        CHECK(written == size * 2);
+        CHECK(read == size);
+        CHECK(equal(decoded.begin(), decoded.end(), bytes.begin()));
+        for (size_t i = 0; i < size; i++) {
+            CHECK(hex[2 * i] == digits[bytes[i] >> 4]);
+            CHECK(hex[2 * i + 1] == digits[bytes[i] & 0x0F]);
+        }
+    }
+}
+
+TEST_CASE("Hex codec decodes lower case and rejects invalid characters")
+{
+    // Arrange
+    string lower("0a1b2c3d4e5f6a7b8c9d0e1f2a3b4c5d6e7f8a9b0c1d2e3f4a5b6c7d8e9f0a1b");
+    string invalid(lower);
+    invalid[40] = 'g';
+    vector<uint8_t> decoded(lower.size() / 2);
+
+    // Act
+    hex_decode(lower.data(), lower.size(), decoded.data());
+    string upper(lower.size(), '\0');
+    hex_encode(decoded.data(), decoded.size(), &upper[0]);
+
+    // Assert
+    string expected(lower);
+    transform(expected.begin(), expected.end(), expected.begin(), ::toupper);
+    CHECK(upper == expected);
+    CHECK_THROWS(hex_decode(invalid.data(), invalid.size(), decoded.data()));
+    CHECK_THROWS(hex_decode("0", 1, decoded.data()));
+}
+
+TEST_CASE("Hex string with leading zeros and odd length converts to the same element")
+{
+    // Act
+    auto padded = ElementModQ::fromHex("  000F0F");
+    auto odd = ElementModQ::fromHex("f0f");
+    auto zero = ElementModP::fromHex("0000");
+
+    // Assert
+    CHECK(padded->toHex() == "0F0F");
+    CHECK(odd->toHex() == "0F0F");
+    CHECK(*zero == ZERO_MOD_P());
+    CHECK(zero->toHex() == "00");
+    CHECK_THROWS(ElementModQ::fromHex(Q().toHex() + "00"));
+}
+
+#pragma endregion
+
+#pragma region Representation Cache
+
+TEST_CASE("Cached representation is discarded after mutable access")
+{
+    // Arrange
+    auto p = ElementModP::fromUint64(0x0F0F);
+    auto q = ElementModQ::fromUint64(0x0F0F);
+    p->setIsCacheable(true);
+    q->setIsCacheable(true);
+    CHECK(p->toHex() == "0F0F");
+    CHECK(q->toHex() == "0F0F");
+    CHECK(q->toBytes().back() == 0x0F);
+
+    // Act
+    p->get()[0] = 0x0A0A;
+    q->ref()[0] = 0x0A0A;
+
+    // Assert
+    CHECK(p->isCacheable());
+    CHECK(p->toHex() == "0A0A");
+    CHECK(q->toHex() == "0A0A");
+    CHECK(q->toBytes().back() == 0x0A);
+    CHECK(*p->clone() == *p);
+    CHECK(p->clone()->isCacheable());
+}
+
+TEST_CASE("Secret elements do not cache their representation")
+{
+    // Arrange
+    auto secret = ElementModQ::fromUint64(0x0F0F);
+    secret->setIsCacheable(true);
+    secret->setIsSecret(true);
+    auto keyPair = ElGamalKeyPair::fromSecret(*ElementModQ::fromUint64(2));
+
+    // Act
+    auto hex = secret->toHex();
+    auto clone = secret->clone();
+
+    // Assert
+    CHECK(hex == "0F0F");
+    CHECK_FALSE(secret->isCacheable());
+    CHECK(clone->isSecret());
+    CHECK(keyPair->getSecretKey()->isSecret());
+    CHECK(keyPair->getPublicKey()->isCacheable());
+    CHECK(rand_q()->isSecret());
+}
+
+TEST_CASE("Hash of a cached element matches the hash of an uncached copy")
+{
+    // Arrange
+    auto cached = ElementModP::fromHex(G().toHex());
+    auto uncached = ElementModP::fromHex(G().toHex());
+    cached->setIsCacheable(true);
+
+    // Act
+    auto first = hash_elems({cached.get(), &const_cast<ElementModQ &>(ONE_MOD_Q())});
+    auto second = hash_elems({cached.get(), &const_cast<ElementModQ &>(ONE_MOD_Q())});
+    auto expected = hash_elems({uncached.get(), ElementModQ::fromUint64(1).get()});
+
+    // Assert
+    CHECK(G().isCacheable());
+    CHECK_FALSE(uncached->isCacheable());
+    CHECK(*first == *expected);
+    CHECK(*second == *expected);
+}
+
+#pragma endregion
+
+#pragma region Borrowed Elements
+
+TEST_CASE("Borrowed elements read the caller's limbs in place")
+{
+    // Arrange
+    auto base = rand_p();
+    auto exponent = rand_q();
+    vector<uint64_t> baseLimbs(base->cget(), base->cget() + MAX_P_LEN);
+    vector<uint64_t> exponentLimbs(exponent->cget(), exponent->cget() + MAX_Q_LEN);
+
+    // Act
+    auto borrowedBase = ElementModP::borrow(baseLimbs.data());
+    auto borrowedExponent = ElementModQ::borrow(exponentLimbs.data());
+    auto result = pow_mod_p(*borrowedBase, *borrowedExponent);
+
+    // Assert
+    CHECK(borrowedBase->isBorrowed());
+    CHECK(borrowedExponent->isBorrowed());
+    CHECK(borrowedBase->cget() == baseLimbs.data());
+    CHECK(borrowedExponent->cget() == exponentLimbs.data());
+    CHECK(*borrowedBase == *base);
+    CHECK(borrowedExponent->toHex() == exponent->toHex());
+    CHECK(*result == *pow_mod_p(*base, *exponent));
+    CHECK(*hash_elems({borrowedBase.get(), borrowedExponent.get()}) ==
+          *hash_elems({base.get(), exponent.get()}));
+    CHECK_FALSE(borrowedBase->clone()->isBorrowed());
+    CHECK_THROWS(ElementModQ::borrow(vector<uint64_t>(MAX_Q_LEN, ~0ULL).data()));
+}
+
+TEST_CASE("Borrowed elements copy the caller's limbs before they are mutated")
+{
+    // Arrange
+    vector<uint64_t> limbs(MAX_P_LEN, 0);
+    limbs[0] = 0x0F0F;
+    auto borrowed = ElementModP::borrow(limbs.data());
+
+    // Act
+    borrowed->get()[0] = 0x0A0A;
+
+    // Assert
+    CHECK_FALSE(borrowed->isBorrowed());
+    CHECK(limbs[0] == 0x0F0F);
+    CHECK(borrowed->toHex() == "0A0A");
+}
+
+TEST_CASE("Borrowed elements shared across threads keep their value while they are copied")
+{
+    // Arrange
+    auto base = rand_p();
+    vector<uint64_t> limbs(base->cget(), base->cget() + MAX_P_LEN);
+    auto borrowed = ElementModP::borrow(limbs.data());
+    auto expected = base->toHex();
+
+    // Act
+    auto readers = map_async<bool>(8, 4, [&](size_t task) {
+        if (task % 2 == 0) {
+            // mutable access copies the limbs without changing the value
+            return borrowed->ref()[0] == limbs[0];
+        }
+        return borrowed->toHex() == expected && *borrowed == *base;
+    });
+
+    // Assert
+    CHECK(std::all_of(readers.begin(), readers.end(), [](bool read) { return read; }));
+    CHECK_FALSE(borrowed->isBorrowed());
+    CHECK(*borrowed == *base);
+}
+
+#pragma endregion
+
+TEST_CASE("Lookup tables give the same result for every memory policy and replica")
+{
+    // Arrange
+    auto base = G();
+    auto exponent = rand_q();
+    auto expected = pow_mod_p(base, *exponent->toElementModP());
+    LookupTableType standard(const_cast<uint64_t *>(base.cget()), TableMemoryPolicy::standard);
+    LookupTableType transparent(const_cast<uint64_t *>(base.cget()),
+                                TableMemoryPolicy::transparentHugePages);
+    LookupTableType explicitPages(const_cast<uint64_t *>(base.cget()),
+                                  TableMemoryPolicy::explicitHugePages);
+    LookupTableType replica(standard, TableMemoryPolicy::transparentHugePages);
+
+    // Act
+    auto &limbs = const_cast<uint64_t(&)[MAX_Q_LEN]>(exponent->cref());
+    ElementModP fromStandard(standard.pow_mod_p(limbs), true);
+    ElementModP fromTransparent(transparent.pow_mod_p(limbs), true);
+    ElementModP fromExplicit(explicitPages.pow_mod_p(limbs), true);
+    ElementModP fromReplica(replica.pow_mod_p(limbs), true);
+
+    // Assert
+    CHECK(standard.getMemoryPolicy() == TableMemoryPolicy::standard);
+    CHECK(replica.getMemoryPolicy() != TableMemoryPolicy::explicitHugePages);
+    CHECK((fromStandard == *expected));
+    CHECK((fromTransparent == *expected));
+    CHECK((fromExplicit == *expected));
+    CHECK((fromReplica == *expected));
+    CHECK(TableMemory::getNumaNodeCount() >= 1);
+    CHECK(TableMemory::getCurrentNumaNode() < TableMemory::getNumaNodeCount());
+}
+
+TEST_CASE("Comb tables give the same result as pow_mod_p for every layout")
+{
+    // Arrange
+    auto base = rand_p();
+    auto exponents = std::vector<std::unique_ptr<ElementModQ>>();
+    exponents.push_back(rand_q());
+    exponents.push_back(ElementModQ::fromUint64(1));
+    exponents.push_back(sub_mod_q(ZERO_MOD_Q(), ONE_MOD_Q()));
+    auto layouts = std::vector<std::pair<uint32_t, uint32_t>>{{8, 32}, {7, 5}, {4, 4}, {12, 4}};
+
+    for (const auto &layout : layouts) {
+        // Act
+        CombTable comb(const_cast<uint64_t *>(base->cget()), layout.first, layout.second,
+                       TableMemoryPolicy::standard);
+        auto replica = comb.replicate(TableMemoryPolicy::transparentHugePages);
+
+        // Assert
+        for (const auto &exponent : exponents) {
+            auto expected = pow_mod_p(*base, *exponent->toElementModP());
+            auto &limbs = const_cast<uint64_t(&)[MAX_Q_LEN]>(exponent->cref());
+            ElementModP fromComb(comb.pow_mod_p(limbs), true);
+            ElementModP fromReplica(replica->pow_mod_p(limbs), true);
+            CHECK((fromComb == *expected));
+            CHECK((fromReplica == *expected));
+        }
+    }
+}
+
+TEST_CASE("Lookup table context builds the layout selected for a base")
+{
+    // Arrange
+    auto base = rand_p();
+    auto exponent = rand_q();
+    auto key = base->toHex();
+    auto expected = pow_mod_p(*base, *exponent->toElementModP());
+    auto &baseLimbs = const_cast<uint64_t(&)[MAX_P_LEN]>(base->cref());
+    auto &limbs = const_cast<uint64_t(&)[MAX_Q_LEN]>(exponent->cref());
+
+    // Act
+    ElementModP fromTable(LookupTableContext::pow_mod_p(key, baseLimbs, limbs), true);
+    LookupTableContext::setLayout(key, FixedBaseLayout{10, 4});
+    ElementModP fromComb(LookupTableContext::pow_mod_p(key, baseLimbs, limbs), true);
+    auto combLayout = LookupTableContext::getLayout(key);
+    // the comb is released again when the byte table replaces it
+    LookupTableContext::setLayout(key, FixedBaseLayout());
+    ElementModP fromRestored(LookupTableContext::pow_mod_p(key, baseLimbs, limbs), true);
+
+    // Assert
+    CHECK(combLayout.combTeeth == 10);
+    CHECK(LookupTableContext::getLayout(key).combTeeth == 0);
+    CHECK(LookupTableContext::getLayout(base->toHex() + "0").combTeeth == 0);
+    CHECK((fromTable == *expected));
+    CHECK((fromComb == *expected));
+    CHECK((fromRestored == *expected));
+}
+
+TEST_CASE("Comb tables reject layouts that do not fit the exponent")
+{
+    // Arrange
+    auto base = G();
+    auto *limbs = const_cast<uint64_t *>(base.cget());
+
+    // Act & Assert
+    CHECK_THROWS(CombTable(limbs, 0, 4));
+    CHECK_THROWS(CombTable(limbs, 17, 4));
+    CHECK_THROWS(CombTable(limbs, 8, 0));
+    CHECK_THROWS(CombTable(limbs, 8, 33));
+    CHECK_THROWS(LookupTableContext::setLayout("invalid", FixedBaseLayout{8, 0}));
+}
+
+TEST_CASE("Constant time fixed base exponentiation gives the same result for every table")
+{
+    // Arrange
+    auto base = rand_p();
+    auto exponents = std::vector<std::unique_ptr<ElementModQ>>();
+    exponents.push_back(rand_q());
+    exponents.push_back(ElementModQ::fromUint64(1));
+    exponents.push_back(sub_mod_q(ZERO_MOD_Q(), ONE_MOD_Q()));
+    auto *baseLimbs = const_cast<uint64_t *>(base->cget());
+    LookupTableType table(baseLimbs, TableMemoryPolicy::standard);
+    CombTable comb(baseLimbs, 6, 4, TableMemoryPolicy::standard);
+
+    for (const auto &exponent : exponents) {
+        // Act
+        auto expected = pow_mod_p(*base, *exponent->toElementModP());
+        std::vector<uint64_t> fromTable(MAX_P_LEN);
+        std::vector<uint64_t> fromComb(MAX_P_LEN);
+        table.pow_mod_p_constant_time(exponent->cget(), fromTable.data());
+        comb.pow_mod_p_constant_time(exponent->cget(), fromComb.data());
+
+        // Assert
+        CHECK((ElementModP(fromTable, true) == *expected));
+        CHECK((ElementModP(fromComb, true) == *expected));
+    }
+}
+
+TEST_CASE("Constant time fixed base exponentiation gives the same result for every backend")
+{
+    // Arrange
+    auto base = rand_p();
+    auto exponent = rand_q();
+    auto expected = pow_mod_p(*base, *exponent->toElementModP());
+    auto *baseLimbs = const_cast<uint64_t *>(base->cget());
+    LookupTableType table(baseLimbs, TableMemoryPolicy::standard);
+    CombTable comb(baseLimbs, 5, 4, TableMemoryPolicy::standard);
+    auto previous = facades::Bignum4096::backend;
+
+    for (auto backend :
+         {facades::Bignum4096Backend::portable, facades::Bignum4096Backend::avx512ifma}) {
+        // Act
+        facades::Bignum4096::backend = backend;
+        std::vector<uint64_t> fromTable(MAX_P_LEN);
+        std::vector<uint64_t> fromComb(MAX_P_LEN);
+        table.pow_mod_p_constant_time(exponent->cget(), fromTable.data());
+        comb.pow_mod_p_constant_time(exponent->cget(), fromComb.data());
+        facades::Bignum4096::backend = previous;
+
+        // Assert
+        CHECK((ElementModP(fromTable, true) == *expected));
+        CHECK((ElementModP(fromComb, true) == *expected));
+    }
+}
+
+TEST_CASE("Fixed base timing is selectable globally and for each call")
+{
+    // Arrange
+    auto nonce = rand_q();
+    auto expected = pow_mod_p(G(), *nonce->toElementModP());
+    auto enabled = is_constant_time_fixed_base();
+
+    // Act
+    auto variableTime = g_pow_p(*nonce, FixedBaseTiming::variableTime);
+    auto constantTime = g_pow_p(*nonce, FixedBaseTiming::constantTime);
+    set_constant_time_fixed_base(true);
+    auto configured = g_pow_p(*nonce);
+    auto isEnabled = is_constant_time_fixed_base();
+    set_constant_time_fixed_base(enabled);
+
+    // Assert
+    CHECK(isEnabled);
+    CHECK((*variableTime == *expected));
+    CHECK((*constantTime == *expected));
+    CHECK((*configured == *expected));
+}
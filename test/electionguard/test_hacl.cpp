@@ -1,11 +1,14 @@
 #include "../../libs/hacl/Hacl_Bignum256.hpp"
 #include "../../libs/hacl/Hacl_Bignum4096.hpp"
 #include "../../libs/hacl/Hacl_Bignum4096_32.hpp"
+#include "../../src/electionguard/facades/bignum4096.hpp"
 #include "../../src/electionguard/log.hpp"
 #include "utils/constants.hpp"
 
 #include <doctest/doctest.h>
+#include <cstring>
 #include <electionguard/constants.h>
+#include <electionguard/group.hpp>
 #include <electionguard/hash.hpp>
 
 using namespace electionguard;
@@ -340,4 +343,135 @@ TEST_CASE("Test less than BigNum 256")
     CHECK(isLessThan);
 }
 
-#pragma endregion
\ No newline at end of file
+#pragma endregion
+
+#pragma region backends
+
+/// <summary>
+/// Run an operation on the prime context using the specified backend
+/// </summary>
+template <typename F> void withBackend(facades::Bignum4096Backend backend, F operation)
+{
+    auto previous = facades::Bignum4096::backend;
+    facades::Bignum4096::backend = backend;
+    operation(facades::CONTEXT_P());
+    facades::Bignum4096::backend = previous;
+}
+
+TEST_CASE("Bignum4096 vector backend montgomery multiplication matches portable backend")
+{
+    if (!facades::isBignum4096BackendSupported(facades::Bignum4096Backend::avx512ifma)) {
+        Log::info("skipping: avx512ifma is not supported on this machine");
+        return;
+    }
+
+    // Arrange
+    uint64_t pMinusOne[MAX_P_LEN] = {};
+    uint64_t one[MAX_P_LEN] = {1};
+    facades::Bignum4096::sub(P().get(), static_cast<uint64_t *>(one), pMinusOne);
+    auto random = rand_q()->toElementModP();
+    vector<vector<uint64_t>> values = {
+      vector<uint64_t>(MAX_P_LEN, 0),
+      vector<uint64_t>(&one[0], &one[MAX_P_LEN]),
+      vector<uint64_t>(&pMinusOne[0], &pMinusOne[MAX_P_LEN]),
+      vector<uint64_t>(&LARGE_P_ARRAY_1[0], &LARGE_P_ARRAY_1[MAX_P_LEN]),
+      vector<uint64_t>(&LARGE_P_ARRAY_2[0], &LARGE_P_ARRAY_2[MAX_P_LEN]),
+      vector<uint64_t>(G().get(), G().get() + MAX_P_LEN),
+      vector<uint64_t>(random->get(), random->get() + MAX_P_LEN),
+    };
+
+    for (auto &a : values) {
+        for (auto &b : values) {
+            uint64_t aM[MAX_P_LEN] = {};
+            uint64_t bM[MAX_P_LEN] = {};
+            facades::CONTEXT_P().to_montgomery_form(a.data(), aM);
+            facades::CONTEXT_P().to_montgomery_form(b.data(), bM);
+
+            // Act
+            uint64_t portable[MAX_P_LEN] = {};
+            uint64_t accelerated[MAX_P_LEN] = {};
+            withBackend(facades::Bignum4096Backend::portable, [&](const auto &context) {
+                context.montgomery_mod_mul_stay_in_mont_form(aM, bM, portable);
+            });
+            withBackend(facades::Bignum4096Backend::avx512ifma, [&](const auto &context) {
+                context.montgomery_mod_mul_stay_in_mont_form(aM, bM, accelerated);
+            });
+
+            // Assert
+            CHECK(memcmp(portable, accelerated, MAX_P_SIZE) == 0);
+        }
+    }
+}
+
+TEST_CASE("Bignum4096 vector backend repeated squaring matches portable backend")
+{
+    if (!facades::isBignum4096BackendSupported(facades::Bignum4096Backend::avx512ifma)) {
+        Log::info("skipping: avx512ifma is not supported on this machine");
+        return;
+    }
+
+    // Arrange
+    uint64_t portable[MAX_P_LEN] = {};
+    uint64_t accelerated[MAX_P_LEN] = {};
+    facades::CONTEXT_P().to_montgomery_form(G().get(), portable);
+    memcpy(accelerated, portable, MAX_P_SIZE);
+
+    // Act
+    withBackend(facades::Bignum4096Backend::portable, [&](const auto &context) {
+        for (auto i = 0; i < 1000; i++) {
+            context.montgomery_mod_mul_stay_in_mont_form(portable, portable, portable);
+        }
+    });
+    withBackend(facades::Bignum4096Backend::avx512ifma, [&](const auto &context) {
+        for (auto i = 0; i < 1000; i++) {
+            context.montgomery_mod_mul_stay_in_mont_form(accelerated, accelerated, accelerated);
+        }
+    });
+
+    // Assert
+    CHECK(memcmp(portable, accelerated, MAX_P_SIZE) == 0);
+}
+
+TEST_CASE("Bignum4096 vector backend mod exp matches portable backend")
+{
+    if (!facades::isBignum4096BackendSupported(facades::Bignum4096Backend::avx512ifma)) {
+        Log::info("skipping: avx512ifma is not supported on this machine");
+        return;
+    }
+
+    // Arrange
+    uint64_t two[MAX_P_LEN] = {2};
+    uint64_t pMinusTwo[MAX_P_LEN] = {};
+    facades::Bignum4096::sub(P().get(), static_cast<uint64_t *>(two), pMinusTwo);
+    uint64_t small[MAX_P_LEN] = {0x55};
+    auto exponent = rand_q()->toElementModP();
+    struct Case {
+        uint64_t *base;
+        uint32_t bits;
+        uint64_t *exponent;
+    };
+    vector<Case> cases = {
+      {G().get(), MAX_Q_SIZE * 8, exponent->get()},
+      {G().get(), MAX_P_SIZE, exponent->get()},
+      {const_cast<uint64_t *>(LARGE_P_ARRAY_1), 7, static_cast<uint64_t *>(small)},
+      {const_cast<uint64_t *>(LARGE_P_ARRAY_1), MAX_P_SIZE * 8, pMinusTwo},
+      {const_cast<uint64_t *>(LARGE_P_ARRAY_2), MAX_P_SIZE * 8, P().get()},
+    };
+
+    for (auto &test : cases) {
+        // Act
+        uint64_t portable[MAX_P_LEN] = {};
+        uint64_t accelerated[MAX_P_LEN] = {};
+        withBackend(facades::Bignum4096Backend::portable, [&](const auto &context) {
+            context.modExp(test.base, test.bits, test.exponent, portable, false);
+        });
+        withBackend(facades::Bignum4096Backend::avx512ifma, [&](const auto &context) {
+            context.modExp(test.base, test.bits, test.exponent, accelerated, false);
+        });
+
+        // Assert
+        CHECK(memcmp(portable, accelerated, MAX_P_SIZE) == 0);
+    }
+}
+
+#pragma endregion
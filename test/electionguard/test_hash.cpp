@@ -1,6 +1,9 @@
 #include "../../src/electionguard/log.hpp"
+#include "../../src/electionguard/sha256.hpp"
+#include "utils/constants.hpp"
 
 #include <doctest/doctest.h>
+#include <cstring>
 #include <electionguard/hash.hpp>
 #include <iomanip>
 #include <iostream>
@@ -114,3 +117,83 @@ TEST_CASE("Same Hash Value from nested-list and result of hashed list by hashing
     // but different addresses
     CHECK(&nestedHash != &nonNestedHash2);
 }
+
+TEST_CASE("Hash batch produces the same hashes as hashing each list")
+{
+    // Arrange
+    auto p = make_unique<ElementModP>(LARGE_P_ARRAY_1, true);
+    auto q = make_unique<ElementModQ>(LARGE_Q_ARRAY_1, true);
+    vector<vector<CryptoHashableType>> inputs = {
+      {},
+      {"0"},
+      {p.get(), q.get()},
+      {q.get(), 1UL},
+      {string(54, 'a')},
+      {string(55, 'a')},
+      {string(62, 'a')},
+      {string(63, 'a')},
+      {p.get(), p.get(), p.get(), "label"},
+      {vector<string>{"0", "1"}, "3"},
+      {q.get(), 2UL},
+      {string(200, 'b')},
+      {nullptr},
+    };
+
+    // Act
+    auto result = hash_elems_batch(inputs);
+
+    // Assert
+    CHECK(result.size() == inputs.size());
+    for (size_t i = 0; i < inputs.size(); i++) {
+        CHECK((*result[i] == *hash_elems(inputs[i])));
+    }
+}
+
+TEST_CASE("Sha256 engines produce the same digests as the portable engine")
+{
+    // Arrange
+    const uint8_t abcDigest[Sha256::DIGEST_SIZE] = {
+      0xba, 0x78, 0x16, 0xbf, 0x8f, 0x01, 0xcf, 0xea, 0x41, 0x41, 0x40,
+      0xde, 0x5d, 0xae, 0x22, 0x23, 0xb0, 0x03, 0x61, 0xa3, 0x96, 0x17,
+      0x7a, 0x9c, 0xb4, 0x10, 0xff, 0x61, 0xf2, 0x00, 0x15, 0xad};
+    vector<string> messages = {"abc"};
+    for (size_t length = 0; length < 300; length += 7) {
+        string message(length, '\0');
+        for (size_t i = 0; i < length; i++) {
+            message[i] = static_cast<char>((i * 31 + length) & 0xff);
+        }
+        messages.push_back(message);
+    }
+
+    auto previousEngine = Sha256::engine;
+    auto previousBatchEngine = Sha256::batchEngine;
+    Sha256::engine = Sha256Engine::portable;
+    Sha256::batchEngine = Sha256Engine::portable;
+    vector<uint8_t> expected(messages.size() * Sha256::DIGEST_SIZE);
+    Sha256::hashMany(messages, expected.data());
+
+    for (auto engine : {Sha256Engine::shaNi, Sha256Engine::avx2}) {
+        if (!Sha256::isSupported(engine)) {
+            continue;
+        }
+
+        // Act
+        Sha256::engine = engine == Sha256Engine::shaNi ? engine : Sha256Engine::portable;
+        Sha256::batchEngine = engine;
+        vector<uint8_t> single(messages.size() * Sha256::DIGEST_SIZE);
+        for (size_t i = 0; i < messages.size(); i++) {
+            Sha256::hash(reinterpret_cast<const uint8_t *>(messages[i].data()),
+                         messages[i].size(), &single[i * Sha256::DIGEST_SIZE]);
+        }
+        vector<uint8_t> batch(messages.size() * Sha256::DIGEST_SIZE);
+        Sha256::hashMany(messages, batch.data());
+
+        // Assert
+        CHECK(memcmp(batch.data(), abcDigest, Sha256::DIGEST_SIZE) == 0);
+        CHECK(single == expected);
+        CHECK(batch == expected);
+    }
+
+    Sha256::engine = previousEngine;
+    Sha256::batchEngine = previousBatchEngine;
+}
@@ -0,0 +1,49 @@
+#include <assert.h>
+#include <electionguard/metrics.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+static bool test_metrics_snapshot(void);
+
+bool test_metrics(void)
+{
+    printf("\n -------- test_metrics.c --------- \n");
+    return test_metrics_snapshot();
+}
+
+bool test_metrics_snapshot(void)
+{
+    printf("\n -------- test_metrics_snapshot -------- \n");
+
+    // Arrange
+    if (eg_metrics_reset()) {
+        assert(false);
+    }
+
+    uint64_t count = eg_metrics_get_count();
+    uint64_t values[32] = {0};
+    uint64_t written = 0;
+
+    // Act
+    if (eg_metrics_snapshot(values, 32, &written)) {
+        assert(false);
+    }
+
+    // Assert
+    assert(written == count);
+    for (uint64_t i = 0; i < written; i++) {
+        assert(values[i] == 0);
+        assert(eg_metrics_get_name((eg_metric_t)i) != NULL);
+    }
+    assert(strcmp(eg_metrics_get_name(ELECTIONGUARD_METRIC_HASH_BYTES), "hash_bytes") == 0);
+    assert(eg_metrics_get_name((eg_metric_t)count) == NULL);
+
+    uint64_t value = 1;
+    if (eg_metrics_get(ELECTIONGUARD_METRIC_POW_MOD_P_FULL, &value)) {
+        assert(false);
+    }
+    assert(value == 0);
+
+    return true;
+}
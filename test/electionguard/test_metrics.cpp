@@ -0,0 +1,71 @@
+#include <doctest/doctest.h>
+#include <electionguard/constants.h>
+#include <electionguard/group.hpp>
+#include <electionguard/hash.hpp>
+#include <electionguard/metrics.hpp>
+#include <thread>
+
+using namespace electionguard;
+using namespace std;
+
+TEST_CASE("Metrics count full and fixed base exponentiations separately")
+{
+    // Arrange
+    auto exponent = rand_q();
+    auto base = g_pow_p(*rand_q());
+    Metrics::reset();
+
+    // Act
+    auto full = pow_mod_p(*base, *exponent);
+    auto table = g_pow_p(*exponent);
+    auto snapshot = Metrics::snapshot();
+
+    // Assert
+    CHECK(snapshot[static_cast<size_t>(Metric::powModPFull)] == 1);
+    CHECK(snapshot[static_cast<size_t>(Metric::powModPTable)] == 1);
+    CHECK(Metrics::get(Metric::elementAllocations) > 0);
+}
+
+TEST_CASE("Metrics count hash invocations and bytes")
+{
+    // Arrange
+    Metrics::reset();
+
+    // Act
+    auto single = hash_elems(string("abc"));
+    auto batch = hash_elems_batch({{string("abc")}, {string("abc")}});
+
+    // Assert
+    // each message is the delimited input "|abc|"
+    CHECK(Metrics::get(Metric::hashInvocations) == 3);
+    CHECK(Metrics::get(Metric::hashBytes) == 15);
+}
+
+TEST_CASE("Metrics include counts from threads that have exited")
+{
+    // Arrange
+    Metrics::reset();
+
+    // Act
+    thread worker([] { Metrics::increment(Metric::precomputeMisses, 3); });
+    worker.join();
+    Metrics::increment(Metric::precomputeMisses);
+
+    // Assert
+    CHECK(Metrics::get(Metric::precomputeMisses) == 4);
+}
+
+TEST_CASE("Metrics reset starts every count from zero")
+{
+    // Arrange
+    Metrics::increment(Metric::discreteLogCacheHits, 5);
+
+    // Act
+    Metrics::reset();
+
+    // Assert
+    for (auto value : Metrics::snapshot()) {
+        CHECK(value == 0);
+    }
+    CHECK(string(Metrics::getName(Metric::discreteLogCacheHits)) == "discrete_log_cache_hits");
+}
@@ -0,0 +1,190 @@
+#include "generators/manifest.hpp"
+
+#include <chrono>
+#include <doctest/doctest.h>
+#include <electionguard/constants.h>
+#include <electionguard/elgamal.hpp>
+#include <electionguard/group.hpp>
+#include <electionguard/manifest.hpp>
+#include <electionguard/precompute_buffers.hpp>
+#include <thread>
+
+using namespace electionguard;
+using namespace electionguard::tools::generators;
+using namespace std;
+
+TEST_CASE("Precompute profile from a manifest counts placeholders and contests")
+{
+    // Arrange
+    auto manifest = ManifestGenerator::getJeffersonCountyManifest_Minimal();
+    auto internal = make_unique<InternalManifest>(*manifest);
+
+    // Act
+    auto profile = PrecomputeProfile::fromManifest(*internal);
+
+    // Assert
+    CHECK(profile.contestsPerBallot > 0.0);
+    CHECK(profile.selectionsPerBallot > profile.contestsPerBallot);
+    CHECK(profile.getEncryptionsPerSelection() ==
+          doctest::Approx(profile.contestsPerBallot * PrecomputeProfile::ENCRYPTIONS_PER_CONTEST /
+                          profile.selectionsPerBallot));
+}
+
+TEST_CASE("Precompute buffer fills both queues to the depth of the profile")
+{
+    // Arrange
+    auto keypair = ElGamalKeyPair::fromSecret(TWO_MOD_Q(), false);
+    PrecomputeBuffer buffer(*keypair->getPublicKey(), 4);
+    PrecomputeProfile profile;
+    profile.contestsPerBallot = 1.0;
+    profile.selectionsPerBallot = 2.0;
+    buffer.setProfile(profile);
+
+    // Act
+    buffer.start();
+    auto status = buffer.getStatus();
+
+    // Assert
+    CHECK(status.selections.target == 4);
+    CHECK(status.selections.size == 4);
+    CHECK(status.encryptions.target == 4);
+    CHECK(status.encryptions.size == 4);
+    CHECK(status.encryptionsPerSelection == doctest::Approx(1.0));
+}
+
+TEST_CASE("Precompute buffer fills the queues on several background producers")
+{
+    // Arrange
+    auto keypair = ElGamalKeyPair::fromSecret(TWO_MOD_Q(), false);
+    PrecomputeBuffer buffer(*keypair->getPublicKey(), 6);
+    PrecomputeProfile profile;
+    profile.contestsPerBallot = 1.0;
+    profile.selectionsPerBallot = 2.0;
+    buffer.setProfile(profile);
+
+    // Act
+    buffer.startAsync(3);
+    auto started = buffer.getStatus();
+    // the producers finish by themselves once both queues are full
+    while (buffer.getStatus().producers > 0) {
+        this_thread::sleep_for(chrono::milliseconds(10));
+    }
+    buffer.stop();
+    auto status = buffer.getStatus();
+
+    // Assert
+    CHECK(started.producers <= 3);
+    CHECK(status.producers == 0);
+    CHECK(status.selections.size == 6);
+    CHECK(status.encryptions.size == status.encryptions.target);
+}
+
+TEST_CASE("Precompute buffer populates the queues in slices")
+{
+    // Arrange
+    auto keypair = ElGamalKeyPair::fromSecret(TWO_MOD_Q(), false);
+    PrecomputeBuffer buffer(*keypair->getPublicKey(), 2);
+    PrecomputeProfile profile;
+    profile.contestsPerBallot = 1.0;
+    profile.selectionsPerBallot = 2.0;
+    buffer.setProfile(profile);
+
+    // Act
+    auto firstSlice = buffer.populate(1);
+    auto filled = firstSlice;
+    size_t slices = 1;
+    while (!filled) {
+        filled = buffer.populate(1);
+        slices++;
+    }
+    auto status = buffer.getStatus();
+
+    // Assert
+    CHECK(firstSlice == false);
+    CHECK(slices == 5); // two quadruples, two triples and the slice that finds them full
+    CHECK(status.selections.size == 2);
+    CHECK(status.encryptions.size == 2);
+}
+
+TEST_CASE("Precompute buffer counts misses and follows the observed consumption")
+{
+    // Arrange
+    auto keypair = ElGamalKeyPair::fromSecret(TWO_MOD_Q(), false);
+    PrecomputeBuffer buffer(*keypair->getPublicKey(), 2);
+    buffer.start();
+    auto before = buffer.getStatus();
+
+    // Act
+    // draw far more encryptions than the default mix expects
+    for (int i = 0; i < 256; i++) {
+        buffer.popPrecomputedEncryption();
+    }
+    auto after = buffer.getStatus();
+    buffer.start();
+    auto refilled = buffer.getStatus();
+
+    // Assert
+    CHECK(before.encryptions.hits == 0);
+    CHECK(before.encryptions.misses == 0);
+    CHECK(after.encryptions.size == 0);
+    CHECK(after.encryptions.hits == before.encryptions.size);
+    CHECK(after.encryptions.misses == 256 - before.encryptions.size);
+    CHECK(after.encryptionsPerSelection > before.encryptionsPerSelection);
+    CHECK(after.encryptions.target > before.encryptions.target);
+    CHECK(refilled.encryptions.size == refilled.encryptions.target);
+    CHECK(refilled.selections.size == 2);
+}
+
+TEST_CASE("Precompute buffer context keeps a buffer for each public key")
+{
+    // Arrange
+    auto first = ElGamalKeyPair::fromSecret(TWO_MOD_Q(), false);
+    auto second = ElGamalKeyPair::fromSecret(*ElementModQ::fromUint64(3), false);
+    PrecomputeBufferContext::initialize(*first->getPublicKey(), 2);
+    PrecomputeBufferContext::start();
+
+    // Act
+    PrecomputeBufferContext::add(*second->getPublicKey(), 1);
+    PrecomputeBufferContext::start(*second->getPublicKey());
+    auto firstBuffer = PrecomputeBufferContext::getBuffer(*first->getPublicKey());
+    auto secondBuffer = PrecomputeBufferContext::getBuffer(*second->getPublicKey());
+
+    // Assert
+    CHECK(PrecomputeBufferContext::getBufferCount() == 2);
+    CHECK(firstBuffer != nullptr);
+    CHECK(secondBuffer != nullptr);
+    CHECK(firstBuffer->getCurrentQueueSize() == 2);
+    CHECK(secondBuffer->getCurrentQueueSize() == 1);
+    CHECK(*PrecomputeBufferContext::getPublicKey() == *second->getPublicKey());
+
+    PrecomputeBufferContext::remove(*second->getPublicKey());
+    CHECK(PrecomputeBufferContext::getBufferCount() == 1);
+    CHECK(PrecomputeBufferContext::getBuffer(*second->getPublicKey()) == nullptr);
+    CHECK(*PrecomputeBufferContext::getPublicKey() == *first->getPublicKey());
+    PrecomputeBufferContext::clear();
+}
+
+TEST_CASE("Precompute buffer context stops filling at the memory budget")
+{
+    // Arrange
+    auto keypair = ElGamalKeyPair::fromSecret(TWO_MOD_Q(), false);
+    auto budget = 2 * PrecomputeBuffer::SELECTION_BYTES + PrecomputeBuffer::ENCRYPTION_BYTES;
+    PrecomputeBufferContext::setMemoryBudget(budget);
+    PrecomputeBufferContext::initialize(*keypair->getPublicKey(), 10);
+
+    // Act
+    PrecomputeBufferContext::start();
+    auto filled = PrecomputeBufferContext::getMemoryUsage();
+    auto queueSize = PrecomputeBufferContext::getCurrentQueueSize();
+    PrecomputeBufferContext::popPrecomputedSelection();
+    auto drawn = PrecomputeBufferContext::getMemoryUsage();
+    PrecomputeBufferContext::clear();
+    PrecomputeBufferContext::setMemoryBudget(0);
+
+    // Assert
+    CHECK(filled <= budget);
+    CHECK(filled > 0);
+    CHECK(queueSize < 10);
+    CHECK(drawn == filled - PrecomputeBuffer::SELECTION_BYTES);
+    CHECK(PrecomputeBufferContext::getMemoryUsage() == 0);
+}
@@ -0,0 +1,72 @@
+#include "../../src/electionguard/trace_span.hpp"
+
+#include <doctest/doctest.h>
+#include <electionguard/tracing.hpp>
+#include <string>
+#include <thread>
+
+using namespace electionguard;
+using namespace std;
+
+static size_t countOccurrences(const string &text, const string &pattern)
+{
+    size_t count = 0;
+    for (auto i = text.find(pattern); i != string::npos; i = text.find(pattern, i + 1)) {
+        count++;
+    }
+    return count;
+}
+
+TEST_CASE("Tracing exports recorded spans as chrome trace events")
+{
+    // Arrange
+    Tracing::clear();
+    Tracing::setEnabled(true);
+
+    // Act
+    {
+        TraceSpan outer("test::outer");
+        TraceSpan inner("test::inner");
+    }
+    thread worker([] { TraceSpan span("test::worker"); });
+    worker.join();
+    Tracing::setEnabled(false);
+    auto json = Tracing::toChromeTraceJson();
+
+    // Assert
+    CHECK(json.find("\"traceEvents\"") != string::npos);
+    if (Tracing::isCompiledIn()) {
+        CHECK(countOccurrences(json, "\"ph\":\"X\"") == 3);
+        CHECK(json.find("test::outer") != string::npos);
+        CHECK(json.find("test::worker") != string::npos);
+    } else {
+        CHECK(countOccurrences(json, "\"ph\":\"X\"") == 0);
+    }
+    Tracing::clear();
+}
+
+TEST_CASE("Tracing keeps the most recent spans when a thread buffer is full")
+{
+    // Arrange
+    Tracing::setThreadCapacity(2);
+    thread worker([] {
+        Tracing::setEnabled(true);
+
+        // Act
+        { TraceSpan span("test::first"); }
+        { TraceSpan span("test::second"); }
+        { TraceSpan span("test::third"); }
+        Tracing::setEnabled(false);
+    });
+    worker.join();
+    auto json = Tracing::toChromeTraceJson();
+
+    // Assert
+    CHECK(json.find("test::first") == string::npos);
+    if (Tracing::isCompiledIn()) {
+        CHECK(json.find("test::second") != string::npos);
+        CHECK(json.find("test::third") != string::npos);
+    }
+    Tracing::setThreadCapacity(Tracing::DEFAULT_THREAD_CAPACITY);
+    Tracing::clear();
+}
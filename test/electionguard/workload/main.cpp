@@ -0,0 +1,137 @@
+#include "workload.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+using namespace electionguard::tools::workload;
+using std::cerr;
+using std::cout;
+using std::invalid_argument;
+using std::string;
+
+static const char *usage =
+  "usage: ElectionGuardWorkload [options]\n"
+  "  --scenario <label>           name recorded in the output\n"
+  "  --manifest <file>            manifest under data/ "
+  "(default election_manifest_jefferson_county.json)\n"
+  "  --ballots <count>            ballots to encrypt (default 100)\n"
+  "  --threads <count>            encryption threads (default 1)\n"
+  "  --mix <single|uniform>       how ballot styles are chosen (default uniform)\n"
+  "  --overvote-rate <fraction>   chance a contest is overvoted (default 0)\n"
+  "  --seed <value>               seed for the ballot contents (default 1)\n"
+  "  --tables <warm|cold>         build the fixed base tables before measuring (default warm)\n"
+  "  --precompute <on|off>        fill the precompute buffers before measuring (default off)\n"
+  "  --verify <on|off>            verify the proofs of each ballot (default on)\n"
+  "  --serialize <none|json|msgpack>  serialize each encrypted ballot (default none)\n"
+  "  --output <file>              write the JSON result to a file instead of stdout\n"
+  "  --min-throughput <ballots/s> exit with 1 when the throughput is lower\n"
+  "  --max-p99-ms <milliseconds>  exit with 1 when the p99 latency is higher\n";
+
+static bool parseSwitch(const string &value, const char *on, const char *off)
+{
+    if (value == on) {
+        return true;
+    }
+    if (value == off) {
+        return false;
+    }
+    throw invalid_argument("expected " + string(on) + " or " + string(off) + ": " + value);
+}
+
+int main(int argc, char **argv)
+{
+    WorkloadOptions options;
+    string outputFile;
+    double minThroughput = 0.0;
+    double maxP99 = 0.0;
+
+    try {
+        for (int i = 1; i < argc; i++) {
+            string flag = argv[i];
+            if (flag == "--help" || flag == "-h") {
+                cout << usage;
+                return 0;
+            }
+            if (i + 1 >= argc) {
+                throw invalid_argument("missing value for " + flag);
+            }
+            string value = argv[++i];
+            if (flag == "--scenario") {
+                options.scenario = value;
+            } else if (flag == "--manifest") {
+                options.manifestFile = value;
+            } else if (flag == "--ballots") {
+                options.ballotCount = std::stoull(value);
+            } else if (flag == "--threads") {
+                options.threadCount = static_cast<uint32_t>(std::stoul(value));
+            } else if (flag == "--mix") {
+                options.mix = parseSwitch(value, "uniform", "single") ? BallotMix::uniform
+                                                                      : BallotMix::single;
+            } else if (flag == "--overvote-rate") {
+                options.overvoteRate = std::stod(value);
+            } else if (flag == "--seed") {
+                options.seed = std::stoull(value);
+            } else if (flag == "--tables") {
+                options.warmTables = parseSwitch(value, "warm", "cold");
+            } else if (flag == "--precompute") {
+                options.usePrecompute = parseSwitch(value, "on", "off");
+            } else if (flag == "--verify") {
+                options.verifyProofs = parseSwitch(value, "on", "off");
+            } else if (flag == "--serialize") {
+                if (value == "none") {
+                    options.serialization = Serialization::none;
+                } else if (value == "json") {
+                    options.serialization = Serialization::json;
+                } else if (value == "msgpack") {
+                    options.serialization = Serialization::msgpack;
+                } else {
+                    throw invalid_argument("unknown serialization: " + value);
+                }
+            } else if (flag == "--output") {
+                outputFile = value;
+            } else if (flag == "--min-throughput") {
+                minThroughput = std::stod(value);
+            } else if (flag == "--max-p99-ms") {
+                maxP99 = std::stod(value);
+            } else {
+                throw invalid_argument("unknown option: " + flag);
+            }
+        }
+    } catch (const std::exception &e) {
+        cerr << e.what() << "\n" << usage;
+        return 2;
+    }
+
+    WorkloadResult result;
+    try {
+        result = runWorkload(options);
+    } catch (const std::exception &e) {
+        cerr << "workload failed: " << e.what() << "\n";
+        return 2;
+    }
+
+    auto json = toJson(options, result);
+    if (outputFile.empty()) {
+        cout << json;
+    } else {
+        std::ofstream file(outputFile);
+        file << json;
+    }
+
+    // a nonzero exit lets ci fail the build when a scenario regresses
+    auto exitCode = 0;
+    if (minThroughput > 0.0 && result.ballotsPerSecond < minThroughput) {
+        cerr << "regression: " << result.ballotsPerSecond << " ballots/s is below "
+             << minThroughput << "\n";
+        exitCode = 1;
+    }
+    if (maxP99 > 0.0 && result.p99Milliseconds > maxP99) {
+        cerr << "regression: p99 latency of " << result.p99Milliseconds << "ms is above "
+             << maxP99 << "ms\n";
+        exitCode = 1;
+    }
+    return exitCode;
+}
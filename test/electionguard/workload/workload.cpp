@@ -0,0 +1,370 @@
+#include "workload.hpp"
+
+#include "../generators/election.hpp"
+#include "../generators/manifest.hpp"
+#include "../utils/constants.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <electionguard/ballot.hpp>
+#include <electionguard/election.hpp>
+#include <electionguard/elgamal.hpp>
+#include <electionguard/encrypt.hpp>
+#include <electionguard/manifest.hpp>
+#include <electionguard/precompute_buffers.hpp>
+#include <exception>
+#include <iomanip>
+#include <mutex>
+#include <new>
+#include <random>
+#include <sstream>
+#include <thread>
+
+#ifdef _WIN32
+#    include <malloc.h>
+#    include <windows.h>
+// psapi must follow windows.h
+#    include <psapi.h>
+#else
+#    include <sys/resource.h>
+#endif
+
+using namespace electionguard;
+using namespace electionguard::tools::generators;
+using std::atomic;
+using std::exception_ptr;
+using std::make_unique;
+using std::mt19937_64;
+using std::ostringstream;
+using std::string;
+using std::thread;
+using std::unique_ptr;
+using std::vector;
+using std::chrono::duration;
+using std::chrono::steady_clock;
+
+#pragma region Allocations
+
+// every allocation made through the global operator new is counted, which includes
+// the library on every platform except windows, where a dll keeps its own operator new
+static atomic<uint64_t> heapAllocations{0};
+
+void *operator new(std::size_t size)
+{
+    heapAllocations.fetch_add(1, std::memory_order_relaxed);
+    if (void *pointer = std::malloc(size == 0 ? 1 : size)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment)
+{
+    heapAllocations.fetch_add(1, std::memory_order_relaxed);
+    auto align = static_cast<std::size_t>(alignment);
+    // aligned_alloc requires the size to be a multiple of the alignment
+    auto rounded = (std::max<std::size_t>(size, 1) + align - 1) / align * align;
+#ifdef _WIN32
+    if (void *pointer = _aligned_malloc(rounded, align)) {
+#else
+    if (void *pointer = std::aligned_alloc(align, rounded)) {
+#endif
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *pointer) noexcept { std::free(pointer); }
+
+void operator delete(void *pointer, std::size_t) noexcept { std::free(pointer); }
+
+void operator delete(void *pointer, std::align_val_t) noexcept
+{
+#ifdef _WIN32
+    _aligned_free(pointer);
+#else
+    std::free(pointer);
+#endif
+}
+
+void operator delete(void *pointer, std::size_t, std::align_val_t alignment) noexcept
+{
+    operator delete(pointer, alignment);
+}
+
+#pragma endregion
+
+namespace electionguard::tools::workload
+{
+    const char *mixNames[] = {"single", "uniform"};
+    const char *serializationNames[] = {"none", "json", "msgpack"};
+
+#pragma region Ballots
+
+    static unique_ptr<PlaintextBallot> makeBallot(const InternalManifest &manifest,
+                                                  const BallotStyle &style,
+                                                  const string &ballotId, double overvoteRate,
+                                                  mt19937_64 &random)
+    {
+        std::uniform_real_distribution<double> chance(0.0, 1.0);
+        vector<unique_ptr<PlaintextBallotContest>> contests;
+        for (const auto &contest : manifest.getContestsFor(style.getObjectId())) {
+            auto descriptions = contest.get().getSelections();
+            std::shuffle(descriptions.begin(), descriptions.end(), random);
+
+            // mark up to the number of votes allowed, or one more for an overvote
+            auto allowed = contest.get().getVotesAllowed();
+            auto marks = std::uniform_int_distribution<uint64_t>(0, allowed)(random);
+            if (overvoteRate > 0.0 && chance(random) < overvoteRate) {
+                marks = allowed + 1;
+            }
+            marks = std::min<uint64_t>(marks, descriptions.size());
+
+            vector<unique_ptr<PlaintextBallotSelection>> selections;
+            for (uint64_t i = 0; i < descriptions.size(); i++) {
+                selections.push_back(make_unique<PlaintextBallotSelection>(
+                  descriptions[i].get().getObjectId(), i < marks ? 1UL : 0UL));
+            }
+            contests.push_back(
+              make_unique<PlaintextBallotContest>(contest.get().getObjectId(), move(selections)));
+        }
+        return make_unique<PlaintextBallot>(ballotId, style.getObjectId(), move(contests));
+    }
+
+    static vector<unique_ptr<PlaintextBallot>> makeBallots(const InternalManifest &manifest,
+                                                           const WorkloadOptions &options,
+                                                           uint64_t count)
+    {
+        mt19937_64 random(options.seed);
+        auto styles = manifest.getBallotStyles();
+        std::uniform_int_distribution<size_t> pickStyle(0, styles.size() - 1);
+
+        vector<unique_ptr<PlaintextBallot>> ballots;
+        ballots.reserve(count);
+        for (uint64_t i = 0; i < count; i++) {
+            auto index = options.mix == BallotMix::uniform ? pickStyle(random) : 0;
+            ballots.push_back(makeBallot(manifest, styles.at(index).get(),
+                                         "ballot-" + std::to_string(i), options.overvoteRate,
+                                         random));
+        }
+        return ballots;
+    }
+
+    /// <summary>
+    /// The number of selections encrypted for a ballot, including the placeholders
+    /// </summary>
+    static uint64_t countSelections(const InternalManifest &manifest,
+                                    const PlaintextBallot &ballot)
+    {
+        uint64_t count = 0;
+        for (const auto &contest : manifest.getContestsFor(ballot.getStyleId())) {
+            count += contest.get().getSelections().size() + contest.get().getVotesAllowed();
+        }
+        return count;
+    }
+
+#pragma endregion
+
+    static double percentile(const vector<double> &sorted, double fraction)
+    {
+        if (sorted.empty()) {
+            return 0.0;
+        }
+        auto rank = static_cast<size_t>(std::ceil(fraction * static_cast<double>(sorted.size())));
+        return sorted[std::max<size_t>(rank, 1) - 1];
+    }
+
+    static double secondsSince(steady_clock::time_point start)
+    {
+        return duration<double>(steady_clock::now() - start).count();
+    }
+
+    WorkloadResult runWorkload(const WorkloadOptions &options)
+    {
+        WorkloadResult result;
+
+        auto manifest = ManifestGenerator::getManifestFromFile(options.manifestFile);
+        auto internal = make_unique<InternalManifest>(*manifest);
+        auto secret = ElementModQ::fromHex(a_fixed_secret);
+        auto keypair = ElGamalKeyPair::fromSecret(*secret);
+        auto context = ElectionGenerator::getFakeContext(*internal, *keypair->getPublicKey());
+        auto device = make_unique<EncryptionDevice>(12345UL, 23456UL, 34567UL, "Location");
+        auto ballotCodeSeed = device->getHash();
+
+        auto ballots = makeBallots(*internal, options, options.ballotCount);
+        for (const auto &ballot : ballots) {
+            result.selectionCount += countSelections(*internal, *ballot);
+        }
+
+        if (options.warmTables) {
+            auto warmup = makeBallots(*internal, options, 1);
+            encryptBallot(*warmup.front(), *internal, *context, *ballotCodeSeed, nullptr, 0,
+                          options.verifyProofs, false);
+        }
+
+        if (options.usePrecompute) {
+            auto start = steady_clock::now();
+            PrecomputeBufferContext::initialize(*keypair->getPublicKey(),
+                                                static_cast<uint32_t>(result.selectionCount));
+            PrecomputeBufferContext::setProfile(PrecomputeProfile::fromManifest(*internal));
+            PrecomputeBufferContext::start();
+            result.precomputeSeconds = secondsSince(start);
+        }
+
+        vector<double> latencies(ballots.size());
+        atomic<uint64_t> next{0};
+        atomic<uint64_t> serializedBytes{0};
+        exception_ptr failure;
+        std::mutex failureLock;
+
+        auto worker = [&]() {
+            try {
+                for (auto i = next.fetch_add(1); i < ballots.size(); i = next.fetch_add(1)) {
+                    auto start = steady_clock::now();
+                    auto encrypted =
+                      encryptBallot(*ballots[i], *internal, *context, *ballotCodeSeed, nullptr, 0,
+                                    options.verifyProofs, options.usePrecompute);
+                    if (options.serialization == Serialization::json) {
+                        serializedBytes += encrypted->toJson().size();
+                    } else if (options.serialization == Serialization::msgpack) {
+                        serializedBytes += encrypted->toMsgPack().size();
+                    }
+                    latencies[i] = secondsSince(start) * 1000.0;
+                }
+            } catch (...) {
+                std::lock_guard<std::mutex> guard(failureLock);
+                failure = std::current_exception();
+                next = ballots.size();
+            }
+        };
+
+        Metrics::reset();
+        auto allocationsBefore = getHeapAllocationCount();
+        auto start = steady_clock::now();
+
+        vector<thread> threads;
+        for (uint32_t i = 1; i < std::max<uint32_t>(options.threadCount, 1); i++) {
+            threads.emplace_back(worker);
+        }
+        worker();
+        for (auto &t : threads) {
+            t.join();
+        }
+
+        result.elapsedSeconds = secondsSince(start);
+        result.heapAllocations = getHeapAllocationCount() - allocationsBefore;
+        result.metrics = Metrics::snapshot();
+
+        if (options.usePrecompute) {
+            PrecomputeBufferContext::clear();
+        }
+        if (failure) {
+            std::rethrow_exception(failure);
+        }
+
+        std::sort(latencies.begin(), latencies.end());
+        result.ballotCount = ballots.size();
+        result.serializedBytes = serializedBytes;
+        result.ballotsPerSecond =
+          result.elapsedSeconds > 0.0 ? static_cast<double>(ballots.size()) / result.elapsedSeconds
+                                      : 0.0;
+        result.p50Milliseconds = percentile(latencies, 0.50);
+        result.p99Milliseconds = percentile(latencies, 0.99);
+        result.maxMilliseconds = latencies.empty() ? 0.0 : latencies.back();
+        result.peakRssBytes = getPeakRssBytes();
+        return result;
+    }
+
+#pragma region Export
+
+    static string escape(const string &value)
+    {
+        ostringstream out;
+        for (auto c : value) {
+            if (c == '"' || c == '\\') {
+                out << '\\' << c;
+            } else if (static_cast<unsigned char>(c) < 0x20) {
+                out << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+                    << static_cast<int>(c) << std::dec;
+            } else {
+                out << c;
+            }
+        }
+        return out.str();
+    }
+
+    string toJson(const WorkloadOptions &options, const WorkloadResult &result)
+    {
+        ostringstream out;
+        out << std::fixed << std::setprecision(3);
+        out << "{\n";
+        out << "  \"scenario\": \"" << escape(options.scenario) << "\",\n";
+        out << "  \"options\": {\n";
+        out << "    \"manifest\": \"" << escape(options.manifestFile) << "\",\n";
+        out << "    \"ballots\": " << options.ballotCount << ",\n";
+        out << "    \"threads\": " << options.threadCount << ",\n";
+        out << "    \"mix\": \"" << mixNames[static_cast<int>(options.mix)] << "\",\n";
+        out << "    \"overvote_rate\": " << options.overvoteRate << ",\n";
+        out << "    \"seed\": " << options.seed << ",\n";
+        out << "    \"tables\": \"" << (options.warmTables ? "warm" : "cold") << "\",\n";
+        out << "    \"precompute\": " << (options.usePrecompute ? "true" : "false") << ",\n";
+        out << "    \"verify\": " << (options.verifyProofs ? "true" : "false") << ",\n";
+        out << "    \"serialize\": \""
+            << serializationNames[static_cast<int>(options.serialization)] << "\"\n";
+        out << "  },\n";
+        out << "  \"result\": {\n";
+        out << "    \"ballots\": " << result.ballotCount << ",\n";
+        out << "    \"selections\": " << result.selectionCount << ",\n";
+        out << "    \"serialized_bytes\": " << result.serializedBytes << ",\n";
+        out << "    \"precompute_seconds\": " << result.precomputeSeconds << ",\n";
+        out << "    \"elapsed_seconds\": " << result.elapsedSeconds << ",\n";
+        out << "    \"ballots_per_second\": " << result.ballotsPerSecond << ",\n";
+        out << "    \"latency_p50_ms\": " << result.p50Milliseconds << ",\n";
+        out << "    \"latency_p99_ms\": " << result.p99Milliseconds << ",\n";
+        out << "    \"latency_max_ms\": " << result.maxMilliseconds << ",\n";
+        out << "    \"peak_rss_bytes\": " << result.peakRssBytes << ",\n";
+        out << "    \"heap_allocations\": " << result.heapAllocations << "\n";
+        out << "  },\n";
+        out << "  \"metrics\": {\n";
+        for (size_t i = 0; i < Metrics::COUNT; i++) {
+            out << "    \"" << Metrics::getName(static_cast<Metric>(i))
+                << "\": " << result.metrics[i] << (i + 1 < Metrics::COUNT ? ",\n" : "\n");
+        }
+        out << "  }\n";
+        out << "}\n";
+        return out.str();
+    }
+
+#pragma endregion
+
+#pragma region Process
+
+    uint64_t getHeapAllocationCount() { return heapAllocations.load(std::memory_order_relaxed); }
+
+    uint64_t getPeakRssBytes()
+    {
+#ifdef _WIN32
+        PROCESS_MEMORY_COUNTERS counters;
+        if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+            return static_cast<uint64_t>(counters.PeakWorkingSetSize);
+        }
+        return 0;
+#else
+        struct rusage usage;
+        if (getrusage(RUSAGE_SELF, &usage) != 0) {
+            return 0;
+        }
+#    ifdef __APPLE__
+        return static_cast<uint64_t>(usage.ru_maxrss);
+#    else
+        // linux reports kilobytes
+        return static_cast<uint64_t>(usage.ru_maxrss) * 1024;
+#    endif
+#endif
+    }
+
+#pragma endregion
+} // namespace electionguard::tools::workload
@@ -0,0 +1,90 @@
+#ifndef __ELECTIONGUARD_CPP_TEST_WORKLOAD_WORKLOAD_HPP_INCLUDED__
+#define __ELECTIONGUARD_CPP_TEST_WORKLOAD_WORKLOAD_HPP_INCLUDED__
+
+#include <cstdint>
+#include <electionguard/metrics.hpp>
+#include <string>
+
+namespace electionguard::tools::workload
+{
+    enum class BallotMix {
+        /// <summary>
+        /// every ballot uses the first ballot style in the manifest
+        /// </summary>
+        single,
+        /// <summary>
+        /// ballot styles are chosen uniformly from the manifest
+        /// </summary>
+        uniform,
+    };
+
+    enum class Serialization { none, json, msgpack };
+
+    /// <summary>
+    /// The shape of an end-to-end encryption run
+    /// </summary>
+    struct WorkloadOptions {
+        std::string scenario = "default";
+        std::string manifestFile = "election_manifest_jefferson_county.json";
+        uint64_t ballotCount = 100;
+        uint32_t threadCount = 1;
+        BallotMix mix = BallotMix::uniform;
+        /// <summary>
+        /// the chance that a contest is marked with one more selection than allowed
+        /// </summary>
+        double overvoteRate = 0.0;
+        uint64_t seed = 1;
+        /// <summary>
+        /// encrypt a ballot before measuring, so that the fixed base tables are built
+        /// </summary>
+        bool warmTables = true;
+        bool usePrecompute = false;
+        bool verifyProofs = true;
+        Serialization serialization = Serialization::none;
+    };
+
+    /// <summary>
+    /// The measurements of an end-to-end encryption run
+    /// </summary>
+    struct WorkloadResult {
+        uint64_t ballotCount = 0;
+        uint64_t selectionCount = 0;
+        uint64_t serializedBytes = 0;
+        double precomputeSeconds = 0.0;
+        double elapsedSeconds = 0.0;
+        double ballotsPerSecond = 0.0;
+        double p50Milliseconds = 0.0;
+        double p99Milliseconds = 0.0;
+        double maxMilliseconds = 0.0;
+        uint64_t peakRssBytes = 0;
+        /// <summary>
+        /// heap allocations made by every thread while the ballots were encrypted
+        /// </summary>
+        uint64_t heapAllocations = 0;
+        Metrics::Snapshot metrics{};
+    };
+
+    /// <summary>
+    /// Generate the ballots described by the options, then encrypt them
+    /// on the requested number of threads and measure the run
+    /// </summary>
+    WorkloadResult runWorkload(const WorkloadOptions &options);
+
+    /// <summary>
+    /// Export the options and the result of a run as a JSON document
+    /// suitable for comparing against a previous run
+    /// </summary>
+    std::string toJson(const WorkloadOptions &options, const WorkloadResult &result);
+
+    /// <summary>
+    /// The number of heap allocations made by the process so far
+    /// </summary>
+    uint64_t getHeapAllocationCount();
+
+    /// <summary>
+    /// The peak resident set size of the process so far
+    /// </summary>
+    uint64_t getPeakRssBytes();
+} // namespace electionguard::tools::workload
+
+#endif /* __ELECTIONGUARD_CPP_TEST_WORKLOAD_WORKLOAD_HPP_INCLUDED__ */
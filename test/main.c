@@ -9,6 +9,7 @@ bool test_ballot_code(void);
 bool test_ballot(void);
 bool test_chaum_pedersen_proof(void);
 bool test_collections(void);
+bool test_decrypt(void);
 bool test_election(void);
 bool test_elgamal(void);
 bool test_encrypt_compact(void);
@@ -16,6 +17,7 @@ bool test_encrypt(void);
 bool test_group(void);
 bool test_hash(void);
 bool test_manifest(void);
+bool test_metrics(void);
 
 int main(void)
 {
@@ -25,6 +27,7 @@ int main(void)
     bool ballot = test_ballot();
     bool proofs = test_chaum_pedersen_proof();
     bool collections = test_collections();
+    bool decrypt = test_decrypt();
     bool election = test_election();
     bool elgamal = test_elgamal();
     bool encrypt_compact = test_encrypt_compact();
@@ -32,9 +35,10 @@ int main(void)
     bool group = test_group();
     bool hash = test_hash();
     bool manifest = test_manifest();
+    bool metrics = test_metrics();
 
-    bool success = ballot_code && ballot && proofs && collections && election && elgamal &&
-                   encrypt_compact && encrypt && group && hash && manifest;
+    bool success = ballot_code && ballot && proofs && collections && decrypt && election &&
+                   elgamal && encrypt_compact && encrypt && group && hash && manifest && metrics;
 
     if (success == true) {
         printf("\n ---------- C TEST STATUS SUCCESS! ---------- \n");